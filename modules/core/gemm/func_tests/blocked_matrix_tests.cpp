@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "core/gemm/include/blocked_matrix.hpp"
+#include "core/gemm/include/gemm.hpp"
+
+namespace {
+
+std::vector<double> RandomMatrix(std::size_t size, uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-4, 4);
+  std::vector<double> matrix(size);
+  for (auto &value : matrix) {
+    value = dist(gen);
+  }
+  return matrix;
+}
+
+}  // namespace
+
+TEST(blocked_matrix_tests, round_trip_with_padding) {
+  constexpr std::size_t kRows = 13;
+  constexpr std::size_t kCols = 10;
+  constexpr std::size_t kLd = 12;
+  auto source = RandomMatrix(kRows * kLd, 1);
+  auto matrix = ppc::core::BlockedMatrix<double>::FromRowMajor(source.data(), kRows, kCols, kLd, 4);
+  EXPECT_EQ(matrix.GridRows(), 4U);
+  EXPECT_EQ(matrix.GridCols(), 3U);
+
+  std::vector<double> back(kRows * kLd, -1.0);
+  matrix.Store(back.data(), kLd);
+  for (std::size_t i = 0; i < kRows; i++) {
+    for (std::size_t j = 0; j < kLd; j++) {
+      // Columns past kCols belong to the caller and stay untouched
+      const double expected = j < kCols ? source[(i * kLd) + j] : -1.0;
+      ASSERT_EQ(back[(i * kLd) + j], expected) << i << ", " << j;
+      if (j < kCols) {
+        ASSERT_EQ(matrix(i, j), expected);
+      }
+    }
+  }
+  // Padding of the last tile is zero
+  EXPECT_EQ(matrix.Tile(3, 2)[(3 * 4) + 3], 0.0);
+}
+
+TEST(blocked_matrix_tests, tiles_are_contiguous_and_aligned) {
+  ppc::core::BlockedMatrix<double> matrix(9, 9, 3);
+  for (auto block : matrix) {
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block.data) % 64, 0U);
+    for (std::size_t i = 0; i < 3; i++) {
+      for (std::size_t j = 0; j < 3; j++) {
+        block.data[(i * 3) + j] = static_cast<double>((block.row * 100) + (block.col * 10) + i + j);
+      }
+    }
+  }
+  EXPECT_EQ(matrix(4, 8), 100 + 20 + 1 + 2);
+  EXPECT_EQ(matrix(8, 0), 200 + 2);
+}
+
+TEST(blocked_matrix_tests, iterates_every_tile_in_block_row_order) {
+  const ppc::core::BlockedMatrix<float> matrix(5, 7, 2);
+  std::size_t count = 0;
+  for (auto block : matrix) {
+    EXPECT_EQ(block.row, count / 4);
+    EXPECT_EQ(block.col, count % 4);
+    EXPECT_EQ(block.data, matrix.Tile(block.row, block.col));
+    count++;
+  }
+  EXPECT_EQ(count, 3U * 4U);
+}
+
+TEST(blocked_matrix_tests, tile_products_match_gemm) {
+  constexpr std::size_t kN = 40;
+  constexpr std::size_t kBlock = 8;
+  auto a = RandomMatrix(kN * kN, 2);
+  auto b = RandomMatrix(kN * kN, 3);
+  std::vector<double> expected(kN * kN);
+  ppc::core::Gemm<double>(kN, kN, kN, 1.0, a.data(), kN, b.data(), kN, 0.0, expected.data(), kN);
+
+  auto blocked_a = ppc::core::BlockedMatrix<double>::FromRowMajor(a.data(), kN, kN, kN, kBlock);
+  auto blocked_b = ppc::core::BlockedMatrix<double>::FromRowMajor(b.data(), kN, kN, kN, kBlock);
+  ppc::core::BlockedMatrix<double> blocked_c(kN, kN, kBlock);
+  for (auto block : blocked_c) {
+    for (std::size_t k = 0; k < blocked_a.GridCols(); k++) {
+      ppc::core::Gemm<double>(kBlock, kBlock, kBlock, 1.0, blocked_a.Tile(block.row, k), kBlock,
+                              blocked_b.Tile(k, block.col), kBlock, 1.0, block.data, kBlock);
+    }
+  }
+  EXPECT_EQ(blocked_c.ToRowMajor(), expected);
+}
+
+TEST(blocked_matrix_tests, resize_clears_values) {
+  ppc::core::BlockedMatrix<int> matrix(4, 4, 2);
+  matrix.Fill(7);
+  EXPECT_EQ(matrix(3, 3), 7);
+  matrix.Resize(3, 5, 2);
+  EXPECT_EQ(matrix.ToRowMajor(), std::vector<int>(15, 0));
+}
+
+TEST(blocked_matrix_tests, throws_on_zero_block_size) {
+  EXPECT_THROW(ppc::core::BlockedMatrix<double>(4, 4, 0), std::invalid_argument);
+}
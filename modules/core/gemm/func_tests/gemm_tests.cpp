@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "core/gemm/include/gemm.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+template <class T>
+std::vector<T> RandomMatrix(std::size_t size, uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-4, 4);
+  std::vector<T> matrix(size);
+  for (auto &value : matrix) {
+    if constexpr (std::is_same_v<T, std::complex<double>>) {
+      value = {static_cast<double>(dist(gen)), static_cast<double>(dist(gen))};
+    } else {
+      value = static_cast<T>(dist(gen));
+    }
+  }
+  return matrix;
+}
+
+// Dot-product triple loop, the kernel most tasks use
+template <class T>
+void NaiveGemm(std::size_t m, std::size_t n, std::size_t k, T alpha, const T *a, std::size_t lda, const T *b,
+               std::size_t ldb, T beta, T *c, std::size_t ldc) {
+  for (std::size_t i = 0; i < m; i++) {
+    for (std::size_t j = 0; j < n; j++) {
+      T sum{};
+      for (std::size_t p = 0; p < k; p++) {
+        sum += a[(i * lda) + p] * b[(p * ldb) + j];
+      }
+      c[(i * ldc) + j] = (alpha * sum) + (beta * c[(i * ldc) + j]);
+    }
+  }
+}
+
+// Block-by-block multiply of the Cannon/Fox tasks, block_size dividing n
+template <class T>
+void BlockedNaiveGemm(std::size_t n, std::size_t block_size, const T *a, const T *b, T *c) {
+  for (std::size_t bi = 0; bi < n; bi += block_size) {
+    for (std::size_t bj = 0; bj < n; bj += block_size) {
+      for (std::size_t bk = 0; bk < n; bk += block_size) {
+        for (std::size_t i = bi; i < bi + block_size; i++) {
+          for (std::size_t j = bj; j < bj + block_size; j++) {
+            T sum{};
+            for (std::size_t p = bk; p < bk + block_size; p++) {
+              sum += a[(i * n) + p] * b[(p * n) + j];
+            }
+            c[(i * n) + j] += sum;
+          }
+        }
+      }
+    }
+  }
+}
+
+std::vector<ppc::core::GemmIsa> SupportedIsas() {
+  std::vector<ppc::core::GemmIsa> isas;
+  for (auto isa : {ppc::core::kGemmGeneric, ppc::core::kGemmAvx2, ppc::core::kGemmAvx512}) {
+    if (isa <= ppc::core::GemmSupportedIsa()) {
+      isas.push_back(isa);
+    }
+  }
+  return isas;
+}
+
+// Small integer-valued inputs keep every type exact, so results compare with ==
+template <class T>
+void CheckAgainstNaive(std::size_t m, std::size_t n, std::size_t k, T alpha, T beta,
+                       const ppc::core::GemmConfig &config) {
+  const std::size_t lda = k + 3;
+  const std::size_t ldb = n + 1;
+  const std::size_t ldc = n + 2;
+  auto a = RandomMatrix<T>(m * lda, 1);
+  auto b = RandomMatrix<T>(k * ldb, 2);
+  auto c = RandomMatrix<T>(m * ldc, 3);
+  auto expected = c;
+  NaiveGemm(m, n, k, alpha, a.data(), lda, b.data(), ldb, beta, expected.data(), ldc);
+  ppc::core::Gemm<T>(m, n, k, alpha, a.data(), lda, b.data(), ldb, beta, c.data(), ldc, config);
+  for (std::size_t i = 0; i < m; i++) {
+    for (std::size_t j = 0; j < ldc; j++) {
+      // Columns past n belong to the caller and stay untouched
+      ASSERT_EQ(c[(i * ldc) + j], expected[(i * ldc) + j])
+          << "isa " << static_cast<int>(config.isa) << " at (" << i << ", " << j << ")";
+    }
+  }
+}
+
+template <class T>
+void CheckAllShapes() {
+  for (auto isa : SupportedIsas()) {
+    // Default blocking, and small blocks so that every loop of the nest runs several times
+    // with partial tiles at the edges
+    CheckAgainstNaive<T>(37, 29, 53, T{1}, T{0}, {.isa = isa});
+    CheckAgainstNaive<T>(37, 29, 53, T{2}, T{3}, {.isa = isa});
+    CheckAgainstNaive<T>(67, 71, 45, T{1}, T{1}, {.isa = isa, .mc = 20, .kc = 16, .nc = 40});
+    CheckAgainstNaive<T>(1, 1, 1, T{1}, T{0}, {.isa = isa});
+    CheckAgainstNaive<T>(5, 3, 0, T{1}, T{2}, {.isa = isa});
+  }
+}
+
+// Gemm against the kernels the tasks used before it, on one n x n product
+template <class T>
+void CheckAgainstTaskKernels(std::size_t n) {
+  auto a = RandomMatrix<T>(n * n, 4);
+  auto b = RandomMatrix<T>(n * n, 5);
+  std::vector<T> c_naive(n * n);
+  std::vector<T> c_blocked(n * n);
+  std::vector<T> c_gemm(n * n);
+  NaiveGemm<T>(n, n, n, T{1}, a.data(), n, b.data(), n, T{}, c_naive.data(), n);
+  BlockedNaiveGemm<T>(n, n / 8, a.data(), b.data(), c_blocked.data());
+  ppc::core::Gemm<T>(n, n, n, 1, a.data(), n, b.data(), n, 0, c_gemm.data(), n);
+  EXPECT_EQ(c_gemm, c_naive);
+  EXPECT_EQ(c_gemm, c_blocked);
+}
+
+}  // namespace
+
+TEST(gemm_tests, matches_naive_double) { CheckAllShapes<double>(); }
+
+TEST(gemm_tests, matches_naive_float) { CheckAllShapes<float>(); }
+
+TEST(gemm_tests, matches_naive_int) { CheckAllShapes<int>(); }
+
+TEST(gemm_tests, matches_naive_complex) { CheckAllShapes<std::complex<double>>(); }
+
+TEST(gemm_tests, beta_zero_ignores_c) {
+  std::vector<double> a = {1, 2, 3, 4};
+  std::vector<double> b = {5, 6, 7, 8};
+  std::vector<double> c(4, std::numeric_limits<double>::quiet_NaN());
+  ppc::core::Gemm<double>(2, 2, 2, 1.0, a.data(), 2, b.data(), 2, 0.0, c.data(), 2);
+  EXPECT_EQ(c, (std::vector<double>{19, 22, 43, 50}));
+}
+
+TEST(gemm_tests, throws_on_short_leading_dimension) {
+  std::vector<double> matrix(16);
+  EXPECT_THROW(ppc::core::Gemm<double>(2, 4, 4, 1.0, matrix.data(), 3, matrix.data(), 4, 0.0, matrix.data(), 4),
+               std::invalid_argument);
+  EXPECT_THROW(ppc::core::Gemm<double>(2, 4, 4, 1.0, matrix.data(), 4, matrix.data(), 4, 0.0, matrix.data(), 2),
+               std::invalid_argument);
+}
+
+TEST(gemm_tests, row_blocks_in_parallel) {
+  constexpr std::size_t kN = 150;
+  auto a = RandomMatrix<double>(kN * kN, 6);
+  auto b = RandomMatrix<double>(kN * kN, 7);
+  std::vector<double> expected(kN * kN);
+  ppc::core::Gemm<double>(kN, kN, kN, 1.0, a.data(), kN, b.data(), kN, 0.0, expected.data(), kN);
+
+  std::vector<double> c(kN * kN);
+  ppc::core::ThreadPool pool(4);
+  pool.ParallelFor(
+      0, kN,
+      [&](int64_t begin, int64_t end) {
+        const auto row = static_cast<std::size_t>(begin);
+        ppc::core::Gemm<double>(end - begin, kN, kN, 1.0, a.data() + (row * kN), kN, b.data(), kN, 0.0,
+                                c.data() + (row * kN), kN);
+      },
+      ppc::core::ThreadPool::kDynamic, 7);
+  EXPECT_EQ(c, expected);
+}
+
+TEST(gemm_tests, agrees_with_task_kernels) {
+  CheckAgainstTaskKernels<double>(256);
+  CheckAgainstTaskKernels<float>(256);
+  CheckAgainstTaskKernels<int>(256);
+  CheckAgainstTaskKernels<std::complex<double>>(128);
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "core/gemm/include/gemm.hpp"
+#include "core/gemm/include/strassen.hpp"
+#include "core/task/include/memory_profile.hpp"
+
+namespace {
+
+std::vector<double> RandomMatrix(std::size_t size, uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-4, 4);
+  std::vector<double> matrix(size);
+  for (auto &value : matrix) {
+    value = dist(gen);
+  }
+  return matrix;
+}
+
+// Integer-valued inputs keep Strassen exact, so results compare with ==
+void CheckAgainstGemm(std::size_t m, std::size_t n, std::size_t k, const ppc::core::StrassenConfig &config) {
+  const std::size_t lda = k + 1;
+  const std::size_t ldc = n + 3;
+  auto a = RandomMatrix(m * lda, 1);
+  auto b = RandomMatrix(k * n, 2);
+  std::vector<double> expected(m * ldc, -1.0);
+  auto c = expected;
+  ppc::core::Gemm<double>(m, n, k, 1.0, a.data(), lda, b.data(), n, 0.0, expected.data(), ldc);
+
+  ppc::core::StrassenEngine<double> engine(config);
+  engine.Multiply(m, n, k, a.data(), lda, b.data(), n, c.data(), ldc);
+  EXPECT_EQ(c, expected) << m << " x " << k << " x " << n;
+}
+
+// Runs the bodies on their own threads
+void ThreadFork(int count, const std::function<void(int)> &body) {
+  std::vector<std::thread> threads;
+  for (int i = 0; i < count; i++) {
+    threads.emplace_back(body, i);
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+}
+
+}  // namespace
+
+TEST(strassen_tests, matches_gemm_on_power_of_two) {
+  CheckAgainstGemm(64, 64, 64, ppc::core::StrassenConfigWithCutoff(8));
+  EXPECT_EQ(ppc::core::StrassenEngine<double>(ppc::core::StrassenConfigWithCutoff(8)).Depth(64, 64, 64), 3);
+}
+
+TEST(strassen_tests, pads_other_sizes) {
+  CheckAgainstGemm(50, 45, 37, ppc::core::StrassenConfigWithCutoff(8));
+  CheckAgainstGemm(33, 33, 33, ppc::core::StrassenConfigWithCutoff(16));
+  CheckAgainstGemm(1, 1, 1, ppc::core::StrassenConfigWithCutoff(8));
+}
+
+TEST(strassen_tests, rectangular) {
+  CheckAgainstGemm(96, 40, 72, ppc::core::StrassenConfigWithCutoff(8));
+  CheckAgainstGemm(3, 100, 100, ppc::core::StrassenConfigWithCutoff(8));
+}
+
+TEST(strassen_tests, parallel_levels) {
+  auto config = ppc::core::StrassenConfigWithCutoff(8);
+  config.fork = ThreadFork;
+  config.parallel_depth = 2;
+  CheckAgainstGemm(64, 64, 64, config);
+  CheckAgainstGemm(70, 58, 66, config);
+}
+
+TEST(strassen_tests, shallow_leaves_split_into_row_bands) {
+  std::atomic<int> bodies = 0;
+  auto config = ppc::core::StrassenConfigWithCutoff(128);
+  config.fork = [&](int count, const std::function<void(int)> &body) {
+    bodies += count;
+    ThreadFork(count, body);
+  };
+  // No Strassen level at all: the single Gemm is the parallel work
+  CheckAgainstGemm(100, 90, 110, config);
+  EXPECT_EQ(bodies, 7);
+
+  // One level of two parallel ones: every 32-row product leaf is split in two
+  bodies = 0;
+  config.cutoff = 32;
+  config.parallel_depth = 2;
+  CheckAgainstGemm(64, 64, 64, config);
+  EXPECT_EQ(bodies, 7 + 4 + (7 * 2));
+}
+
+TEST(strassen_tests, reserved_workspace_is_reused) {
+  constexpr std::size_t kN = 96;
+  auto a = RandomMatrix(kN * kN, 3);
+  auto b = RandomMatrix(kN * kN, 4);
+  std::vector<double> c(kN * kN);
+  ppc::core::StrassenEngine<double> engine(ppc::core::StrassenConfigWithCutoff(10));
+  engine.Reserve(kN, kN, kN);
+  // The first call also sizes the per-thread Gemm packing buffers
+  engine.Multiply(kN, kN, kN, a.data(), kN, b.data(), kN, c.data(), kN);
+
+  ppc::core::MemoryProfiler::SetEnabled(true);
+  const auto before = ppc::core::MemoryProfiler::Snapshot();
+  engine.Multiply(kN, kN, kN, a.data(), kN, b.data(), kN, c.data(), kN);
+  const auto after = ppc::core::MemoryProfiler::Snapshot();
+  ppc::core::MemoryProfiler::SetEnabled(false);
+  EXPECT_EQ(after.allocations, before.allocations);
+}
+
+TEST(strassen_tests, measured_cutoff_is_a_power_of_two) {
+  // TunedCutoff measures 64 ... 512; a small range keeps the test cheap under valgrind
+  const std::size_t cutoff = ppc::core::StrassenEngine<double>::MeasureCutoff(4, 16);
+  EXPECT_GE(cutoff, 4U);
+  EXPECT_LE(cutoff, 32U);
+  EXPECT_EQ(cutoff & (cutoff - 1), 0U);
+}
+
+TEST(strassen_tests, default_cutoff_is_fixed) {
+  EXPECT_EQ(ppc::core::StrassenEngine<double>().Cutoff(), ppc::core::kStrassenDefaultCutoff);
+}
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+namespace ppc::core {
+
+namespace detail {
+
+// Allocator for storage whose first element starts on a cache line
+template <class T>
+struct CacheAlignedAllocator {
+  using value_type = T;
+  static constexpr std::size_t kAlignment = 64;
+
+  CacheAlignedAllocator() = default;
+  template <class U>
+  explicit CacheAlignedAllocator(const CacheAlignedAllocator<U> & /*other*/) {}
+
+  T *allocate(std::size_t count) {
+    if (count > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+      throw std::bad_array_new_length();
+    }
+    return static_cast<T *>(::operator new(count * sizeof(T), std::align_val_t{kAlignment}));
+  }
+  void deallocate(T *pointer, std::size_t /*count*/) { ::operator delete(pointer, std::align_val_t{kAlignment}); }
+
+  template <class U>
+  bool operator==(const CacheAlignedAllocator<U> & /*other*/) const {
+    return true;
+  }
+};
+
+}  // namespace detail
+
+// Matrix stored tile by tile: each block_size x block_size tile is a contiguous row-major
+// array with leading dimension block_size, starting on a cache line. Tiles are laid out in
+// block-row-major order, so a block row of the matrix is one contiguous range.
+// Rows and columns are padded with zeros up to whole tiles.
+template <class T>
+class BlockedMatrix {
+ public:
+  // Tile (row, col) of the block grid
+  template <class Value>
+  struct BlockView {
+    std::size_t row;
+    std::size_t col;
+    Value *data;
+  };
+
+  template <class Value>
+  class BlockIterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = BlockView<Value>;
+    using difference_type = std::ptrdiff_t;
+
+    BlockIterator() = default;
+    BlockIterator(Value *base, std::size_t index, std::size_t grid_cols, std::size_t tile_stride)
+        : base_(base), index_(index), grid_cols_(grid_cols), tile_stride_(tile_stride) {}
+
+    value_type operator*() const {
+      return {.row = index_ / grid_cols_, .col = index_ % grid_cols_, .data = base_ + (index_ * tile_stride_)};
+    }
+    BlockIterator &operator++() {
+      index_++;
+      return *this;
+    }
+    BlockIterator operator++(int) {
+      auto copy = *this;
+      index_++;
+      return copy;
+    }
+    bool operator==(const BlockIterator &other) const { return index_ == other.index_; }
+
+   private:
+    Value *base_ = nullptr;
+    std::size_t index_ = 0;
+    std::size_t grid_cols_ = 1;
+    std::size_t tile_stride_ = 0;
+  };
+
+  using Block = BlockView<T>;
+  using ConstBlock = BlockView<const T>;
+  using iterator = BlockIterator<T>;
+  using const_iterator = BlockIterator<const T>;
+
+  BlockedMatrix() = default;
+  BlockedMatrix(std::size_t rows, std::size_t cols, std::size_t block_size) { Resize(rows, cols, block_size); }
+
+  // Tiles a row-major rows x cols matrix with leading dimension ld
+  static BlockedMatrix FromRowMajor(const T *src, std::size_t rows, std::size_t cols, std::size_t ld,
+                                    std::size_t block_size) {
+    BlockedMatrix matrix(rows, cols, block_size);
+    matrix.Load(src, ld);
+    return matrix;
+  }
+
+  // Changes the shape, reusing the storage when it is large enough; all values become zero
+  void Resize(std::size_t rows, std::size_t cols, std::size_t block_size) {
+    if (block_size == 0) {
+      throw std::invalid_argument("BlockedMatrix: block size must be positive");
+    }
+    rows_ = rows;
+    cols_ = cols;
+    block_size_ = block_size;
+    grid_rows_ = (rows + block_size - 1) / block_size;
+    grid_cols_ = (cols + block_size - 1) / block_size;
+    constexpr std::size_t kLine = detail::CacheAlignedAllocator<T>::kAlignment;
+    const std::size_t per_line = sizeof(T) < kLine ? kLine / sizeof(T) : 1;
+    tile_stride_ = ((block_size * block_size + per_line - 1) / per_line) * per_line;
+    data_.assign(grid_rows_ * grid_cols_ * tile_stride_, T{});
+  }
+
+  void Fill(const T &value) { std::fill(data_.begin(), data_.end(), value); }
+
+  // Copies block row bi in from / out to a row-major matrix with leading dimension ld, whose
+  // element (0, 0) is at matrix. Padding stays zero and is never written out. Block rows are
+  // independent, so callers may convert them in parallel.
+  void LoadBlockRow(std::size_t bi, const T *matrix, std::size_t ld) {
+    const std::size_t height = std::min(block_size_, rows_ - (bi * block_size_));
+    for (std::size_t bj = 0; bj < grid_cols_; bj++) {
+      const std::size_t width = std::min(block_size_, cols_ - (bj * block_size_));
+      T *tile = Tile(bi, bj);
+      for (std::size_t i = 0; i < height; i++) {
+        const T *row = matrix + (((bi * block_size_) + i) * ld) + (bj * block_size_);
+        std::copy(row, row + width, tile + (i * block_size_));
+      }
+    }
+  }
+  void StoreBlockRow(std::size_t bi, T *matrix, std::size_t ld) const {
+    const std::size_t height = std::min(block_size_, rows_ - (bi * block_size_));
+    for (std::size_t bj = 0; bj < grid_cols_; bj++) {
+      const std::size_t width = std::min(block_size_, cols_ - (bj * block_size_));
+      const T *tile = Tile(bi, bj);
+      for (std::size_t i = 0; i < height; i++) {
+        std::copy(tile + (i * block_size_), tile + (i * block_size_) + width,
+                  matrix + (((bi * block_size_) + i) * ld) + (bj * block_size_));
+      }
+    }
+  }
+  void Load(const T *matrix, std::size_t ld) {
+    for (std::size_t bi = 0; bi < grid_rows_; bi++) {
+      LoadBlockRow(bi, matrix, ld);
+    }
+  }
+  void Store(T *matrix, std::size_t ld) const {
+    for (std::size_t bi = 0; bi < grid_rows_; bi++) {
+      StoreBlockRow(bi, matrix, ld);
+    }
+  }
+
+  [[nodiscard]] std::vector<T> ToRowMajor() const {
+    std::vector<T> matrix(rows_ * cols_);
+    Store(matrix.data(), cols_);
+    return matrix;
+  }
+
+  // First element of tile (bi, bj); its leading dimension is BlockSize()
+  T *Tile(std::size_t bi, std::size_t bj) { return data_.data() + (((bi * grid_cols_) + bj) * tile_stride_); }
+  const T *Tile(std::size_t bi, std::size_t bj) const {
+    return data_.data() + (((bi * grid_cols_) + bj) * tile_stride_);
+  }
+
+  T &operator()(std::size_t i, std::size_t j) {
+    return Tile(i / block_size_, j / block_size_)[((i % block_size_) * block_size_) + (j % block_size_)];
+  }
+  const T &operator()(std::size_t i, std::size_t j) const {
+    return Tile(i / block_size_, j / block_size_)[((i % block_size_) * block_size_) + (j % block_size_)];
+  }
+
+  // Tiles in storage order
+  iterator begin() { return {data_.data(), 0, grid_cols_, tile_stride_}; }
+  iterator end() { return {data_.data(), grid_rows_ * grid_cols_, grid_cols_, tile_stride_}; }
+  const_iterator begin() const { return {data_.data(), 0, grid_cols_, tile_stride_}; }
+  const_iterator end() const { return {data_.data(), grid_rows_ * grid_cols_, grid_cols_, tile_stride_}; }
+
+  [[nodiscard]] std::size_t Rows() const { return rows_; }
+  [[nodiscard]] std::size_t Cols() const { return cols_; }
+  [[nodiscard]] std::size_t BlockSize() const { return block_size_; }
+  [[nodiscard]] std::size_t GridRows() const { return grid_rows_; }
+  [[nodiscard]] std::size_t GridCols() const { return grid_cols_; }
+
+ private:
+  std::size_t rows_ = 0;
+  std::size_t cols_ = 0;
+  std::size_t block_size_ = 1;
+  std::size_t grid_rows_ = 0;
+  std::size_t grid_cols_ = 0;
+  // distance between consecutive tiles, block_size^2 rounded up to whole cache lines
+  std::size_t tile_stride_ = 0;
+  std::vector<T, detail::CacheAlignedAllocator<T>> data_;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,505 @@
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+// SIMD micro-kernels are compiled with per-function target attributes and picked at run time,
+// so they do not depend on -march
+#define PPC_GEMM_X86_DISPATCH
+#define PPC_GEMM_TARGET(isa) __attribute__((target(isa)))
+#define PPC_GEMM_ALWAYS_INLINE __attribute__((always_inline))
+#else
+#define PPC_GEMM_ALWAYS_INLINE
+#endif
+
+namespace ppc::core {
+
+// Instruction sets of the micro-kernels, in increasing order
+enum GemmIsa : uint8_t { kGemmGeneric, kGemmAvx2, kGemmAvx512 };
+
+struct GemmConfig {
+  // highest instruction set to use, lowered to what the CPU supports
+  GemmIsa isa = kGemmAvx512;
+  // cache blocking: mc x kc panels of A, kc x nc panels of B; 0 - derived from the cache
+  // sizes and the micro-kernel shape
+  std::size_t mc = 0;
+  std::size_t kc = 0;
+  std::size_t nc = 0;
+};
+
+// Highest instruction set the micro-kernels can use on this CPU
+GemmIsa GemmSupportedIsa();
+
+// C = alpha * A * B + beta * C for row-major A (m x k), B (k x n) and C (m x n) with leading
+// dimensions lda, ldb, ldc. A and B are packed into cache-sized panels and multiplied by a
+// register-tiled micro-kernel (BLIS-style loop nest). beta == 0 overwrites C without reading it.
+// The call is sequential; packing buffers are per thread, so disjoint blocks of C may be
+// computed concurrently - e.g. row ranges with a + row * lda and c + row * ldc
+template <class T>
+void Gemm(std::size_t m, std::size_t n, std::size_t k, std::type_identity_t<T> alpha, const T *a, std::size_t lda,
+          const T *b, std::size_t ldb, std::type_identity_t<T> beta, T *c, std::size_t ldc,
+          const GemmConfig &config = {});
+
+namespace detail {
+
+// Conservative per-core cache sizes used for the default blocking
+constexpr std::size_t kGemmL1Bytes = std::size_t{32} << 10;
+constexpr std::size_t kGemmL2Bytes = std::size_t{512} << 10;
+constexpr std::size_t kGemmL3Bytes = std::size_t{4} << 20;
+
+template <class T>
+PPC_GEMM_ALWAYS_INLINE inline void MulAdd(T &acc, T a, T b) {
+  acc += a * b;
+}
+
+// Plain formula instead of operator*, which handles inf/nan through a library call
+PPC_GEMM_ALWAYS_INLINE inline void MulAdd(std::complex<double> &acc, std::complex<double> a,
+                                          std::complex<double> b) {
+  acc = {acc.real() + (a.real() * b.real()) - (a.imag() * b.imag()),
+         acc.imag() + (a.real() * b.imag()) + (a.imag() * b.real())};
+}
+
+// C[kMr x kNr] += A panel * B panel, where the A panel holds kMr values per k and the B panel
+// kNr values per k. Written for the compiler to vectorize over the columns
+template <class T, std::size_t kMr, std::size_t kNr>
+PPC_GEMM_ALWAYS_INLINE inline void PortableTile(std::size_t kc, const T *a, const T *b, T *c, std::size_t ldc) {
+  T acc[kMr][kNr] = {};
+  for (std::size_t p = 0; p < kc; p++) {
+    for (std::size_t i = 0; i < kMr; i++) {
+      const T a_value = a[i];
+      for (std::size_t j = 0; j < kNr; j++) {
+        MulAdd(acc[i][j], a_value, b[j]);
+      }
+    }
+    a += kMr;
+    b += kNr;
+  }
+  for (std::size_t i = 0; i < kMr; i++) {
+    for (std::size_t j = 0; j < kNr; j++) {
+      c[(i * ldc) + j] += acc[i][j];
+    }
+  }
+}
+
+template <class T, std::size_t kMr, std::size_t kNr>
+void GenericTile(std::size_t kc, const T *a, const T *b, T *c, std::size_t ldc) {
+  PortableTile<T, kMr, kNr>(kc, a, b, c, ldc);
+}
+
+// Micro-kernel of an instruction set: tile shape and Run(kc, a_panel, b_panel, c, ldc)
+template <class T, GemmIsa kIsa>
+struct GemmKernel {
+  static constexpr std::size_t kMr = 4;
+  static constexpr std::size_t kNr = 4;
+  static void Run(std::size_t kc, const T *a, const T *b, T *c, std::size_t ldc) {
+    GenericTile<T, kMr, kNr>(kc, a, b, c, ldc);
+  }
+};
+
+#ifdef PPC_GEMM_X86_DISPATCH
+
+template <class T, std::size_t kMr, std::size_t kNr>
+PPC_GEMM_TARGET("avx2,fma")
+void Avx2Tile(std::size_t kc, const T *a, const T *b, T *c, std::size_t ldc) {
+  PortableTile<T, kMr, kNr>(kc, a, b, c, ldc);
+}
+
+// 6 x 8: twelve ymm accumulators, two B vectors and a broadcast
+PPC_GEMM_TARGET("avx2,fma")
+inline void Avx2TileF64(std::size_t kc, const double *a, const double *b, double *c, std::size_t ldc) {
+  __m256d acc[6][2];
+  for (auto &row : acc) {
+    row[0] = _mm256_setzero_pd();
+    row[1] = _mm256_setzero_pd();
+  }
+  for (std::size_t p = 0; p < kc; p++) {
+    const __m256d b0 = _mm256_loadu_pd(b);
+    const __m256d b1 = _mm256_loadu_pd(b + 4);
+    for (std::size_t i = 0; i < 6; i++) {
+      const __m256d a_value = _mm256_broadcast_sd(a + i);
+      acc[i][0] = _mm256_fmadd_pd(a_value, b0, acc[i][0]);
+      acc[i][1] = _mm256_fmadd_pd(a_value, b1, acc[i][1]);
+    }
+    a += 6;
+    b += 8;
+  }
+  for (std::size_t i = 0; i < 6; i++) {
+    double *row = c + (i * ldc);
+    _mm256_storeu_pd(row, _mm256_add_pd(_mm256_loadu_pd(row), acc[i][0]));
+    _mm256_storeu_pd(row + 4, _mm256_add_pd(_mm256_loadu_pd(row + 4), acc[i][1]));
+  }
+}
+
+// 6 x 16
+PPC_GEMM_TARGET("avx2,fma")
+inline void Avx2TileF32(std::size_t kc, const float *a, const float *b, float *c, std::size_t ldc) {
+  __m256 acc[6][2];
+  for (auto &row : acc) {
+    row[0] = _mm256_setzero_ps();
+    row[1] = _mm256_setzero_ps();
+  }
+  for (std::size_t p = 0; p < kc; p++) {
+    const __m256 b0 = _mm256_loadu_ps(b);
+    const __m256 b1 = _mm256_loadu_ps(b + 8);
+    for (std::size_t i = 0; i < 6; i++) {
+      const __m256 a_value = _mm256_broadcast_ss(a + i);
+      acc[i][0] = _mm256_fmadd_ps(a_value, b0, acc[i][0]);
+      acc[i][1] = _mm256_fmadd_ps(a_value, b1, acc[i][1]);
+    }
+    a += 6;
+    b += 16;
+  }
+  for (std::size_t i = 0; i < 6; i++) {
+    float *row = c + (i * ldc);
+    _mm256_storeu_ps(row, _mm256_add_ps(_mm256_loadu_ps(row), acc[i][0]));
+    _mm256_storeu_ps(row + 8, _mm256_add_ps(_mm256_loadu_ps(row + 8), acc[i][1]));
+  }
+}
+
+// 12 x 16: twenty-four zmm accumulators
+PPC_GEMM_TARGET("avx512f")
+inline void Avx512TileF64(std::size_t kc, const double *a, const double *b, double *c, std::size_t ldc) {
+  __m512d acc[12][2];
+  for (auto &row : acc) {
+    row[0] = _mm512_setzero_pd();
+    row[1] = _mm512_setzero_pd();
+  }
+  for (std::size_t p = 0; p < kc; p++) {
+    const __m512d b0 = _mm512_loadu_pd(b);
+    const __m512d b1 = _mm512_loadu_pd(b + 8);
+    for (std::size_t i = 0; i < 12; i++) {
+      const __m512d a_value = _mm512_set1_pd(a[i]);
+      acc[i][0] = _mm512_fmadd_pd(a_value, b0, acc[i][0]);
+      acc[i][1] = _mm512_fmadd_pd(a_value, b1, acc[i][1]);
+    }
+    a += 12;
+    b += 16;
+  }
+  for (std::size_t i = 0; i < 12; i++) {
+    double *row = c + (i * ldc);
+    _mm512_storeu_pd(row, _mm512_add_pd(_mm512_loadu_pd(row), acc[i][0]));
+    _mm512_storeu_pd(row + 8, _mm512_add_pd(_mm512_loadu_pd(row + 8), acc[i][1]));
+  }
+}
+
+// 12 x 32
+PPC_GEMM_TARGET("avx512f")
+inline void Avx512TileF32(std::size_t kc, const float *a, const float *b, float *c, std::size_t ldc) {
+  __m512 acc[12][2];
+  for (auto &row : acc) {
+    row[0] = _mm512_setzero_ps();
+    row[1] = _mm512_setzero_ps();
+  }
+  for (std::size_t p = 0; p < kc; p++) {
+    const __m512 b0 = _mm512_loadu_ps(b);
+    const __m512 b1 = _mm512_loadu_ps(b + 16);
+    for (std::size_t i = 0; i < 12; i++) {
+      const __m512 a_value = _mm512_set1_ps(a[i]);
+      acc[i][0] = _mm512_fmadd_ps(a_value, b0, acc[i][0]);
+      acc[i][1] = _mm512_fmadd_ps(a_value, b1, acc[i][1]);
+    }
+    a += 12;
+    b += 32;
+  }
+  for (std::size_t i = 0; i < 12; i++) {
+    float *row = c + (i * ldc);
+    _mm512_storeu_ps(row, _mm512_add_ps(_mm512_loadu_ps(row), acc[i][0]));
+    _mm512_storeu_ps(row + 16, _mm512_add_ps(_mm512_loadu_ps(row + 16), acc[i][1]));
+  }
+}
+
+// 6 x 16 int32; mullo keeps the low 32 bits of each product
+PPC_GEMM_TARGET("avx2")
+inline void Avx2TileI32(std::size_t kc, const int *a, const int *b, int *c, std::size_t ldc) {
+  __m256i acc[6][2];
+  for (auto &row : acc) {
+    row[0] = _mm256_setzero_si256();
+    row[1] = _mm256_setzero_si256();
+  }
+  for (std::size_t p = 0; p < kc; p++) {
+    const __m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b));
+    const __m256i b1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + 8));
+    for (std::size_t i = 0; i < 6; i++) {
+      const __m256i a_value = _mm256_set1_epi32(a[i]);
+      acc[i][0] = _mm256_add_epi32(acc[i][0], _mm256_mullo_epi32(a_value, b0));
+      acc[i][1] = _mm256_add_epi32(acc[i][1], _mm256_mullo_epi32(a_value, b1));
+    }
+    a += 6;
+    b += 16;
+  }
+  for (std::size_t i = 0; i < 6; i++) {
+    auto *row = reinterpret_cast<__m256i *>(c + (i * ldc));
+    _mm256_storeu_si256(row, _mm256_add_epi32(_mm256_loadu_si256(row), acc[i][0]));
+    _mm256_storeu_si256(row + 1, _mm256_add_epi32(_mm256_loadu_si256(row + 1), acc[i][1]));
+  }
+}
+
+// 12 x 32 int32
+PPC_GEMM_TARGET("avx512f")
+inline void Avx512TileI32(std::size_t kc, const int *a, const int *b, int *c, std::size_t ldc) {
+  __m512i acc[12][2];
+  for (auto &row : acc) {
+    row[0] = _mm512_setzero_si512();
+    row[1] = _mm512_setzero_si512();
+  }
+  for (std::size_t p = 0; p < kc; p++) {
+    const __m512i b0 = _mm512_loadu_si512(b);
+    const __m512i b1 = _mm512_loadu_si512(b + 16);
+    for (std::size_t i = 0; i < 12; i++) {
+      const __m512i a_value = _mm512_set1_epi32(a[i]);
+      acc[i][0] = _mm512_add_epi32(acc[i][0], _mm512_mullo_epi32(a_value, b0));
+      acc[i][1] = _mm512_add_epi32(acc[i][1], _mm512_mullo_epi32(a_value, b1));
+    }
+    a += 12;
+    b += 32;
+  }
+  for (std::size_t i = 0; i < 12; i++) {
+    int *row = c + (i * ldc);
+    _mm512_storeu_si512(row, _mm512_add_epi32(_mm512_loadu_si512(row), acc[i][0]));
+    _mm512_storeu_si512(row + 16, _mm512_add_epi32(_mm512_loadu_si512(row + 16), acc[i][1]));
+  }
+}
+
+template <>
+struct GemmKernel<double, kGemmAvx2> {
+  static constexpr std::size_t kMr = 6;
+  static constexpr std::size_t kNr = 8;
+  static void Run(std::size_t kc, const double *a, const double *b, double *c, std::size_t ldc) {
+    Avx2TileF64(kc, a, b, c, ldc);
+  }
+};
+
+template <>
+struct GemmKernel<float, kGemmAvx2> {
+  static constexpr std::size_t kMr = 6;
+  static constexpr std::size_t kNr = 16;
+  static void Run(std::size_t kc, const float *a, const float *b, float *c, std::size_t ldc) {
+    Avx2TileF32(kc, a, b, c, ldc);
+  }
+};
+
+template <>
+struct GemmKernel<int, kGemmAvx2> {
+  static constexpr std::size_t kMr = 6;
+  static constexpr std::size_t kNr = 16;
+  static void Run(std::size_t kc, const int *a, const int *b, int *c, std::size_t ldc) {
+    Avx2TileI32(kc, a, b, c, ldc);
+  }
+};
+
+template <>
+struct GemmKernel<std::complex<double>, kGemmAvx2> {
+  static constexpr std::size_t kMr = 3;
+  static constexpr std::size_t kNr = 4;
+  static void Run(std::size_t kc, const std::complex<double> *a, const std::complex<double> *b,
+                  std::complex<double> *c, std::size_t ldc) {
+    Avx2Tile<std::complex<double>, kMr, kNr>(kc, a, b, c, ldc);
+  }
+};
+
+template <>
+struct GemmKernel<double, kGemmAvx512> {
+  static constexpr std::size_t kMr = 12;
+  static constexpr std::size_t kNr = 16;
+  static void Run(std::size_t kc, const double *a, const double *b, double *c, std::size_t ldc) {
+    Avx512TileF64(kc, a, b, c, ldc);
+  }
+};
+
+template <>
+struct GemmKernel<float, kGemmAvx512> {
+  static constexpr std::size_t kMr = 12;
+  static constexpr std::size_t kNr = 32;
+  static void Run(std::size_t kc, const float *a, const float *b, float *c, std::size_t ldc) {
+    Avx512TileF32(kc, a, b, c, ldc);
+  }
+};
+
+template <>
+struct GemmKernel<int, kGemmAvx512> {
+  static constexpr std::size_t kMr = 12;
+  static constexpr std::size_t kNr = 32;
+  static void Run(std::size_t kc, const int *a, const int *b, int *c, std::size_t ldc) {
+    Avx512TileI32(kc, a, b, c, ldc);
+  }
+};
+
+// The complex tile gains nothing from wider registers here
+template <>
+struct GemmKernel<std::complex<double>, kGemmAvx512> : GemmKernel<std::complex<double>, kGemmAvx2> {};
+
+#endif
+
+inline GemmIsa DetectGemmIsa() {
+#ifdef PPC_GEMM_X86_DISPATCH
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") != 0) {
+    return kGemmAvx512;
+  }
+  if (__builtin_cpu_supports("avx2") != 0 && __builtin_cpu_supports("fma") != 0) {
+    return kGemmAvx2;
+  }
+#endif
+  return kGemmGeneric;
+}
+
+inline std::size_t RoundDown(std::size_t value, std::size_t multiple) {
+  return std::max(value / multiple, std::size_t{1}) * multiple;
+}
+
+// A kc x kNr panel of B stays in half of L1, an mc x kc panel of A in half of L2 and a
+// kc x nc panel of B in half of L3
+template <class T, class Kernel>
+GemmConfig ResolveBlocking(const GemmConfig &config) {
+  GemmConfig blocking = config;
+  if (blocking.kc == 0) {
+    blocking.kc = std::clamp<std::size_t>(RoundDown(kGemmL1Bytes / 2 / (Kernel::kNr * sizeof(T)), 8), 32, 512);
+  }
+  if (blocking.mc == 0) {
+    blocking.mc = RoundDown(kGemmL2Bytes / 2 / (blocking.kc * sizeof(T)), Kernel::kMr);
+  }
+  if (blocking.nc == 0) {
+    blocking.nc = std::min<std::size_t>(RoundDown(kGemmL3Bytes / 2 / (blocking.kc * sizeof(T)), Kernel::kNr), 4096);
+  }
+  return blocking;
+}
+
+// Micro-panels of kMr rows of alpha * A, kc values each, zero-padded to full panels
+template <class T, std::size_t kMr>
+void PackA(std::size_t mc, std::size_t kc, T alpha, const T *a, std::size_t lda, T *packed) {
+  for (std::size_t ir = 0; ir < mc; ir += kMr) {
+    const std::size_t rows = std::min(kMr, mc - ir);
+    for (std::size_t p = 0; p < kc; p++) {
+      for (std::size_t i = 0; i < rows; i++) {
+        packed[i] = alpha * a[((ir + i) * lda) + p];
+      }
+      std::fill(packed + rows, packed + kMr, T{});
+      packed += kMr;
+    }
+  }
+}
+
+// Micro-panels of kNr columns of B, kc rows each, zero-padded to full panels
+template <class T, std::size_t kNr>
+void PackB(std::size_t kc, std::size_t nc, const T *b, std::size_t ldb, T *packed) {
+  for (std::size_t jr = 0; jr < nc; jr += kNr) {
+    const std::size_t cols = std::min(kNr, nc - jr);
+    for (std::size_t p = 0; p < kc; p++) {
+      const T *row = b + (p * ldb) + jr;
+      std::copy(row, row + cols, packed);
+      std::fill(packed + cols, packed + kNr, T{});
+      packed += kNr;
+    }
+  }
+}
+
+template <class T>
+std::vector<T> &PackBuffer(int which) {
+  thread_local std::vector<T> buffers[2];
+  return buffers[which];
+}
+
+template <class T, GemmIsa kIsa>
+void GemmBlocked(std::size_t m, std::size_t n, std::size_t k, T alpha, const T *a, std::size_t lda, const T *b,
+                 std::size_t ldb, T *c, std::size_t ldc, const GemmConfig &config) {
+  using Kernel = GemmKernel<T, kIsa>;
+  constexpr std::size_t kMr = Kernel::kMr;
+  constexpr std::size_t kNr = Kernel::kNr;
+  const GemmConfig blocking = ResolveBlocking<T, Kernel>(config);
+
+  auto &packed_a = PackBuffer<T>(0);
+  auto &packed_b = PackBuffer<T>(1);
+  const std::size_t mc_max = std::min(blocking.mc, m);
+  const std::size_t kc_max = std::min(blocking.kc, k);
+  const std::size_t nc_max = std::min(blocking.nc, n);
+  packed_a.resize(std::max(packed_a.size(), ((mc_max + kMr - 1) / kMr) * kMr * kc_max));
+  packed_b.resize(std::max(packed_b.size(), ((nc_max + kNr - 1) / kNr) * kNr * kc_max));
+
+  T edge[kMr * kNr];
+  for (std::size_t jc = 0; jc < n; jc += blocking.nc) {
+    const std::size_t nc = std::min(blocking.nc, n - jc);
+    for (std::size_t pc = 0; pc < k; pc += blocking.kc) {
+      const std::size_t kc = std::min(blocking.kc, k - pc);
+      PackB<T, kNr>(kc, nc, b + (pc * ldb) + jc, ldb, packed_b.data());
+      for (std::size_t ic = 0; ic < m; ic += blocking.mc) {
+        const std::size_t mc = std::min(blocking.mc, m - ic);
+        PackA<T, kMr>(mc, kc, alpha, a + (ic * lda) + pc, lda, packed_a.data());
+        for (std::size_t jr = 0; jr < nc; jr += kNr) {
+          const T *panel_b = packed_b.data() + (jr * kc);
+          for (std::size_t ir = 0; ir < mc; ir += kMr) {
+            const T *panel_a = packed_a.data() + (ir * kc);
+            T *tile = c + ((ic + ir) * ldc) + jc + jr;
+            const std::size_t rows = std::min(kMr, mc - ir);
+            const std::size_t cols = std::min(kNr, nc - jr);
+            if (rows == kMr && cols == kNr) {
+              Kernel::Run(kc, panel_a, panel_b, tile, ldc);
+              continue;
+            }
+            // Partial tile at the bottom/right edge: full tile into a buffer, then the valid part
+            std::fill(edge, edge + (kMr * kNr), T{});
+            Kernel::Run(kc, panel_a, panel_b, edge, kNr);
+            for (std::size_t i = 0; i < rows; i++) {
+              for (std::size_t j = 0; j < cols; j++) {
+                tile[(i * ldc) + j] += edge[(i * kNr) + j];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+}  // namespace detail
+
+inline GemmIsa GemmSupportedIsa() {
+  static const GemmIsa kIsa = detail::DetectGemmIsa();
+  return kIsa;
+}
+
+template <class T>
+void Gemm(std::size_t m, std::size_t n, std::size_t k, std::type_identity_t<T> alpha, const T *a, std::size_t lda,
+          const T *b, std::size_t ldb, std::type_identity_t<T> beta, T *c, std::size_t ldc, const GemmConfig &config) {
+  static_assert(std::is_same_v<T, double> || std::is_same_v<T, float> || std::is_same_v<T, int> ||
+                    std::is_same_v<T, std::complex<double>>,
+                "Gemm: supported element types are double, float, int and std::complex<double>");
+  if (lda < k || ldb < n || ldc < n) {
+    throw std::invalid_argument("Gemm: leading dimension is smaller than the row length");
+  }
+  if (m == 0 || n == 0) {
+    return;
+  }
+  if (beta != T{1}) {
+    for (std::size_t i = 0; i < m; i++) {
+      T *row = c + (i * ldc);
+      if (beta == T{}) {
+        std::fill(row, row + n, T{});
+      } else {
+        std::transform(row, row + n, row, [beta](T value) { return beta * value; });
+      }
+    }
+  }
+  if (k == 0 || alpha == T{}) {
+    return;
+  }
+  switch (std::min(config.isa, GemmSupportedIsa())) {
+    case kGemmAvx512:
+      detail::GemmBlocked<T, kGemmAvx512>(m, n, k, alpha, a, lda, b, ldb, c, ldc, config);
+      break;
+    case kGemmAvx2:
+      detail::GemmBlocked<T, kGemmAvx2>(m, n, k, alpha, a, lda, b, ldb, c, ldc, config);
+      break;
+    case kGemmGeneric:
+      detail::GemmBlocked<T, kGemmGeneric>(m, n, k, alpha, a, lda, b, ldb, c, ldc, config);
+      break;
+  }
+}
+
+}  // namespace ppc::core
@@ -0,0 +1,339 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "core/gemm/include/gemm.hpp"
+
+namespace ppc::core {
+
+// Leaf size used unless a config sets its own; StrassenEngine<T>::TunedCutoff() measures one for this machine
+constexpr std::size_t kStrassenDefaultCutoff = 128;
+
+// Runs body(0), ..., body(count - 1), possibly concurrently, and returns when all have finished
+using StrassenFork = std::function<void(int count, const std::function<void(int)> &body)>;
+
+struct StrassenConfig {
+  // products with a dimension at or below the cutoff go to Gemm
+  std::size_t cutoff = kStrassenDefaultCutoff;
+  // top recursion levels whose seven products (and the four quadrant updates) go through fork.
+  // Each parallel level keeps the temporaries of all seven products alive at once. A Gemm leaf
+  // reached above this depth (cutoff >= size) is split into row bands through fork instead, as many
+  // as the skipped levels would have forked
+  int parallel_depth = 1;
+  // empty - everything runs on the calling thread
+  StrassenFork fork;
+  GemmConfig gemm;
+};
+
+// Default config with the given cutoff
+inline StrassenConfig StrassenConfigWithCutoff(std::size_t cutoff) {
+  StrassenConfig config;
+  config.cutoff = cutoff;
+  return config;
+}
+
+// Strassen's algorithm on strided views of row-major matrices. All temporaries - operand sums,
+// products of every level and the padded copies of non-divisible sizes - live in one workspace
+// arena, sized by Reserve for the recursion depth and reused by later calls
+template <class T>
+class StrassenEngine {
+ public:
+  explicit StrassenEngine(StrassenConfig config = {}) : config_(std::move(config)) {
+    config_.cutoff = std::max<std::size_t>(config_.cutoff, 1);
+    if (!config_.fork) {
+      config_.parallel_depth = 0;
+    }
+  }
+
+  // Grows the arena for an (m x k) * (k x n) product; Multiply of that shape then does not allocate
+  void Reserve(std::size_t m, std::size_t n, std::size_t k) {
+    const auto plan = MakePlan(m, n, k);
+    const std::size_t size = PaddingSize(plan, m, n, k) + WorkSize(plan.m, plan.n, plan.k, 0, plan.depth);
+    if (workspace_.size() < size) {
+      workspace_.resize(size);
+    }
+  }
+
+  // C = A * B for A (m x k), B (k x n), C (m x n) with leading dimensions lda, ldb, ldc
+  void Multiply(std::size_t m, std::size_t n, std::size_t k, const T *a, std::size_t lda, const T *b, std::size_t ldb,
+                T *c, std::size_t ldc) {
+    if (m == 0 || n == 0) {
+      return;
+    }
+    Reserve(m, n, k);
+    const auto plan = MakePlan(m, n, k);
+    T *work = workspace_.data();
+    if (plan.m == m && plan.n == n && plan.k == k) {
+      Recurse(m, n, k, a, lda, b, ldb, c, ldc, work, 0, plan.depth);
+      return;
+    }
+    // Zero padding to sizes divisible by 2^depth
+    T *padded_a = work;
+    T *padded_b = padded_a + (plan.m * plan.k);
+    T *padded_c = padded_b + (plan.k * plan.n);
+    Pad(m, k, a, lda, plan.m, plan.k, padded_a);
+    Pad(k, n, b, ldb, plan.k, plan.n, padded_b);
+    Recurse(plan.m, plan.n, plan.k, padded_a, plan.k, padded_b, plan.n, padded_c, plan.n,
+            padded_c + (plan.m * plan.n), 0, plan.depth);
+    for (std::size_t i = 0; i < m; i++) {
+      std::copy(padded_c + (i * plan.n), padded_c + (i * plan.n) + n, c + (i * ldc));
+    }
+  }
+
+  [[nodiscard]] std::size_t Cutoff() const { return config_.cutoff; }
+  // Recursion levels above the Gemm leaves for this shape
+  [[nodiscard]] int Depth(std::size_t m, std::size_t n, std::size_t k) const { return MakePlan(m, n, k).depth; }
+
+  // Smallest leaf size (64 ... 512) at which one Strassen level beats a single Gemm, measured once
+  // per process on this machine. Opt-in: the first call runs up to ~10 GFLOP and the result varies
+  // with machine load
+  static std::size_t TunedCutoff() {
+    static const std::size_t kCutoff = MeasureCutoff(64, 512);
+    return kCutoff;
+  }
+
+  // Smallest power of two in [min_cutoff, max_cutoff] whose one-level Strassen beats Gemm on a matrix
+  // of twice that size, 2 * max_cutoff if none does
+  static std::size_t MeasureCutoff(std::size_t min_cutoff, std::size_t max_cutoff) {
+    using Clock = std::chrono::steady_clock;
+    auto best_of_two = [](const auto &body) {
+      double best = std::numeric_limits<double>::max();
+      for (int run = 0; run < 2; run++) {
+        const auto begin = Clock::now();
+        body();
+        best = std::min(best, std::chrono::duration<double>(Clock::now() - begin).count());
+      }
+      return best;
+    };
+    for (std::size_t cutoff = min_cutoff; cutoff <= max_cutoff; cutoff *= 2) {
+      const std::size_t n = 2 * cutoff;
+      std::vector<T> a(n * n);
+      std::vector<T> b(n * n);
+      std::vector<T> c(n * n);
+      for (std::size_t i = 0; i < n * n; i++) {
+        a[i] = static_cast<T>(static_cast<int>(i % 7) - 3);
+        b[i] = static_cast<T>(static_cast<int>(i % 5) - 2);
+      }
+      const double gemm = best_of_two([&] { Gemm<T>(n, n, n, 1, a.data(), n, b.data(), n, 0, c.data(), n); });
+      StrassenConfig config;
+      config.cutoff = cutoff;
+      StrassenEngine engine(config);
+      engine.Reserve(n, n, n);
+      const double strassen = best_of_two([&] { engine.Multiply(n, n, n, a.data(), n, b.data(), n, c.data(), n); });
+      if (strassen < gemm) {
+        return cutoff;
+      }
+    }
+    return 2 * max_cutoff;
+  }
+
+ private:
+  struct Plan {
+    int depth = 0;
+    // dimensions padded to multiples of 2^depth
+    std::size_t m = 0;
+    std::size_t n = 0;
+    std::size_t k = 0;
+  };
+
+  // M1 = (A11 + A22)(B11 + B22), M2 = (A21 + A22) B11, M3 = A11 (B12 - B22), M4 = A22 (B21 - B11),
+  // M5 = (A11 + A12) B22, M6 = (A21 - A11)(B11 + B12), M7 = (A12 - A22)(B21 + B22).
+  // Quadrants are numbered 11, 12, 21, 22 -> 0, 1, 2, 3; second = -1 means a single quadrant
+  struct Operand {
+    int first;
+    int second;
+    int sign;
+  };
+  static constexpr std::array<Operand, 7> kLeft = {{{.first = 0, .second = 3, .sign = 1},
+                                                    {.first = 2, .second = 3, .sign = 1},
+                                                    {.first = 0, .second = -1, .sign = 1},
+                                                    {.first = 3, .second = -1, .sign = 1},
+                                                    {.first = 0, .second = 1, .sign = 1},
+                                                    {.first = 2, .second = 0, .sign = -1},
+                                                    {.first = 1, .second = 3, .sign = -1}}};
+  static constexpr std::array<Operand, 7> kRight = {{{.first = 0, .second = 3, .sign = 1},
+                                                     {.first = 0, .second = -1, .sign = 1},
+                                                     {.first = 1, .second = 3, .sign = -1},
+                                                     {.first = 2, .second = 0, .sign = -1},
+                                                     {.first = 3, .second = -1, .sign = 1},
+                                                     {.first = 0, .second = 1, .sign = 1},
+                                                     {.first = 2, .second = 3, .sign = 1}}};
+  // C11 = M1 + M4 - M5 + M7, C12 = M3 + M5, C21 = M2 + M4, C22 = M1 - M2 + M3 + M6
+  static constexpr std::array<std::array<int, 4>, 7> kCombine = {{{1, 0, 0, 1},
+                                                                  {0, 0, 1, -1},
+                                                                  {0, 1, 0, 1},
+                                                                  {1, 0, 1, 0},
+                                                                  {-1, 1, 0, 0},
+                                                                  {0, 0, 0, 1},
+                                                                  {1, 0, 0, 0}}};
+
+  // Halves while every dimension is above the cutoff
+  [[nodiscard]] Plan MakePlan(std::size_t m, std::size_t n, std::size_t k) const {
+    Plan plan;
+    std::size_t scale = 1;
+    while (std::min({m, n, k}) > config_.cutoff * scale) {
+      scale *= 2;
+      plan.depth++;
+    }
+    plan.m = (m + scale - 1) / scale * scale;
+    plan.n = (n + scale - 1) / scale * scale;
+    plan.k = (k + scale - 1) / scale * scale;
+    return plan;
+  }
+
+  static std::size_t PaddingSize(const Plan &plan, std::size_t m, std::size_t n, std::size_t k) {
+    if (plan.m == m && plan.n == n && plan.k == k) {
+      return 0;
+    }
+    return (plan.m * plan.k) + (plan.k * plan.n) + (plan.m * plan.n);
+  }
+
+  // Per product: left and right operand sums, the product, then the workspace of the level below
+  [[nodiscard]] std::size_t WorkSize(std::size_t m, std::size_t n, std::size_t k, int level, int depth) const {
+    if (level == depth) {
+      return 0;
+    }
+    const std::size_t hm = m / 2;
+    const std::size_t hn = n / 2;
+    const std::size_t hk = k / 2;
+    const std::size_t per_product = (hm * hk) + (hk * hn) + (hm * hn) + WorkSize(hm, hn, hk, level + 1, depth);
+    return level < config_.parallel_depth ? 7 * per_product : per_product;
+  }
+
+  static void Pad(std::size_t rows, std::size_t cols, const T *src, std::size_t lds, std::size_t padded_rows,
+                  std::size_t padded_cols, T *dst) {
+    for (std::size_t i = 0; i < rows; i++) {
+      std::copy(src + (i * lds), src + (i * lds) + cols, dst + (i * padded_cols));
+      std::fill(dst + (i * padded_cols) + cols, dst + ((i + 1) * padded_cols), T{});
+    }
+    std::fill(dst + (rows * padded_cols), dst + (padded_rows * padded_cols), T{});
+  }
+
+  // out = x + sign * y
+  static void Combine(std::size_t rows, std::size_t cols, const T *x, const T *y, std::size_t ld, int sign, T *out) {
+    for (std::size_t i = 0; i < rows; i++) {
+      const T *x_row = x + (i * ld);
+      const T *y_row = y + (i * ld);
+      T *out_row = out + (i * cols);
+      if (sign > 0) {
+        for (std::size_t j = 0; j < cols; j++) {
+          out_row[j] = x_row[j] + y_row[j];
+        }
+      } else {
+        for (std::size_t j = 0; j < cols; j++) {
+          out_row[j] = x_row[j] - y_row[j];
+        }
+      }
+    }
+  }
+
+  // dst = sign * src on the first update of a quadrant, dst += sign * src afterwards
+  static void Update(std::size_t rows, std::size_t cols, int sign, bool first, const T *src, T *dst, std::size_t ldd) {
+    for (std::size_t i = 0; i < rows; i++) {
+      const T *src_row = src + (i * cols);
+      T *dst_row = dst + (i * ldd);
+      for (std::size_t j = 0; j < cols; j++) {
+        const T value = sign > 0 ? src_row[j] : -src_row[j];
+        dst_row[j] = first ? value : dst_row[j] + value;
+      }
+    }
+  }
+
+  // Gemm over up to 7^levels row bands of at least kMinBandRows rows each, one fork body per band
+  void GemmBands(std::size_t m, std::size_t n, std::size_t k, const T *a, std::size_t lda, const T *b, std::size_t ldb,
+                 T *c, std::size_t ldc, int levels) const {
+    constexpr std::size_t kMinBandRows = 16;
+    std::size_t bands = 1;
+    for (int i = 0; i < levels; i++) {
+      bands *= 7;
+    }
+    bands = std::min(bands, (m + kMinBandRows - 1) / kMinBandRows);
+    if (bands <= 1) {
+      Gemm<T>(m, n, k, 1, a, lda, b, ldb, 0, c, ldc, config_.gemm);
+      return;
+    }
+    const std::size_t rows = (m + bands - 1) / bands;
+    bands = (m + rows - 1) / rows;
+    config_.fork(static_cast<int>(bands), [&](int band) {
+      const std::size_t begin = static_cast<std::size_t>(band) * rows;
+      const std::size_t count = std::min(rows, m - begin);
+      Gemm<T>(count, n, k, 1, a + (begin * lda), lda, b, ldb, 0, c + (begin * ldc), ldc, config_.gemm);
+    });
+  }
+
+  void Recurse(std::size_t m, std::size_t n, std::size_t k, const T *a, std::size_t lda, const T *b, std::size_t ldb,
+               T *c, std::size_t ldc, T *work, int level, int depth) const {
+    if (level == depth) {
+      if (level < config_.parallel_depth) {
+        GemmBands(m, n, k, a, lda, b, ldb, c, ldc, config_.parallel_depth - level);
+        return;
+      }
+      Gemm<T>(m, n, k, 1, a, lda, b, ldb, 0, c, ldc, config_.gemm);
+      return;
+    }
+    const std::size_t hm = m / 2;
+    const std::size_t hn = n / 2;
+    const std::size_t hk = k / 2;
+    const std::array<const T *, 4> qa = {a, a + hk, a + (hm * lda), a + (hm * lda) + hk};
+    const std::array<const T *, 4> qb = {b, b + hn, b + (hk * ldb), b + (hk * ldb) + hn};
+    const std::array<T *, 4> qc = {c, c + hn, c + (hm * ldc), c + (hm * ldc) + hn};
+    const std::size_t product_offset = (hm * hk) + (hk * hn);
+    const std::size_t per_product = product_offset + (hm * hn) + WorkSize(hm, hn, hk, level + 1, depth);
+
+    // Product i into w + product_offset (hm x hn, contiguous); operand sums are formed in w
+    auto product = [&](int i, T *w) {
+      const T *left = qa[kLeft[i].first];
+      std::size_t ld_left = lda;
+      if (kLeft[i].second >= 0) {
+        Combine(hm, hk, left, qa[kLeft[i].second], lda, kLeft[i].sign, w);
+        left = w;
+        ld_left = hk;
+      }
+      const T *right = qb[kRight[i].first];
+      std::size_t ld_right = ldb;
+      if (kRight[i].second >= 0) {
+        Combine(hk, hn, right, qb[kRight[i].second], ldb, kRight[i].sign, w + (hm * hk));
+        right = w + (hm * hk);
+        ld_right = hn;
+      }
+      Recurse(hm, hn, hk, left, ld_left, right, ld_right, w + product_offset, hn, w + product_offset + (hm * hn),
+              level + 1, depth);
+    };
+
+    if (level < config_.parallel_depth) {
+      config_.fork(7, [&](int i) { product(i, work + (i * per_product)); });
+      config_.fork(4, [&](int quadrant) {
+        bool first = true;
+        for (int i = 0; i < 7; i++) {
+          if (kCombine[i][quadrant] != 0) {
+            Update(hm, hn, kCombine[i][quadrant], first, work + (i * per_product) + product_offset, qc[quadrant], ldc);
+            first = false;
+          }
+        }
+      });
+      return;
+    }
+    std::array<bool, 4> first = {true, true, true, true};
+    for (int i = 0; i < 7; i++) {
+      product(i, work);
+      for (int quadrant = 0; quadrant < 4; quadrant++) {
+        if (kCombine[i][quadrant] != 0) {
+          Update(hm, hn, kCombine[i][quadrant], first[quadrant], work + product_offset, qc[quadrant], ldc);
+          first[quadrant] = false;
+        }
+      }
+    }
+  }
+
+  StrassenConfig config_;
+  std::vector<T> workspace_;
+};
+
+}  // namespace ppc::core
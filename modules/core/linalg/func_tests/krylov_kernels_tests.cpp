@@ -0,0 +1,269 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "core/linalg/include/krylov_kernels.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+std::vector<double> RandomVector(std::size_t size, uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> vector(size);
+  for (auto &value : vector) {
+    value = dist(gen);
+  }
+  return vector;
+}
+
+double NaiveDot(std::size_t n, const double *x, const double *y) {
+  double sum = 0.0;
+  for (std::size_t i = 0; i < n; i++) {
+    sum += x[i] * y[i];
+  }
+  return sum;
+}
+
+// Chunks handed out dynamically by a pool, so the chunk-to-thread mapping changes between runs
+ppc::core::ChunkRunner PoolRunner(ppc::core::ThreadPool &pool) {
+  return [&pool](std::size_t count, const std::function<void(std::size_t)> &body) {
+    pool.ParallelFor(
+        0, static_cast<int64_t>(count),
+        [&body](int64_t begin, int64_t end) {
+          for (int64_t chunk = begin; chunk < end; chunk++) {
+            body(static_cast<std::size_t>(chunk));
+          }
+        },
+        ppc::core::ThreadPool::kDynamic, 1);
+  };
+}
+
+}  // namespace
+
+TEST(krylov_kernels_tests, dot_matches_naive) {
+  ppc::core::KrylovKernels kernels;
+  for (std::size_t n : {0U, 1U, 7U, 33U, 4096U, 10007U}) {
+    auto x = RandomVector(n, 1);
+    auto y = RandomVector(n, 2);
+    EXPECT_NEAR(kernels.Dot(n, x.data(), y.data()), NaiveDot(n, x.data(), y.data()), 1e-10) << n;
+  }
+}
+
+TEST(krylov_kernels_tests, gemv_matches_naive) {
+  constexpr std::size_t kM = 37;
+  constexpr std::size_t kN = 29;
+  constexpr std::size_t kLda = 31;
+  auto a = RandomVector(kM * kLda, 3);
+  auto x = RandomVector(kN, 4);
+  auto y = RandomVector(kM, 5);
+  auto expected = y;
+  for (std::size_t i = 0; i < kM; i++) {
+    expected[i] = (2.0 * NaiveDot(kN, a.data() + (i * kLda), x.data())) - (0.5 * expected[i]);
+  }
+  ppc::core::KrylovKernels kernels;
+  kernels.Gemv(kM, kN, 2.0, a.data(), kLda, x.data(), -0.5, y.data());
+  for (std::size_t i = 0; i < kM; i++) {
+    EXPECT_NEAR(y[i], expected[i], 1e-12) << i;
+  }
+}
+
+TEST(krylov_kernels_tests, fused_kernels_match_separate_sweeps) {
+  constexpr std::size_t kN = 301;
+  auto a = RandomVector(kN * kN, 6);
+  auto p = RandomVector(kN, 7);
+  auto x = RandomVector(kN, 8);
+  auto r = RandomVector(kN, 9);
+  std::vector<double> ap(kN);
+  ppc::core::KrylovKernels kernels;
+
+  const double p_ap = kernels.GemvDot(kN, a.data(), kN, p.data(), ap.data());
+  double expected_p_ap = 0.0;
+  for (std::size_t i = 0; i < kN; i++) {
+    EXPECT_NEAR(ap[i], NaiveDot(kN, a.data() + (i * kN), p.data()), 1e-12);
+    expected_p_ap += p[i] * ap[i];
+  }
+  EXPECT_NEAR(p_ap, expected_p_ap, 1e-10);
+
+  auto expected_x = x;
+  auto expected_r = r;
+  for (std::size_t i = 0; i < kN; i++) {
+    expected_x[i] += 0.25 * p[i];
+    expected_r[i] -= 0.25 * ap[i];
+  }
+  const double rs = kernels.CgUpdate(kN, 0.25, p.data(), ap.data(), x.data(), r.data());
+  EXPECT_NEAR(rs, NaiveDot(kN, expected_r.data(), expected_r.data()), 1e-10);
+  for (std::size_t i = 0; i < kN; i++) {
+    EXPECT_NEAR(x[i], expected_x[i], 1e-14);
+    EXPECT_NEAR(r[i], expected_r[i], 1e-14);
+  }
+
+  auto expected_p = p;
+  for (std::size_t i = 0; i < kN; i++) {
+    expected_p[i] = r[i] + (0.5 * p[i]);
+  }
+  kernels.Xpby(kN, r.data(), 0.5, p.data());
+  EXPECT_EQ(p, expected_p);
+}
+
+TEST(krylov_kernels_tests, reductions_do_not_depend_on_thread_count) {
+  constexpr std::size_t kN = 50000;
+  constexpr std::size_t kRows = 700;
+  auto x = RandomVector(kN, 10);
+  auto y = RandomVector(kN, 11);
+  auto a = RandomVector(kRows * kRows, 12);
+  std::vector<double> ay(kRows);
+
+  ppc::core::KrylovKernels sequential;
+  const double dot = sequential.Dot(kN, x.data(), y.data());
+  const double gemv_dot = sequential.GemvDot(kRows, a.data(), kRows, y.data(), ay.data());
+  for (int threads : {1, 3, 8}) {
+    ppc::core::ThreadPool pool(threads);
+    ppc::core::KrylovKernels kernels(PoolRunner(pool));
+    for (int repeat = 0; repeat < 3; repeat++) {
+      EXPECT_EQ(kernels.Dot(kN, x.data(), y.data()), dot) << threads;
+      EXPECT_EQ(kernels.GemvDot(kRows, a.data(), kRows, y.data(), ay.data()), gemv_dot) << threads;
+    }
+  }
+}
+
+TEST(krylov_kernels_tests, batched_kernels_match_per_vector_loops) {
+  // three vector chunks of 1365 rows, the last one partial
+  constexpr std::size_t kN = 3001;
+  constexpr std::size_t kK = 3;
+  const auto p = RandomVector(kN * kK, 20);
+  const auto ap = RandomVector(kN * kK, 21);
+  const auto d = RandomVector(kN, 22);
+  const auto x0 = RandomVector(kN * kK, 23);
+  const auto r0 = RandomVector(kN * kK, 24);
+  const double alpha[kK] = {0.5, 0.0, -2.0};
+  const double beta[kK] = {0.25, 1.0, 0.0};
+
+  ppc::core::ThreadPool pool(3);
+  ppc::core::KrylovKernels kernels(PoolRunner(pool));
+  auto x = x0;
+  auto r = r0;
+  std::vector<double> z(kN * kK);
+  auto y = p;
+  double dots[kK];
+  double rs[kK];
+  double rz[kK];
+  kernels.DotBatch(kN, kK, p.data(), ap.data(), dots);
+  kernels.CgUpdateBatch(kN, kK, alpha, p.data(), ap.data(), x.data(), r.data(), rs);
+  kernels.ScaleDotBatch(kN, kK, d.data(), r.data(), z.data(), rz);
+  kernels.XpbyBatch(kN, kK, z.data(), beta, y.data());
+
+  for (std::size_t j = 0; j < kK; j++) {
+    double expected_dot = 0.0;
+    double expected_rs = 0.0;
+    double expected_rz = 0.0;
+    for (std::size_t i = 0; i < kN; i++) {
+      const std::size_t at = (i * kK) + j;
+      const double expected_r = r0[at] - (alpha[j] * ap[at]);
+      const double expected_z = d[i] * expected_r;
+      expected_dot += p[at] * ap[at];
+      expected_rs += expected_r * expected_r;
+      expected_rz += expected_r * expected_z;
+      EXPECT_NEAR(x[at], x0[at] + (alpha[j] * p[at]), 1e-14);
+      EXPECT_NEAR(r[at], expected_r, 1e-14);
+      EXPECT_NEAR(z[at], expected_z, 1e-14);
+      EXPECT_NEAR(y[at], expected_z + (beta[j] * p[at]), 1e-14);
+    }
+    EXPECT_NEAR(dots[j], expected_dot, 1e-10) << j;
+    EXPECT_NEAR(rs[j], expected_rs, 1e-10) << j;
+    EXPECT_NEAR(rz[j], expected_rz, 1e-10) << j;
+  }
+  // one pass each, all but Xpby reduce
+  EXPECT_EQ(kernels.SyncPoints(), 4U);
+  EXPECT_EQ(kernels.Reductions(), 3U);
+}
+
+TEST(krylov_kernels_tests, pipelined_cg_update_matches_separate_sweeps) {
+  constexpr std::size_t kN = 9001;
+  constexpr double kAlpha = 0.75;
+  constexpr double kBeta = 0.3;
+  const auto d = RandomVector(kN, 20);
+  for (bool preconditioned : {false, true}) {
+    auto x = RandomVector(kN, 21);
+    auto r = RandomVector(kN, 22);
+    auto u = RandomVector(kN, 23);
+    auto w = RandomVector(kN, 24);
+    auto m = RandomVector(kN, 25);
+    const auto n = RandomVector(kN, 26);
+    auto p = RandomVector(kN, 27);
+    auto s = RandomVector(kN, 28);
+    auto q = RandomVector(kN, 29);
+    auto z = RandomVector(kN, 30);
+
+    // Expected vectors from one sweep per update
+    auto ex = x;
+    auto er = r;
+    auto eu = preconditioned ? u : r;
+    auto ew = w;
+    auto em = preconditioned ? m : w;
+    auto ep = p;
+    auto es = s;
+    auto eq = preconditioned ? q : s;
+    auto ez = z;
+    for (std::size_t i = 0; i < kN; i++) {
+      ez[i] = n[i] + (kBeta * ez[i]);
+      eq[i] = em[i] + (kBeta * eq[i]);
+      es[i] = ew[i] + (kBeta * es[i]);
+      ep[i] = eu[i] + (kBeta * ep[i]);
+      ex[i] += kAlpha * ep[i];
+      er[i] -= kAlpha * es[i];
+      eu[i] = preconditioned ? eu[i] - (kAlpha * eq[i]) : er[i];
+      ew[i] -= kAlpha * ez[i];
+      em[i] = d[i] * ew[i];
+    }
+
+    ppc::core::PipelinedCgVectors v{
+        .x = x.data(), .r = r.data(), .w = w.data(), .n = n.data(), .p = p.data(), .s = s.data(), .z = z.data()};
+    if (preconditioned) {
+      v.u = u.data();
+      v.m = m.data();
+      v.q = q.data();
+      v.inverse_diagonal = d.data();
+    }
+    ppc::core::KrylovKernels kernels;
+    const auto dots = kernels.PipelinedCgUpdate(kN, kAlpha, kBeta, v);
+    EXPECT_EQ(kernels.Reductions(), 1U);
+
+    for (std::size_t i = 0; i < kN; i++) {
+      EXPECT_DOUBLE_EQ(x[i], ex[i]);
+      EXPECT_DOUBLE_EQ(r[i], er[i]);
+      EXPECT_DOUBLE_EQ(w[i], ew[i]);
+      EXPECT_DOUBLE_EQ(p[i], ep[i]);
+      EXPECT_DOUBLE_EQ(s[i], es[i]);
+      EXPECT_DOUBLE_EQ(z[i], ez[i]);
+      if (preconditioned) {
+        EXPECT_DOUBLE_EQ(u[i], eu[i]);
+        EXPECT_DOUBLE_EQ(q[i], eq[i]);
+        EXPECT_DOUBLE_EQ(m[i], em[i]);
+      }
+    }
+    EXPECT_NEAR(dots.ru, NaiveDot(kN, er.data(), eu.data()), 1e-9);
+    EXPECT_NEAR(dots.wu, NaiveDot(kN, ew.data(), eu.data()), 1e-9);
+    EXPECT_NEAR(dots.rr, NaiveDot(kN, er.data(), er.data()), 1e-9);
+  }
+}
+
+TEST(krylov_kernels_tests, counters_track_passes_and_reductions) {
+  constexpr std::size_t kN = 100;
+  auto x = RandomVector(kN, 31);
+  auto y = RandomVector(kN, 32);
+  ppc::core::KrylovKernels kernels;
+  kernels.Dot(kN, x.data(), y.data());
+  kernels.Xpby(kN, x.data(), 2.0, y.data());
+  kernels.Scale(kN, x.data(), x.data(), y.data());
+  EXPECT_EQ(kernels.SyncPoints(), 3U);
+  EXPECT_EQ(kernels.Reductions(), 1U);
+  kernels.ResetCounters();
+  EXPECT_EQ(kernels.SyncPoints(), 0U);
+  EXPECT_EQ(kernels.Reductions(), 0U);
+}
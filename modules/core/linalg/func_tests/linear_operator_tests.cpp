@@ -0,0 +1,319 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "core/linalg/include/krylov_kernels.hpp"
+#include "core/linalg/include/linear_operator.hpp"
+#include "core/linalg/include/preconditioner.hpp"
+#include "core/task/include/memory_profile.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+std::vector<double> RandomVector(std::size_t size, uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> vector(size);
+  for (auto &value : vector) {
+    value = dist(gen);
+  }
+  return vector;
+}
+
+std::vector<double> ToDense(const ppc::core::CsrMatrix &a) {
+  std::vector<double> dense(a.Size() * a.Size(), 0.0);
+  for (std::size_t i = 0; i < a.Size(); i++) {
+    for (auto k = a.row_ptr[i]; k < a.row_ptr[i + 1]; k++) {
+      dense[(i * a.Size()) + a.col_idx[k]] = a.values[k];
+    }
+  }
+  return dense;
+}
+
+std::vector<double> Multiply(const std::vector<double> &a, const std::vector<double> &x) {
+  const std::size_t n = x.size();
+  std::vector<double> y(n, 0.0);
+  for (std::size_t i = 0; i < n; i++) {
+    for (std::size_t j = 0; j < n; j++) {
+      y[i] += a[(i * n) + j] * x[j];
+    }
+  }
+  return y;
+}
+
+}  // namespace
+
+TEST(linear_operator_tests, laplacian_is_valid_and_symmetric) {
+  auto a = ppc::core::CsrMatrix::Laplacian2D(7, 5);
+  EXPECT_EQ(a.Size(), 35U);
+  EXPECT_EQ(a.NonZeros(), (5U * 35U) - (2U * 7U) - (2U * 5U));
+  EXPECT_TRUE(a.IsValid());
+  EXPECT_TRUE(a.IsSymmetric());
+  EXPECT_EQ(a.Diagonal(), std::vector<double>(35, 4.0));
+
+  a.values[1] = -2.0;
+  EXPECT_FALSE(a.IsSymmetric());
+  std::swap(a.col_idx[0], a.col_idx[1]);
+  EXPECT_FALSE(a.IsValid());
+}
+
+TEST(linear_operator_tests, from_dense_round_trips) {
+  auto dense = RandomVector(36, 1);
+  dense[3] = 0.0;
+  dense[20] = 0.0;
+  auto a = ppc::core::CsrMatrix::FromDense(dense.data(), 6);
+  EXPECT_TRUE(a.IsValid());
+  EXPECT_EQ(a.NonZeros(), 34U);
+  EXPECT_EQ(ToDense(a), dense);
+}
+
+TEST(linear_operator_tests, operators_agree_with_dense_product) {
+  constexpr std::size_t kNx = 45;
+  constexpr std::size_t kNy = 31;
+  const auto csr = ppc::core::CsrMatrix::Laplacian2D(kNx, kNy);
+  const auto dense = ToDense(csr);
+  const auto stencil = ppc::core::StencilOperator::Laplacian2D(kNx, kNy);
+  const auto x = RandomVector(csr.Size(), 2);
+  const auto expected = Multiply(dense, x);
+
+  ppc::core::KrylovKernels kernels;
+  for (const auto &op : {ppc::core::MatrixOperator::Dense(dense.data(), csr.Size()),
+                         ppc::core::MatrixOperator::Csr(csr), ppc::core::MatrixOperator::Stencil(stencil)}) {
+    std::vector<double> y(csr.Size());
+    const double x_y = kernels.ApplyDot(op, x.data(), y.data());
+    double expected_x_y = 0.0;
+    for (std::size_t i = 0; i < csr.Size(); i++) {
+      EXPECT_NEAR(y[i], expected[i], 1e-12) << op.GetKind() << " row " << i;
+      expected_x_y += x[i] * expected[i];
+    }
+    EXPECT_NEAR(x_y, expected_x_y, 1e-9) << op.GetKind();
+    EXPECT_EQ(op.Diagonal(), std::vector<double>(csr.Size(), 4.0)) << op.GetKind();
+  }
+}
+
+TEST(linear_operator_tests, batched_product_matches_one_vector_at_a_time) {
+  constexpr std::size_t kNx = 19;
+  constexpr std::size_t kNy = 15;
+  constexpr std::size_t kK = 5;
+  const auto csr = ppc::core::CsrMatrix::Laplacian2D(kNx, kNy);
+  const std::size_t n = csr.Size();
+  auto dense = ToDense(csr);
+  // a non-symmetric dense matrix, so that a transposed product would show
+  dense[1] = 0.5;
+  const auto x = RandomVector(n * kK, 5);
+
+  ppc::core::KrylovKernels kernels;
+  for (const auto &op : {ppc::core::MatrixOperator::Dense(dense.data(), n), ppc::core::MatrixOperator::Csr(csr)}) {
+    ASSERT_TRUE(op.SupportsBatch());
+    std::vector<double> y(n * kK);
+    double x_y[kK];
+    kernels.ApplyDotBatch(op, kK, x.data(), y.data(), x_y);
+    for (std::size_t j = 0; j < kK; j++) {
+      std::vector<double> column(n);
+      for (std::size_t i = 0; i < n; i++) {
+        column[i] = x[(i * kK) + j];
+      }
+      std::vector<double> expected(n);
+      const double expected_x_y = kernels.ApplyDot(op, column.data(), expected.data());
+      for (std::size_t i = 0; i < n; i++) {
+        EXPECT_NEAR(y[(i * kK) + j], expected[i], 1e-12) << op.GetKind() << " row " << i << " vector " << j;
+      }
+      EXPECT_NEAR(x_y[j], expected_x_y, 1e-10) << op.GetKind() << " vector " << j;
+    }
+  }
+
+  const auto stencil = ppc::core::StencilOperator::Laplacian2D(kNx, kNy);
+  const auto stencil_op = ppc::core::MatrixOperator::Stencil(stencil);
+  EXPECT_FALSE(stencil_op.SupportsBatch());
+  std::vector<double> y(n * kK);
+  EXPECT_THROW(stencil_op.ApplyRowsBatch(0, n, kK, x.data(), y.data()), std::logic_error);
+}
+
+TEST(linear_operator_tests, input_size_reads_the_slot) {
+  const auto csr = ppc::core::CsrMatrix::Laplacian2D(4, 3);
+  const auto stencil = ppc::core::StencilOperator::Laplacian2D(5, 2);
+  std::vector<double> square(49);
+  std::vector<double> oblong(50);
+  auto kind = ppc::core::kJacobiPreconditioner;
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(&csr, 1);
+  task_data->AddInput(&stencil, 1);
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(square.data()));
+  task_data->inputs_count.emplace_back(square.size());
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(oblong.data()));
+  task_data->inputs_count.emplace_back(oblong.size());
+  task_data->AddInput(&kind, 1);
+
+  EXPECT_EQ(ppc::core::MatrixOperator::InputSize(*task_data, 0), 12U);
+  EXPECT_EQ(ppc::core::MatrixOperator::InputSize(*task_data, 1), 10U);
+  EXPECT_EQ(ppc::core::MatrixOperator::InputSize(*task_data, 2), 7U);
+  EXPECT_EQ(ppc::core::MatrixOperator::InputSize(*task_data, 3), 0U);
+  EXPECT_EQ(ppc::core::MatrixOperator::InputSize(*task_data, 4), 0U);
+  EXPECT_EQ(ppc::core::MatrixOperator::InputSize(*task_data, 5), 0U);
+}
+
+TEST(linear_operator_tests, from_input_picks_the_slot_type) {
+  const auto csr = ppc::core::CsrMatrix::Laplacian2D(4, 4);
+  const auto stencil = ppc::core::StencilOperator::Laplacian2D(4, 4);
+  auto dense = ToDense(csr);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(&csr, 1);
+  task_data->AddInput(&stencil, 1);
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(dense.data()));
+  task_data->inputs_count.emplace_back(dense.size());
+  task_data->AddInput(dense.data(), dense.size());
+
+  EXPECT_EQ(ppc::core::MatrixOperator::FromInput(*task_data, 0, 16).GetKind(), ppc::core::MatrixOperator::kCsr);
+  EXPECT_EQ(ppc::core::MatrixOperator::FromInput(*task_data, 1, 16).GetKind(), ppc::core::MatrixOperator::kStencil);
+  EXPECT_EQ(ppc::core::MatrixOperator::FromInput(*task_data, 2, 16).GetKind(), ppc::core::MatrixOperator::kDense);
+  EXPECT_EQ(ppc::core::MatrixOperator::FromInput(*task_data, 3, 16).GetKind(), ppc::core::MatrixOperator::kDense);
+  // sizes that do not match, and indices past the end
+  EXPECT_TRUE(ppc::core::MatrixOperator::FromInput(*task_data, 0, 15).Empty());
+  EXPECT_TRUE(ppc::core::MatrixOperator::FromInput(*task_data, 1, 17).Empty());
+  EXPECT_TRUE(ppc::core::MatrixOperator::FromInput(*task_data, 2, 5).Empty());
+  EXPECT_TRUE(ppc::core::MatrixOperator::FromInput(*task_data, 4, 16).Empty());
+}
+
+TEST(linear_operator_tests, jacobi_scales_by_the_inverse_diagonal) {
+  const auto csr = ppc::core::CsrMatrix::Laplacian2D(6, 6);
+  const auto r = RandomVector(csr.Size(), 3);
+  ppc::core::KrylovKernels kernels;
+  ppc::core::Preconditioner preconditioner;
+  preconditioner.Setup(ppc::core::kJacobiPreconditioner, ppc::core::MatrixOperator::Csr(csr));
+  std::vector<double> z(csr.Size());
+  const double r_z = preconditioner.Apply(kernels, r.data(), z.data());
+  double expected_r_z = 0.0;
+  for (std::size_t i = 0; i < csr.Size(); i++) {
+    EXPECT_DOUBLE_EQ(z[i], r[i] / 4.0);
+    expected_r_z += r[i] * r[i] / 4.0;
+  }
+  EXPECT_NEAR(r_z, expected_r_z, 1e-12);
+}
+
+TEST(linear_operator_tests, ilu0_is_exact_without_fill_in) {
+  // A tridiagonal matrix factors without fill-in, so ILU(0) is its exact LU factorization
+  constexpr std::size_t kN = 50;
+  auto csr = ppc::core::CsrMatrix::Laplacian2D(kN, 1);
+  const auto dense = ToDense(csr);
+  const auto x = RandomVector(kN, 4);
+  const auto r = Multiply(dense, x);
+
+  ppc::core::KrylovKernels kernels;
+  ppc::core::Preconditioner preconditioner;
+  preconditioner.Setup(ppc::core::kIlu0Preconditioner, ppc::core::MatrixOperator::Csr(csr));
+  std::vector<double> z(kN);
+  preconditioner.Apply(kernels, r.data(), z.data());
+  for (std::size_t i = 0; i < kN; i++) {
+    EXPECT_NEAR(z[i], x[i], 1e-10) << i;
+  }
+}
+
+TEST(linear_operator_tests, batched_preconditioners_match_single_application) {
+  constexpr std::size_t kK = 4;
+  const auto csr = ppc::core::CsrMatrix::Laplacian2D(9, 7);
+  const std::size_t n = csr.Size();
+  const auto r = RandomVector(n * kK, 6);
+
+  ppc::core::KrylovKernels kernels;
+  for (auto kind : {ppc::core::kNoPreconditioner, ppc::core::kJacobiPreconditioner, ppc::core::kIlu0Preconditioner}) {
+    ppc::core::Preconditioner preconditioner;
+    preconditioner.Setup(kind, ppc::core::MatrixOperator::Csr(csr));
+    std::vector<double> z(n * kK);
+    double r_z[kK];
+    preconditioner.ApplyBatch(kernels, kK, r.data(), z.data(), r_z);
+    for (std::size_t j = 0; j < kK; j++) {
+      std::vector<double> column(n);
+      for (std::size_t i = 0; i < n; i++) {
+        column[i] = r[(i * kK) + j];
+      }
+      std::vector<double> expected(n);
+      const double expected_r_z = preconditioner.Apply(kernels, column.data(), expected.data());
+      for (std::size_t i = 0; i < n; i++) {
+        EXPECT_NEAR(z[(i * kK) + j], expected[i], 1e-14) << kind << " row " << i << " vector " << j;
+      }
+      EXPECT_NEAR(r_z[j], expected_r_z, 1e-12) << kind << " vector " << j;
+    }
+  }
+}
+
+TEST(linear_operator_tests, unsupported_kinds_are_rejected) {
+  const auto csr = ppc::core::CsrMatrix::Laplacian2D(3, 3);
+  auto dense = ToDense(csr);
+  auto stencil = ppc::core::StencilOperator::Laplacian2D(3, 3);
+  const auto dense_op = ppc::core::MatrixOperator::Dense(dense.data(), csr.Size());
+  const auto stencil_op = ppc::core::MatrixOperator::Stencil(stencil);
+
+  EXPECT_TRUE(ppc::core::Preconditioner::Supports(ppc::core::kJacobiPreconditioner, dense_op));
+  EXPECT_FALSE(ppc::core::Preconditioner::Supports(ppc::core::kIlu0Preconditioner, dense_op));
+  EXPECT_FALSE(ppc::core::Preconditioner::Supports(ppc::core::kIlu0Preconditioner, stencil_op));
+  stencil.diagonal.clear();
+  EXPECT_FALSE(ppc::core::Preconditioner::Supports(ppc::core::kJacobiPreconditioner, stencil_op));
+  dense[0] = 0.0;
+  EXPECT_FALSE(ppc::core::Preconditioner::Supports(ppc::core::kJacobiPreconditioner, dense_op));
+
+  ppc::core::Preconditioner preconditioner;
+  EXPECT_THROW(preconditioner.Setup(ppc::core::kIlu0Preconditioner, dense_op), std::invalid_argument);
+}
+
+TEST(linear_operator_tests, ilu0_rejects_zero_pivots) {
+  // [[1, 1], [1, 1]] has its whole diagonal in the pattern, but the second pivot is 1 - 1 * 1 = 0
+  const ppc::core::CsrMatrix singular{{.rows = 2,
+                                      .cols = 2,
+                                      .row_ptr = {0, 2, 4},
+                                      .col_idx = {0, 1, 0, 1},
+                                      .values = {1, 1, 1, 1}}};
+  const auto op = ppc::core::MatrixOperator::Csr(singular);
+  EXPECT_TRUE(ppc::core::Preconditioner::Supports(ppc::core::kIlu0Preconditioner, op));
+
+  ppc::core::Preconditioner preconditioner;
+  EXPECT_FALSE(preconditioner.TrySetup(ppc::core::kIlu0Preconditioner, op));
+  EXPECT_FALSE(preconditioner.Active());
+  EXPECT_THROW(preconditioner.Setup(ppc::core::kIlu0Preconditioner, op), std::invalid_argument);
+  EXPECT_FALSE(preconditioner.Active());
+}
+
+TEST(linear_operator_tests, setup_reuses_the_ilu0_of_try_setup) {
+  const auto csr = ppc::core::CsrMatrix::Laplacian2D(40, 40);
+  const auto op = ppc::core::MatrixOperator::Csr(csr);
+  ppc::core::Preconditioner preconditioner;
+  ASSERT_TRUE(preconditioner.TrySetup(ppc::core::kIlu0Preconditioner, op));
+
+  // The factorization is not copied or redone: Setup allocates nothing
+  ppc::core::MemoryProfiler::SetEnabled(true);
+  const auto before = ppc::core::MemoryProfiler::Snapshot();
+  preconditioner.Setup(ppc::core::kIlu0Preconditioner, op);
+  const auto after = ppc::core::MemoryProfiler::Snapshot();
+  ppc::core::MemoryProfiler::SetEnabled(false);
+  EXPECT_EQ(after.allocations, before.allocations);
+  EXPECT_EQ(preconditioner.Kind(), ppc::core::kIlu0Preconditioner);
+
+  // Only once: a second Setup factors again
+  ppc::core::MemoryProfiler::SetEnabled(true);
+  const auto refactor_before = ppc::core::MemoryProfiler::Snapshot();
+  preconditioner.Setup(ppc::core::kIlu0Preconditioner, op);
+  const auto refactor_after = ppc::core::MemoryProfiler::Snapshot();
+  ppc::core::MemoryProfiler::SetEnabled(false);
+  if (ppc::core::MemoryProfiler::CountsAllocations()) {
+    EXPECT_GT(refactor_after.allocations, refactor_before.allocations);
+  }
+}
+
+TEST(linear_operator_tests, kind_comes_from_a_typed_input) {
+  auto kind = ppc::core::kIlu0Preconditioner;
+  std::vector<double> b(4);
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data->inputs_count.emplace_back(b.size());
+  EXPECT_EQ(ppc::core::Preconditioner::KindFromInput(*task_data, 1), ppc::core::kNoPreconditioner);
+  task_data->AddInput(&kind, 1);
+  EXPECT_EQ(ppc::core::Preconditioner::KindFromInput(*task_data, 1), ppc::core::kIlu0Preconditioner);
+  EXPECT_EQ(ppc::core::Preconditioner::KindFromInput(*task_data, 0), ppc::core::kNoPreconditioner);
+}
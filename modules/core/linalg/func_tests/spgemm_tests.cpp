@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "core/linalg/include/spgemm.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+// rows x cols matrix with about density * rows * cols entries in [-1, 1]
+ppc::core::CcsMatrix RandomCcs(std::size_t rows, std::size_t cols, double density, uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  std::bernoulli_distribution present(density);
+  ppc::core::CcsMatrix matrix;
+  matrix.rows = rows;
+  matrix.cols = cols;
+  matrix.col_ptr.push_back(0);
+  for (std::size_t j = 0; j < cols; j++) {
+    for (std::size_t i = 0; i < rows; i++) {
+      if (present(gen)) {
+        matrix.row_idx.push_back(static_cast<int>(i));
+        matrix.values.push_back(value(gen));
+      }
+    }
+    matrix.col_ptr.push_back(static_cast<int>(matrix.values.size()));
+  }
+  return matrix;
+}
+
+std::vector<double> ToDense(const ppc::core::CcsMatrix &matrix) {
+  std::vector<double> dense(matrix.rows * matrix.cols);
+  matrix.ToDense(dense.data());
+  return dense;
+}
+
+std::vector<double> DenseProduct(const ppc::core::CcsMatrix &a, const ppc::core::CcsMatrix &b) {
+  const auto da = ToDense(a);
+  const auto db = ToDense(b);
+  std::vector<double> c(a.rows * b.cols, 0.0);
+  for (std::size_t i = 0; i < a.rows; i++) {
+    for (std::size_t k = 0; k < a.cols; k++) {
+      for (std::size_t j = 0; j < b.cols; j++) {
+        c[(i * b.cols) + j] += da[(i * a.cols) + k] * db[(k * b.cols) + j];
+      }
+    }
+  }
+  return c;
+}
+
+// Chunks handed out dynamically by a pool, so the chunk-to-thread mapping changes between runs
+ppc::core::ChunkRunner PoolRunner(ppc::core::ThreadPool &pool) {
+  return [&pool](std::size_t count, const std::function<void(std::size_t)> &body) {
+    pool.ParallelFor(
+        0, static_cast<int64_t>(count),
+        [&body](int64_t begin, int64_t end) {
+          for (int64_t chunk = begin; chunk < end; chunk++) {
+            body(static_cast<std::size_t>(chunk));
+          }
+        },
+        ppc::core::ThreadPool::kDynamic, 1);
+  };
+}
+
+}  // namespace
+
+TEST(spgemm_tests, matches_dense_product) {
+  // dense enough for the dense accumulator, and so sparse that every column goes to the hash table
+  for (double density : {0.3, 0.002}) {
+    const auto a = RandomCcs(400, 150, density, 1);
+    const auto b = RandomCcs(150, 170, density * 2, 2);
+    ppc::core::SpGemm spgemm;
+    const auto c = spgemm.Multiply(ppc::core::CcsView::Of(a), ppc::core::CcsView::Of(b));
+    EXPECT_EQ(c.rows, 400U);
+    EXPECT_EQ(c.cols, 170U);
+    EXPECT_TRUE(c.IsValid());
+    const auto expected = DenseProduct(a, b);
+    const auto actual = ToDense(c);
+    for (std::size_t i = 0; i < expected.size(); i++) {
+      EXPECT_NEAR(actual[i], expected[i], 1e-12) << "density " << density << ", entry " << i;
+    }
+  }
+}
+
+TEST(spgemm_tests, drop_tolerance_compacts_columns) {
+  // a 2 x 2 product: column 0 of C has a cancellation, column 1 only tiny entries
+  ppc::core::CcsMatrix a{.rows = 2, .cols = 2, .col_ptr = {0, 2, 4}, .row_idx = {0, 1, 0, 1}, .values = {1, 1, 1, -1}};
+  ppc::core::CcsMatrix b{.rows = 2, .cols = 2, .col_ptr = {0, 2, 3}, .row_idx = {0, 1, 0}, .values = {1, -1, 1e-9}};
+  ppc::core::SpGemm spgemm;
+
+  const auto structural = spgemm.Multiply(ppc::core::CcsView::Of(a), ppc::core::CcsView::Of(b));
+  EXPECT_EQ(structural.NonZeros(), 4U);
+  const auto dropped = spgemm.Multiply(ppc::core::CcsView::Of(a), ppc::core::CcsView::Of(b), 1e-6);
+  EXPECT_TRUE(dropped.IsValid());
+  EXPECT_EQ(dropped.col_ptr, (std::vector<int>{0, 1, 1}));
+  EXPECT_EQ(dropped.row_idx, std::vector<int>{1});
+  EXPECT_EQ(dropped.values, std::vector<double>{2.0});
+}
+
+TEST(spgemm_tests, result_does_not_depend_on_thread_count) {
+  const auto a = RandomCcs(3000, 2000, 0.003, 3);
+  const auto b = RandomCcs(2000, 2500, 0.003, 4);
+  ppc::core::SpGemm sequential;
+  const auto expected = sequential.Multiply(ppc::core::CcsView::Of(a), ppc::core::CcsView::Of(b), 1e-12);
+  for (int threads : {2, 3, 8}) {
+    ppc::core::ThreadPool pool(threads);
+    ppc::core::SpGemm spgemm(PoolRunner(pool));
+    const auto c = spgemm.Multiply(ppc::core::CcsView::Of(a), ppc::core::CcsView::Of(b), 1e-12);
+    EXPECT_EQ(c.col_ptr, expected.col_ptr) << threads;
+    EXPECT_EQ(c.row_idx, expected.row_idx) << threads;
+    EXPECT_EQ(c.values, expected.values) << threads;
+  }
+}
+
+TEST(spgemm_tests, empty_and_mismatched_shapes) {
+  ppc::core::SpGemm spgemm;
+  ppc::core::CcsMatrix empty;
+  empty.col_ptr = {0};
+  const auto c = spgemm.Multiply(ppc::core::CcsView::Of(empty), ppc::core::CcsView::Of(empty));
+  EXPECT_EQ(c.col_ptr, std::vector<int>{0});
+  EXPECT_EQ(c.NonZeros(), 0U);
+
+  const auto a = RandomCcs(4, 3, 0.5, 5);
+  EXPECT_THROW(spgemm.Multiply(ppc::core::CcsView::Of(a), ppc::core::CcsView::Of(a)), std::invalid_argument);
+}
+
+TEST(spgemm_tests, dense_round_trip_and_validity) {
+  const std::vector<double> dense{0.0, 2.0, 0.0, -1.0, 0.0, 0.0, 0.0, 3.0, 4.0, 0.0, 0.0, 5.0};
+  auto a = ppc::core::CcsMatrix::FromDense(dense.data(), 3, 4);
+  EXPECT_TRUE(a.IsValid());
+  EXPECT_EQ(a.col_ptr, (std::vector<int>{0, 1, 2, 2, 5}));
+  EXPECT_EQ(a.row_idx, (std::vector<int>{2, 0, 0, 1, 2}));
+  EXPECT_EQ(ToDense(a), dense);
+
+  auto unsorted = a;
+  std::swap(unsorted.row_idx[3], unsorted.row_idx[4]);
+  EXPECT_FALSE(unsorted.IsValid());
+  auto out_of_range = a;
+  out_of_range.row_idx[0] = 3;
+  EXPECT_FALSE(out_of_range.IsValid());
+  auto short_offsets = a;
+  short_offsets.col_ptr.pop_back();
+  EXPECT_FALSE(short_offsets.IsValid());
+}
+
+TEST(spgemm_tests, exclusive_scan_spans_chunks) {
+  std::vector<int> counts(10000);
+  for (std::size_t i = 0; i < counts.size(); i++) {
+    counts[i] = static_cast<int>(i % 7);
+  }
+  ppc::core::ThreadPool pool(3);
+  ppc::core::SpGemm spgemm(PoolRunner(pool));
+  std::vector<int> offsets(counts.size() + 1);
+  spgemm.ExclusiveScan(counts.size(), counts.data(), offsets.data());
+  int running = 0;
+  for (std::size_t i = 0; i < counts.size(); i++) {
+    ASSERT_EQ(offsets[i], running) << i;
+    running += counts[i];
+  }
+  EXPECT_EQ(offsets.back(), running);
+
+  const std::vector<int> huge(3, 1 << 30);
+  EXPECT_THROW(spgemm.ExclusiveScan(huge.size(), huge.data(), offsets.data()), std::length_error);
+}
@@ -0,0 +1,499 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "core/gemm/include/gemm.hpp"
+#include "core/thread_pool/include/chunk_runner.hpp"
+
+namespace ppc::core {
+
+// Iteration of the conjugate-gradient tasks. kPipelinedCg is the pipelined CG of Ghysels and Vanroose:
+// the dot products of an iteration come out of the sweep that updates the vectors, in one reduction,
+// and the next product with A does not depend on them
+enum CgVariant : uint8_t { kClassicCg, kPipelinedCg };
+
+// Vectors of pipelined CG with w = A u, m = M^-1 w, n = A m, s = A p, q = M^-1 s and z = A q, all of the
+// same length. Without a preconditioner u, m and q are null and r, w and s stand in for them
+struct PipelinedCgVectors {
+  double *x = nullptr;
+  double *r = nullptr;
+  double *u = nullptr;
+  double *w = nullptr;
+  double *m = nullptr;
+  const double *n = nullptr;
+  double *p = nullptr;
+  double *s = nullptr;
+  double *q = nullptr;
+  double *z = nullptr;
+  // Jacobi preconditioner: the sweep also refreshes m = inverse_diagonal * w. Null otherwise
+  const double *inverse_diagonal = nullptr;
+};
+
+// r . u, w . u and r . r
+struct CgDots {
+  double ru = 0.0;
+  double wu = 0.0;
+  double rr = 0.0;
+};
+
+namespace detail {
+
+// Reductions keep four independent sums so that the loads overlap; the order of the additions
+// only depends on n
+inline double DotGeneric(std::size_t n, const double *x, const double *y) {
+  double acc[4] = {};
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    for (std::size_t l = 0; l < 4; l++) {
+      acc[l] += x[i + l] * y[i + l];
+    }
+  }
+  double sum = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+  for (; i < n; i++) {
+    sum += x[i] * y[i];
+  }
+  return sum;
+}
+
+inline double CgUpdateGeneric(std::size_t n, double alpha, const double *p, const double *ap, double *x, double *r) {
+  double acc[4] = {};
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    for (std::size_t l = 0; l < 4; l++) {
+      x[i + l] += alpha * p[i + l];
+      r[i + l] -= alpha * ap[i + l];
+      acc[l] += r[i + l] * r[i + l];
+    }
+  }
+  double sum = (acc[0] + acc[1]) + (acc[2] + acc[3]);
+  for (; i < n; i++) {
+    x[i] += alpha * p[i];
+    r[i] -= alpha * ap[i];
+    sum += r[i] * r[i];
+  }
+  return sum;
+}
+
+#ifdef PPC_GEMM_X86_DISPATCH
+
+PPC_GEMM_TARGET("avx2,fma") inline double HorizontalSum(__m256d v) {
+  const __m128d pair = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+  return _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+}
+
+PPC_GEMM_TARGET("avx2,fma") inline double DotAvx2(std::size_t n, const double *x, const double *y) {
+  __m256d acc0 = _mm256_setzero_pd();
+  __m256d acc1 = _mm256_setzero_pd();
+  __m256d acc2 = _mm256_setzero_pd();
+  __m256d acc3 = _mm256_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i), acc0);
+    acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i + 4), _mm256_loadu_pd(y + i + 4), acc1);
+    acc2 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i + 8), _mm256_loadu_pd(y + i + 8), acc2);
+    acc3 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i + 12), _mm256_loadu_pd(y + i + 12), acc3);
+  }
+  for (; i + 4 <= n; i += 4) {
+    acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i), acc0);
+  }
+  double sum = HorizontalSum(_mm256_add_pd(_mm256_add_pd(acc0, acc1), _mm256_add_pd(acc2, acc3)));
+  for (; i < n; i++) {
+    sum += x[i] * y[i];
+  }
+  return sum;
+}
+
+PPC_GEMM_TARGET("avx2,fma")
+inline double CgUpdateAvx2(std::size_t n, double alpha, const double *p, const double *ap, double *x, double *r) {
+  const __m256d valpha = _mm256_set1_pd(alpha);
+  __m256d acc0 = _mm256_setzero_pd();
+  __m256d acc1 = _mm256_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_pd(x + i, _mm256_fmadd_pd(valpha, _mm256_loadu_pd(p + i), _mm256_loadu_pd(x + i)));
+    _mm256_storeu_pd(x + i + 4, _mm256_fmadd_pd(valpha, _mm256_loadu_pd(p + i + 4), _mm256_loadu_pd(x + i + 4)));
+    const __m256d r0 = _mm256_fnmadd_pd(valpha, _mm256_loadu_pd(ap + i), _mm256_loadu_pd(r + i));
+    const __m256d r1 = _mm256_fnmadd_pd(valpha, _mm256_loadu_pd(ap + i + 4), _mm256_loadu_pd(r + i + 4));
+    _mm256_storeu_pd(r + i, r0);
+    _mm256_storeu_pd(r + i + 4, r1);
+    acc0 = _mm256_fmadd_pd(r0, r0, acc0);
+    acc1 = _mm256_fmadd_pd(r1, r1, acc1);
+  }
+  double sum = HorizontalSum(_mm256_add_pd(acc0, acc1));
+  for (; i < n; i++) {
+    x[i] += alpha * p[i];
+    r[i] -= alpha * ap[i];
+    sum += r[i] * r[i];
+  }
+  return sum;
+}
+
+#endif
+
+inline double Dot(std::size_t n, const double *x, const double *y) {
+#ifdef PPC_GEMM_X86_DISPATCH
+  if (GemmSupportedIsa() >= kGemmAvx2) {
+    return DotAvx2(n, x, y);
+  }
+#endif
+  return DotGeneric(n, x, y);
+}
+
+inline double CgUpdate(std::size_t n, double alpha, const double *p, const double *ap, double *x, double *r) {
+#ifdef PPC_GEMM_X86_DISPATCH
+  if (GemmSupportedIsa() >= kGemmAvx2) {
+    return CgUpdateAvx2(n, alpha, p, ap, x, r);
+  }
+#endif
+  return CgUpdateGeneric(n, alpha, p, ap, x, r);
+}
+
+// Dots of pipelined CG over elements [begin, end)
+inline CgDots PipelinedCgDotsRange(std::size_t begin, std::size_t end, const PipelinedCgVectors &v) {
+  const double *u = v.u != nullptr ? v.u : v.r;
+  CgDots dots;
+  for (std::size_t i = begin; i < end; i++) {
+    dots.ru += v.r[i] * u[i];
+    dots.wu += v.w[i] * u[i];
+    dots.rr += v.r[i] * v.r[i];
+  }
+  return dots;
+}
+
+// One pipelined CG update of elements [begin, end), returning the dots of the new vectors
+inline CgDots PipelinedCgUpdateRange(std::size_t begin, std::size_t end, double alpha, double beta,
+                                     const PipelinedCgVectors &v) {
+  if (v.u == nullptr) {
+    for (std::size_t i = begin; i < end; i++) {
+      v.z[i] = v.n[i] + (beta * v.z[i]);
+      v.s[i] = v.w[i] + (beta * v.s[i]);
+      v.p[i] = v.r[i] + (beta * v.p[i]);
+      v.x[i] += alpha * v.p[i];
+      v.r[i] -= alpha * v.s[i];
+      v.w[i] -= alpha * v.z[i];
+    }
+    return PipelinedCgDotsRange(begin, end, v);
+  }
+  for (std::size_t i = begin; i < end; i++) {
+    v.z[i] = v.n[i] + (beta * v.z[i]);
+    v.q[i] = v.m[i] + (beta * v.q[i]);
+    v.s[i] = v.w[i] + (beta * v.s[i]);
+    v.p[i] = v.u[i] + (beta * v.p[i]);
+    v.x[i] += alpha * v.p[i];
+    v.r[i] -= alpha * v.s[i];
+    v.u[i] -= alpha * v.q[i];
+    v.w[i] -= alpha * v.z[i];
+  }
+  if (v.inverse_diagonal != nullptr) {
+    for (std::size_t i = begin; i < end; i++) {
+      v.m[i] = v.inverse_diagonal[i] * v.w[i];
+    }
+  }
+  return PipelinedCgDotsRange(begin, end, v);
+}
+
+// sums[j] = x_j . y_j over `rows` rows of k interleaved vectors
+inline void DotBatch(std::size_t rows, std::size_t k, const double *x, const double *y, double *sums) {
+  std::fill(sums, sums + k, 0.0);
+  for (std::size_t i = 0; i < rows; i++) {
+    for (std::size_t j = 0; j < k; j++) {
+      sums[j] += x[(i * k) + j] * y[(i * k) + j];
+    }
+  }
+}
+
+// Pairwise sum of values[0], values[stride], ... in an order fixed by count
+inline double SumPartials(const double *values, std::size_t count, std::size_t stride = 1) {
+  if (count <= 8) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < count; i++) {
+      sum += values[i * stride];
+    }
+    return sum;
+  }
+  const std::size_t half = count / 2;
+  return SumPartials(values, half, stride) + SumPartials(values + (half * stride), count - half, stride);
+}
+
+}  // namespace detail
+
+// SIMD vector and matrix-vector kernels of the conjugate-gradient family, spread over chunks by a
+// ChunkRunner (sequential by default). Vectors and matrix rows are cut into chunks of fixed size
+// and per-chunk partial sums are added in a fixed order, so reductions give the same bits for
+// every thread count and schedule. Partial sums live in a buffer that is only ever grown.
+// Every kernel call is one pass over the chunks and, with a parallel runner, one barrier; the
+// kernels count the passes and the reductions among them.
+class KrylovKernels {
+ public:
+  // elements of a vector chunk and rows of a matrix chunk
+  static constexpr std::size_t kVectorChunk = 4096;
+  static constexpr std::size_t kRowChunk = 16;
+
+  explicit KrylovKernels(ChunkRunner runner = {}) : runner_(std::move(runner)) {}
+
+  // x . y
+  double Dot(std::size_t n, const double *x, const double *y) {
+    return Reduce(Chunks(n, kVectorChunk), [&](std::size_t chunk) {
+      const std::size_t begin = chunk * kVectorChunk;
+      return detail::Dot(std::min(kVectorChunk, n - begin), x + begin, y + begin);
+    });
+  }
+
+  // y = alpha * A * x + beta * y for a row-major m x n matrix A with leading dimension lda
+  void Gemv(std::size_t m, std::size_t n, double alpha, const double *a, std::size_t lda, const double *x, double beta,
+            double *y) {
+    Run(Chunks(m, kRowChunk), [&](std::size_t chunk) {
+      const std::size_t end = std::min(m, (chunk + 1) * kRowChunk);
+      for (std::size_t i = chunk * kRowChunk; i < end; i++) {
+        const double ax = alpha * detail::Dot(n, a + (i * lda), x);
+        y[i] = beta == 0.0 ? ax : ax + (beta * y[i]);
+      }
+    });
+  }
+
+  // y = A * x for a square n x n matrix, fused with the product x . y that CG needs next
+  double GemvDot(std::size_t n, const double *a, std::size_t lda, const double *x, double *y) {
+    return Reduce(Chunks(n, kRowChunk), [&](std::size_t chunk) {
+      const std::size_t end = std::min(n, (chunk + 1) * kRowChunk);
+      double sum = 0.0;
+      for (std::size_t i = chunk * kRowChunk; i < end; i++) {
+        y[i] = detail::Dot(n, a + (i * lda), x);
+        sum += x[i] * y[i];
+      }
+      return sum;
+    });
+  }
+
+  // y = A * x for an operator with Size(), RowChunk() and ApplyRows(begin, end, x, y)
+  template <class Operator>
+  void Apply(const Operator &a, const double *x, double *y) {
+    const std::size_t n = a.Size();
+    const std::size_t rows = a.RowChunk();
+    Run(Chunks(n, rows), [&](std::size_t chunk) {
+      const std::size_t begin = chunk * rows;
+      a.ApplyRows(begin, std::min(n, begin + rows), x, y);
+    });
+  }
+
+  // y = A * x fused with x . y, for an operator with Size(), RowChunk() and ApplyRows(begin, end, x, y)
+  // such as MatrixOperator
+  template <class Operator>
+  double ApplyDot(const Operator &a, const double *x, double *y) {
+    const std::size_t n = a.Size();
+    const std::size_t rows = a.RowChunk();
+    return Reduce(Chunks(n, rows), [&](std::size_t chunk) {
+      const std::size_t begin = chunk * rows;
+      const std::size_t end = std::min(n, begin + rows);
+      a.ApplyRows(begin, end, x, y);
+      return detail::Dot(end - begin, x + begin, y + begin);
+    });
+  }
+
+  // x += alpha * p and r -= alpha * ap in one sweep, returning the new r . r
+  double CgUpdate(std::size_t n, double alpha, const double *p, const double *ap, double *x, double *r) {
+    return Reduce(Chunks(n, kVectorChunk), [&](std::size_t chunk) {
+      const std::size_t begin = chunk * kVectorChunk;
+      return detail::CgUpdate(std::min(kVectorChunk, n - begin), alpha, p + begin, ap + begin, x + begin, r + begin);
+    });
+  }
+
+  // z = d * r element by element
+  void Scale(std::size_t n, const double *d, const double *r, double *z) {
+    Run(Chunks(n, kVectorChunk), [&](std::size_t chunk) {
+      const std::size_t end = std::min(n, (chunk + 1) * kVectorChunk);
+      for (std::size_t i = chunk * kVectorChunk; i < end; i++) {
+        z[i] = d[i] * r[i];
+      }
+    });
+  }
+
+  // z = d * r element by element, returning r . z
+  double ScaleDot(std::size_t n, const double *d, const double *r, double *z) {
+    return Reduce(Chunks(n, kVectorChunk), [&](std::size_t chunk) {
+      const std::size_t begin = chunk * kVectorChunk;
+      const std::size_t end = std::min(n, begin + kVectorChunk);
+      for (std::size_t i = begin; i < end; i++) {
+        z[i] = d[i] * r[i];
+      }
+      return detail::Dot(end - begin, r + begin, z + begin);
+    });
+  }
+
+  // y = x + beta * y
+  void Xpby(std::size_t n, const double *x, double beta, double *y) {
+    Run(Chunks(n, kVectorChunk), [&](std::size_t chunk) {
+      const std::size_t end = std::min(n, (chunk + 1) * kVectorChunk);
+      for (std::size_t i = chunk * kVectorChunk; i < end; i++) {
+        y[i] = x[i] + (beta * y[i]);
+      }
+    });
+  }
+
+  // Dots of the current pipelined CG vectors, taken once before the first update
+  CgDots PipelinedCgDots(std::size_t n, const PipelinedCgVectors &v) {
+    return ReduceDots(Chunks(n, kVectorChunk), [&](std::size_t chunk) {
+      const std::size_t begin = chunk * kVectorChunk;
+      return detail::PipelinedCgDotsRange(begin, std::min(n, begin + kVectorChunk), v);
+    });
+  }
+
+  // z = n + beta * z, q = m + beta * q, s = w + beta * s, p = u + beta * p, then x += alpha * p,
+  // r -= alpha * s, u -= alpha * q and w -= alpha * z in one sweep, returning the dots of the new vectors
+  CgDots PipelinedCgUpdate(std::size_t n, double alpha, double beta, const PipelinedCgVectors &v) {
+    return ReduceDots(Chunks(n, kVectorChunk), [&](std::size_t chunk) {
+      const std::size_t begin = chunk * kVectorChunk;
+      return detail::PipelinedCgUpdateRange(begin, std::min(n, begin + kVectorChunk), alpha, beta, v);
+    });
+  }
+
+  // Batched kernels work on k vectors of length n stored interleaved, entry i of vector j at [i * k + j],
+  // so that one pass over A serves all of them. Scalars and dot products come one per vector, in
+  // arrays of k. A vector chunk holds about kVectorChunk entries, whole rows of the block
+
+  // Y = A * X fused with out[j] = x_j . y_j, for an operator with Size(), BatchRowChunk() and
+  // ApplyRowsBatch(begin, end, k, x, y) such as MatrixOperator
+  template <class Operator>
+  void ApplyDotBatch(const Operator &a, std::size_t k, const double *x, double *y, double *out) {
+    const std::size_t n = a.Size();
+    const std::size_t rows = a.BatchRowChunk();
+    ReduceBatch(Chunks(n, rows), k, out, [&](std::size_t chunk, double *sums) {
+      const std::size_t begin = chunk * rows;
+      const std::size_t end = std::min(n, begin + rows);
+      a.ApplyRowsBatch(begin, end, k, x, y);
+      detail::DotBatch(end - begin, k, x + (begin * k), y + (begin * k), sums);
+    });
+  }
+
+  // out[j] = x_j . y_j
+  void DotBatch(std::size_t n, std::size_t k, const double *x, const double *y, double *out) {
+    const std::size_t rows = BatchRows(k);
+    ReduceBatch(Chunks(n, rows), k, out, [&](std::size_t chunk, double *sums) {
+      const std::size_t begin = chunk * rows;
+      detail::DotBatch(std::min(rows, n - begin), k, x + (begin * k), y + (begin * k), sums);
+    });
+  }
+
+  // x_j += alpha[j] * p_j and r_j -= alpha[j] * ap_j in one sweep, with the new r_j . r_j in out[j]
+  void CgUpdateBatch(std::size_t n, std::size_t k, const double *alpha, const double *p, const double *ap, double *x,
+                     double *r, double *out) {
+    const std::size_t rows = BatchRows(k);
+    ReduceBatch(Chunks(n, rows), k, out, [&](std::size_t chunk, double *sums) {
+      const std::size_t begin = chunk * rows * k;
+      const std::size_t end = std::min(n, (chunk + 1) * rows) * k;
+      for (std::size_t i = begin; i < end; i += k) {
+        for (std::size_t j = 0; j < k; j++) {
+          x[i + j] += alpha[j] * p[i + j];
+          r[i + j] -= alpha[j] * ap[i + j];
+        }
+      }
+      detail::DotBatch((end - begin) / k, k, r + begin, r + begin, sums);
+    });
+  }
+
+  // z_j = d * r_j element by element, with r_j . z_j in out[j]
+  void ScaleDotBatch(std::size_t n, std::size_t k, const double *d, const double *r, double *z, double *out) {
+    const std::size_t rows = BatchRows(k);
+    ReduceBatch(Chunks(n, rows), k, out, [&](std::size_t chunk, double *sums) {
+      const std::size_t begin = chunk * rows;
+      const std::size_t end = std::min(n, begin + rows);
+      for (std::size_t i = begin; i < end; i++) {
+        for (std::size_t j = 0; j < k; j++) {
+          z[(i * k) + j] = d[i] * r[(i * k) + j];
+        }
+      }
+      detail::DotBatch(end - begin, k, r + (begin * k), z + (begin * k), sums);
+    });
+  }
+
+  // y_j = x_j + beta[j] * y_j
+  void XpbyBatch(std::size_t n, std::size_t k, const double *x, const double *beta, double *y) {
+    const std::size_t rows = BatchRows(k);
+    Run(Chunks(n, rows), [&](std::size_t chunk) {
+      const std::size_t end = std::min(n, (chunk + 1) * rows) * k;
+      for (std::size_t i = chunk * rows * k; i < end; i += k) {
+        for (std::size_t j = 0; j < k; j++) {
+          y[i + j] = x[i + j] + (beta[j] * y[i + j]);
+        }
+      }
+    });
+  }
+
+  // Kernel passes and reductions since construction or the last ResetCounters
+  [[nodiscard]] std::size_t SyncPoints() const { return sync_points_; }
+  [[nodiscard]] std::size_t Reductions() const { return reductions_; }
+  void ResetCounters() {
+    sync_points_ = 0;
+    reductions_ = 0;
+  }
+
+ private:
+  static std::size_t Chunks(std::size_t n, std::size_t chunk) { return (n + chunk - 1) / chunk; }
+  // rows of k interleaved vectors in a vector chunk
+  static std::size_t BatchRows(std::size_t k) { return std::max<std::size_t>(1, kVectorChunk / k); }
+
+  void Run(std::size_t count, const std::function<void(std::size_t)> &body) {
+    sync_points_++;
+    if (count <= 1 || !runner_) {
+      RunSequential(count, body);
+    } else {
+      runner_(count, body);
+    }
+  }
+
+  template <class Partial>
+  double Reduce(std::size_t count, const Partial &partial) {
+    if (partials_.size() < count) {
+      partials_.resize(count);
+    }
+    double *partials = partials_.data();
+    Run(count, [partials, &partial](std::size_t chunk) { partials[chunk] = partial(chunk); });
+    reductions_++;
+    return detail::SumPartials(partials, count);
+  }
+
+  // Three sums in one pass, each added in the same fixed order as Reduce
+  template <class Partial>
+  CgDots ReduceDots(std::size_t count, const Partial &partial) {
+    if (partials_.size() < 3 * count) {
+      partials_.resize(3 * count);
+    }
+    double *partials = partials_.data();
+    Run(count, [partials, count, &partial](std::size_t chunk) {
+      const CgDots dots = partial(chunk);
+      partials[chunk] = dots.ru;
+      partials[count + chunk] = dots.wu;
+      partials[(2 * count) + chunk] = dots.rr;
+    });
+    reductions_++;
+    return {.ru = detail::SumPartials(partials, count),
+            .wu = detail::SumPartials(partials + count, count),
+            .rr = detail::SumPartials(partials + (2 * count), count)};
+  }
+
+  // k sums in one pass, partial(chunk, sums) writing the k sums of a chunk; each vector is added in the
+  // same fixed order as Reduce
+  template <class Partial>
+  void ReduceBatch(std::size_t count, std::size_t k, double *out, const Partial &partial) {
+    if (partials_.size() < count * k) {
+      partials_.resize(count * k);
+    }
+    double *partials = partials_.data();
+    Run(count, [partials, k, &partial](std::size_t chunk) { partial(chunk, partials + (chunk * k)); });
+    reductions_++;
+    for (std::size_t j = 0; j < k; j++) {
+      out[j] = detail::SumPartials(partials + j, count, k);
+    }
+  }
+
+  ChunkRunner runner_;
+  std::vector<double> partials_;
+  std::size_t sync_points_ = 0;
+  std::size_t reductions_ = 0;
+};
+
+}  // namespace ppc::core
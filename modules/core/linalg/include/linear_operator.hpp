@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "core/linalg/include/krylov_kernels.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+// Square sparse matrix of the Krylov solvers: a ppc::sparse::Csr with rows == cols, so a matrix built or
+// converted by the sparse library goes straight into a solver. Columns sorted within every row
+struct CsrMatrix : ppc::sparse::Csr<double> {
+  [[nodiscard]] std::size_t Size() const { return rows; }
+  // square, offsets monotone and in range, columns in range and strictly increasing in every row
+  [[nodiscard]] bool IsValid() const { return rows == cols && Csr::IsValid(); }
+  // same pattern and values as the transpose; expects a valid matrix
+  [[nodiscard]] bool IsSymmetric() const;
+  // zero where a row has no diagonal entry
+  [[nodiscard]] std::vector<double> Diagonal() const;
+
+  // nonzeros of a dense row-major n x n matrix
+  static CsrMatrix FromDense(const double *a, std::size_t n);
+  // 5-point Laplacian of an nx x ny grid with Dirichlet boundary, unknowns numbered row by row
+  static CsrMatrix Laplacian2D(std::size_t nx, std::size_t ny);
+};
+
+// Matrix-free operator: apply(begin, end, x, y) writes rows [begin, end) of y = A * x. It may be
+// called concurrently for disjoint row ranges
+struct StencilOperator {
+  std::size_t size = 0;
+  std::function<void(std::size_t begin, std::size_t end, const double *x, double *y)> apply;
+  // diagonal of A, only needed by the Jacobi preconditioner
+  std::vector<double> diagonal;
+
+  // CsrMatrix::Laplacian2D applied on the fly, with its diagonal
+  static StencilOperator Laplacian2D(std::size_t nx, std::size_t ny);
+};
+
+// Non-owning view of the system matrix of a Krylov solver: dense row-major, CSR or stencil
+class MatrixOperator {
+ public:
+  enum Kind : uint8_t { kEmpty, kDense, kCsr, kStencil };
+
+  // rows handed to one chunk of KrylovKernels::ApplyDot
+  static constexpr std::size_t kDenseRowChunk = KrylovKernels::kRowChunk;
+  static constexpr std::size_t kSparseRowChunk = 1024;
+  // rows handed to one chunk of KrylovKernels::ApplyDotBatch for a dense matrix; every chunk is one Gemm
+  // and packs the whole block of vectors, so it takes more rows than a chunk of ApplyDot
+  static constexpr std::size_t kDenseBatchRowChunk = 128;
+
+  MatrixOperator() = default;
+
+  static MatrixOperator Dense(const double *a, std::size_t n);
+  static MatrixOperator Csr(const CsrMatrix &a);
+  static MatrixOperator Stencil(const StencilOperator &op);
+  // Input `index` as an n x n operator: a CsrMatrix or StencilOperator slot, otherwise n * n raw
+  // doubles. Empty if the input is none of these
+  static MatrixOperator FromInput(const TaskData &task_data, std::size_t index, std::size_t n);
+  // n of the operator FromInput would take from input `index`: the size of a CsrMatrix or StencilOperator
+  // slot, otherwise the side of a square number of raw doubles. 0 if there is no such n
+  static std::size_t InputSize(const TaskData &task_data, std::size_t index);
+
+  [[nodiscard]] Kind GetKind() const { return kind_; }
+  [[nodiscard]] bool Empty() const { return kind_ == kEmpty; }
+  [[nodiscard]] std::size_t Size() const { return size_; }
+  [[nodiscard]] std::size_t RowChunk() const { return kind_ == kDense ? kDenseRowChunk : kSparseRowChunk; }
+  [[nodiscard]] std::size_t BatchRowChunk() const { return kind_ == kDense ? kDenseBatchRowChunk : kSparseRowChunk; }
+  // whether ApplyRowsBatch works; a stencil only takes one vector at a time
+  [[nodiscard]] bool SupportsBatch() const { return kind_ == kDense || kind_ == kCsr; }
+  // null unless the operator is a CSR matrix
+  [[nodiscard]] const CsrMatrix *GetCsr() const { return csr_; }
+  // empty for a stencil without a diagonal
+  [[nodiscard]] std::vector<double> Diagonal() const;
+
+  // rows [begin, end) of y = A * x
+  void ApplyRows(std::size_t begin, std::size_t end, const double *x, double *y) const {
+    switch (kind_) {
+      case kDense:
+        for (std::size_t i = begin; i < end; i++) {
+          y[i] = detail::Dot(size_, dense_ + (i * size_), x);
+        }
+        break;
+      case kCsr:
+        for (std::size_t i = begin; i < end; i++) {
+          double sum = 0.0;
+          for (auto k = csr_->row_ptr[i]; k < csr_->row_ptr[i + 1]; k++) {
+            sum += csr_->values[k] * x[csr_->col_idx[k]];
+          }
+          y[i] = sum;
+        }
+        break;
+      case kStencil:
+        stencil_->apply(begin, end, x, y);
+        break;
+      case kEmpty:
+        break;
+    }
+  }
+
+  // rows [begin, end) of Y = A * X for k vectors stored interleaved, entry i of vector j at [i * k + j].
+  // Dense rows are one Gemm, and a CSR row applies each of its entries to all k vectors at once.
+  // Throws std::logic_error for a stencil
+  void ApplyRowsBatch(std::size_t begin, std::size_t end, std::size_t k, const double *x, double *y) const;
+
+ private:
+  Kind kind_ = kEmpty;
+  std::size_t size_ = 0;
+  const double *dense_ = nullptr;
+  const CsrMatrix *csr_ = nullptr;
+  const StencilOperator *stencil_ = nullptr;
+};
+
+}  // namespace ppc::core
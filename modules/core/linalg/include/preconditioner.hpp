@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "core/linalg/include/krylov_kernels.hpp"
+#include "core/linalg/include/linear_operator.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+enum PreconditionerKind : uint8_t { kNoPreconditioner, kJacobiPreconditioner, kIlu0Preconditioner };
+
+// Preconditioner M of PCG, applied as z = M^-1 r. Jacobi takes M = diag(A) and works for every operator
+// with a nonzero diagonal; ILU(0) factors a CSR matrix within its own sparsity pattern
+class Preconditioner {
+ public:
+  // Kind requested through input `index` of task_data, kNoPreconditioner if there is no such typed input
+  static PreconditionerKind KindFromInput(const TaskData &task_data, std::size_t index);
+  // Whether a has what a preconditioner of this kind needs: a nonzero diagonal for Jacobi, a CSR matrix
+  // with stored diagonal entries for ILU(0). Zero ILU(0) pivots only show up in the factorization, see TrySetup
+  static bool Supports(PreconditionerKind kind, const MatrixOperator &a);
+
+  // Setup that returns false instead of throwing, for a task's Validation. An ILU(0) factorization built
+  // here is kept for the next Setup of the same CSR matrix, so a task factors once per Validation and
+  // PreProcessing pair
+  bool TrySetup(PreconditionerKind kind, const MatrixOperator &a);
+  // Throws std::invalid_argument if the kind is not supported for a, including a zero ILU(0) pivot
+  void Setup(PreconditionerKind kind, const MatrixOperator &a);
+
+  [[nodiscard]] PreconditionerKind Kind() const { return kind_; }
+  [[nodiscard]] bool Active() const { return kind_ != kNoPreconditioner; }
+
+  // 1 / diag(A) of a Jacobi preconditioner, empty for the other kinds
+  [[nodiscard]] const std::vector<double> &InverseDiagonal() const { return inverse_diagonal_; }
+
+  // z = M^-1 r, returning r . z. The ILU(0) triangular solves run sequentially
+  double Apply(KrylovKernels &kernels, const double *r, double *z) const;
+  // z = M^-1 r without the dot product
+  void Solve(KrylovKernels &kernels, const double *r, double *z) const;
+  // z_j = M^-1 r_j for k interleaved vectors as in KrylovKernels::ApplyDotBatch, with r_j . z_j in out[j]
+  void ApplyBatch(KrylovKernels &kernels, std::size_t k, const double *r, double *z, double *out) const;
+
+ private:
+  // false on a zero pivot
+  bool FactorIlu0(const CsrMatrix &a);
+  // vectors interleaved right-hand sides, each row of the factors is applied to all of them
+  void SolveIlu0(const double *r, double *z, std::size_t vectors = 1) const;
+
+  PreconditionerKind kind_ = kNoPreconditioner;
+  std::size_t size_ = 0;
+  std::vector<double> inverse_diagonal_;
+  // L (unit lower, not stored on the diagonal) and U of ILU(0) in the pattern of A
+  CsrMatrix lu_;
+  std::vector<std::size_t> diagonal_positions_;
+  // matrix whose ILU(0) TrySetup factored and Setup has not consumed yet
+  const CsrMatrix *pending_ilu0_ = nullptr;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "core/sparse/include/sparse_kernels.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/thread_pool/include/chunk_runner.hpp"
+
+namespace ppc::core {
+
+// Sparse matrix in compressed sparse column form: column j holds the rows row_idx[col_ptr[j] .. col_ptr[j + 1])
+// in increasing order, with their values
+using CcsMatrix = ppc::sparse::Csc<double, int>;
+
+// Non-owning view of a matrix in the layout of CcsMatrix, for callers that keep their own storage
+struct CcsView {
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  const int *col_ptr = nullptr;
+  const int *row_idx = nullptr;
+  const double *values = nullptr;
+
+  [[nodiscard]] ppc::sparse::CompressedView<double, int> Columns() const {
+    return {.major = cols, .minor = rows, .ptr = col_ptr, .idx = row_idx, .values = values};
+  }
+
+  static CcsView Of(const CcsMatrix &matrix) {
+    return {.rows = matrix.rows,
+            .cols = matrix.cols,
+            .col_ptr = matrix.col_ptr.data(),
+            .row_idx = matrix.row_idx.data(),
+            .values = matrix.values.data()};
+  }
+};
+
+// Gustavson's sparse product C = A * B, column by column: column j of C is the sum of the columns of A
+// picked by the entries of column j of B, so the work follows the multiply-adds and not rows x cols.
+// A symbolic pass counts the entries of every column of C, an exclusive scan of the counts places
+// the columns, and a numeric pass writes them in place, so C is allocated once at its exact size.
+// Columns are cut into bins of about equal multiply-adds and spread by a ChunkRunner (sequential by default).
+// Every thread sums a column in its own accumulator: a dense array over the rows of A, or a small
+// hash table for a column with far fewer multiply-adds than rows. The result does not depend on the
+// thread count or the schedule. The engine is the CSC product of ppc::sparse, run on views
+class SpGemm {
+ public:
+  // a column with fewer than rows / kHashRatio multiply-adds is summed in the hash table
+  static constexpr std::size_t kHashRatio = ppc::sparse::kHashRatio;
+
+  explicit SpGemm(ChunkRunner runner = {}) : runner_(std::move(runner)) {}
+
+  // Entries with |c| <= drop_tolerance are left out of C; a negative tolerance keeps every entry of the
+  // structural product. Throws std::invalid_argument if a.cols != b.rows and std::length_error if C
+  // has more entries than an int can index
+  CcsMatrix Multiply(const CcsView &a, const CcsView &b, double drop_tolerance = -1.0);
+
+  // offsets[0] = 0 and offsets[i + 1] = counts[0] + ... + counts[i], chunk by chunk. Throws
+  // std::length_error if the total does not fit in an int
+  void ExclusiveScan(std::size_t n, const int *counts, int *offsets);
+
+ private:
+  ChunkRunner runner_;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,219 @@
+#include "core/linalg/include/linear_operator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "core/gemm/include/gemm.hpp"
+#include "core/task/include/task.hpp"
+
+bool ppc::core::CsrMatrix::IsSymmetric() const {
+  for (std::size_t i = 0; i < rows; i++) {
+    for (auto k = row_ptr[i]; k < row_ptr[i + 1]; k++) {
+      const auto j = static_cast<std::size_t>(col_idx[k]);
+      if (j == i) {
+        continue;
+      }
+      const auto *row_begin = col_idx.data() + row_ptr[j];
+      const auto *row_end = col_idx.data() + row_ptr[j + 1];
+      const auto *mirror = std::lower_bound(row_begin, row_end, static_cast<int>(i));
+      if (mirror == row_end || *mirror != static_cast<int>(i) || values[mirror - col_idx.data()] != values[k]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+std::vector<double> ppc::core::CsrMatrix::Diagonal() const {
+  std::vector<double> diagonal(rows, 0.0);
+  for (std::size_t i = 0; i < rows; i++) {
+    const auto *row_begin = col_idx.data() + row_ptr[i];
+    const auto *row_end = col_idx.data() + row_ptr[i + 1];
+    const auto *entry = std::lower_bound(row_begin, row_end, static_cast<int>(i));
+    if (entry != row_end && *entry == static_cast<int>(i)) {
+      diagonal[i] = values[entry - col_idx.data()];
+    }
+  }
+  return diagonal;
+}
+
+ppc::core::CsrMatrix ppc::core::CsrMatrix::FromDense(const double *a, std::size_t n) {
+  return {Csr::FromDense(a, n, n)};
+}
+
+ppc::core::CsrMatrix ppc::core::CsrMatrix::Laplacian2D(std::size_t nx, std::size_t ny) {
+  CsrMatrix matrix;
+  matrix.rows = nx * ny;
+  matrix.cols = nx * ny;
+  matrix.row_ptr.reserve(matrix.rows + 1);
+  matrix.col_idx.reserve(5 * matrix.rows);
+  matrix.values.reserve(5 * matrix.rows);
+  matrix.row_ptr.push_back(0);
+  auto add = [&matrix](std::size_t col, double value) {
+    matrix.col_idx.push_back(static_cast<int>(col));
+    matrix.values.push_back(value);
+  };
+  for (std::size_t y = 0; y < ny; y++) {
+    for (std::size_t x = 0; x < nx; x++) {
+      const std::size_t row = (y * nx) + x;
+      if (y > 0) {
+        add(row - nx, -1.0);
+      }
+      if (x > 0) {
+        add(row - 1, -1.0);
+      }
+      add(row, 4.0);
+      if (x + 1 < nx) {
+        add(row + 1, -1.0);
+      }
+      if (y + 1 < ny) {
+        add(row + nx, -1.0);
+      }
+      matrix.row_ptr.push_back(static_cast<int>(matrix.values.size()));
+    }
+  }
+  return matrix;
+}
+
+ppc::core::StencilOperator ppc::core::StencilOperator::Laplacian2D(std::size_t nx, std::size_t ny) {
+  StencilOperator op;
+  op.size = nx * ny;
+  op.apply = [nx, ny](std::size_t begin, std::size_t end, const double *x, double *y) {
+    for (std::size_t row = begin; row < end; row++) {
+      const std::size_t gx = row % nx;
+      const std::size_t gy = row / nx;
+      double sum = 4.0 * x[row];
+      sum -= gx > 0 ? x[row - 1] : 0.0;
+      sum -= gx + 1 < nx ? x[row + 1] : 0.0;
+      sum -= gy > 0 ? x[row - nx] : 0.0;
+      sum -= gy + 1 < ny ? x[row + nx] : 0.0;
+      y[row] = sum;
+    }
+  };
+  op.diagonal.assign(op.size, 4.0);
+  return op;
+}
+
+ppc::core::MatrixOperator ppc::core::MatrixOperator::Dense(const double *a, std::size_t n) {
+  MatrixOperator op;
+  op.kind_ = kDense;
+  op.size_ = n;
+  op.dense_ = a;
+  return op;
+}
+
+ppc::core::MatrixOperator ppc::core::MatrixOperator::Csr(const CsrMatrix &a) {
+  MatrixOperator op;
+  op.kind_ = kCsr;
+  op.size_ = a.Size();
+  op.csr_ = &a;
+  return op;
+}
+
+ppc::core::MatrixOperator ppc::core::MatrixOperator::Stencil(const StencilOperator &op) {
+  MatrixOperator result;
+  result.kind_ = kStencil;
+  result.size_ = op.size;
+  result.stencil_ = &op;
+  return result;
+}
+
+ppc::core::MatrixOperator ppc::core::MatrixOperator::FromInput(const TaskData &task_data, std::size_t index,
+                                                               std::size_t n) {
+  if (index >= task_data.inputs.size() || index >= task_data.inputs_count.size() ||
+      task_data.inputs[index] == nullptr) {
+    return {};
+  }
+  if (task_data.HasInput<CsrMatrix>(index)) {
+    const auto &matrix = task_data.GetInput<CsrMatrix>(index).front();
+    return matrix.Size() == n && matrix.IsValid() ? Csr(matrix) : MatrixOperator{};
+  }
+  if (task_data.HasInput<StencilOperator>(index)) {
+    const auto &op = task_data.GetInput<StencilOperator>(index).front();
+    return op.size == n && op.apply && (op.diagonal.empty() || op.diagonal.size() == n) ? Stencil(op)
+                                                                                         : MatrixOperator{};
+  }
+  if (index < task_data.input_slots.size() && task_data.input_slots[index].IsTyped() &&
+      !task_data.HasInput<double>(index)) {
+    return {};
+  }
+  if (n == 0 || static_cast<std::uint64_t>(task_data.inputs_count[index]) != static_cast<std::uint64_t>(n) * n) {
+    return {};
+  }
+  return Dense(reinterpret_cast<const double *>(task_data.inputs[index]), n);
+}
+
+std::size_t ppc::core::MatrixOperator::InputSize(const TaskData &task_data, std::size_t index) {
+  if (index >= task_data.inputs.size() || index >= task_data.inputs_count.size() ||
+      task_data.inputs[index] == nullptr) {
+    return 0;
+  }
+  if (task_data.HasInput<CsrMatrix>(index)) {
+    return task_data.GetInput<CsrMatrix>(index).front().Size();
+  }
+  if (task_data.HasInput<StencilOperator>(index)) {
+    return task_data.GetInput<StencilOperator>(index).front().size;
+  }
+  if (index < task_data.input_slots.size() && task_data.input_slots[index].IsTyped() &&
+      !task_data.HasInput<double>(index)) {
+    return 0;
+  }
+  const auto count = static_cast<std::uint64_t>(task_data.inputs_count[index]);
+  auto side = static_cast<std::uint64_t>(std::sqrt(static_cast<double>(count)));
+  while (side * side > count) {
+    side--;
+  }
+  while ((side + 1) * (side + 1) <= count) {
+    side++;
+  }
+  return side * side == count ? static_cast<std::size_t>(side) : 0;
+}
+
+void ppc::core::MatrixOperator::ApplyRowsBatch(std::size_t begin, std::size_t end, std::size_t k, const double *x,
+                                               double *y) const {
+  switch (kind_) {
+    case kDense:
+      Gemm<double>(end - begin, k, size_, 1.0, dense_ + (begin * size_), size_, x, k, 0.0, y + (begin * k), k);
+      break;
+    case kCsr:
+      for (std::size_t i = begin; i < end; i++) {
+        double *y_row = y + (i * k);
+        std::fill(y_row, y_row + k, 0.0);
+        for (auto e = csr_->row_ptr[i]; e < csr_->row_ptr[i + 1]; e++) {
+          const double value = csr_->values[e];
+          const double *x_row = x + (static_cast<std::size_t>(csr_->col_idx[e]) * k);
+          for (std::size_t j = 0; j < k; j++) {
+            y_row[j] += value * x_row[j];
+          }
+        }
+      }
+      break;
+    case kStencil:
+      throw std::logic_error("MatrixOperator: a stencil has no batched product");
+    case kEmpty:
+      break;
+  }
+}
+
+std::vector<double> ppc::core::MatrixOperator::Diagonal() const {
+  switch (kind_) {
+    case kDense: {
+      std::vector<double> diagonal(size_);
+      for (std::size_t i = 0; i < size_; i++) {
+        diagonal[i] = dense_[(i * size_) + i];
+      }
+      return diagonal;
+    }
+    case kCsr:
+      return csr_->Diagonal();
+    case kStencil:
+      return stencil_->diagonal;
+    case kEmpty:
+      break;
+  }
+  return {};
+}
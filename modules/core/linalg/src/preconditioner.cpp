@@ -0,0 +1,202 @@
+#include "core/linalg/include/preconditioner.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/linalg/include/krylov_kernels.hpp"
+#include "core/linalg/include/linear_operator.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+constexpr std::size_t kNoEntry = SIZE_MAX;
+
+bool HasDiagonalEntries(const ppc::core::CsrMatrix &a) {
+  for (std::size_t i = 0; i < a.Size(); i++) {
+    const auto *row_begin = a.col_idx.data() + a.row_ptr[i];
+    const auto *row_end = a.col_idx.data() + a.row_ptr[i + 1];
+    if (!std::binary_search(row_begin, row_end, static_cast<int>(i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+ppc::core::PreconditionerKind ppc::core::Preconditioner::KindFromInput(const TaskData &task_data, std::size_t index) {
+  if (!task_data.HasInput<PreconditionerKind>(index)) {
+    return kNoPreconditioner;
+  }
+  return task_data.GetInput<PreconditionerKind>(index).front();
+}
+
+bool ppc::core::Preconditioner::Supports(PreconditionerKind kind, const MatrixOperator &a) {
+  switch (kind) {
+    case kNoPreconditioner:
+      return true;
+    case kJacobiPreconditioner: {
+      const auto diagonal = a.Diagonal();
+      return diagonal.size() == a.Size() && std::ranges::none_of(diagonal, [](double d) { return d == 0.0; });
+    }
+    case kIlu0Preconditioner:
+      return a.GetCsr() != nullptr && HasDiagonalEntries(*a.GetCsr());
+  }
+  return false;
+}
+
+bool ppc::core::Preconditioner::TrySetup(PreconditionerKind kind, const MatrixOperator &a) {
+  pending_ilu0_ = nullptr;
+  kind_ = kNoPreconditioner;
+  if (!Supports(kind, a)) {
+    return false;
+  }
+  size_ = a.Size();
+  inverse_diagonal_.clear();
+  lu_ = {};
+  diagonal_positions_.clear();
+  switch (kind) {
+    case kNoPreconditioner:
+      break;
+    case kJacobiPreconditioner:
+      inverse_diagonal_ = a.Diagonal();
+      for (auto &d : inverse_diagonal_) {
+        d = 1.0 / d;
+      }
+      break;
+    case kIlu0Preconditioner:
+      if (!FactorIlu0(*a.GetCsr())) {
+        lu_ = {};
+        diagonal_positions_.clear();
+        return false;
+      }
+      pending_ilu0_ = a.GetCsr();
+      break;
+  }
+  kind_ = kind;
+  return true;
+}
+
+void ppc::core::Preconditioner::Setup(PreconditionerKind kind, const MatrixOperator &a) {
+  if (kind == kIlu0Preconditioner && kind_ == kIlu0Preconditioner && pending_ilu0_ != nullptr &&
+      pending_ilu0_ == a.GetCsr()) {
+    pending_ilu0_ = nullptr;
+    return;
+  }
+  if (!Supports(kind, a)) {
+    throw std::invalid_argument("Preconditioner: kind " + std::to_string(kind) + " is not supported for the operator");
+  }
+  if (!TrySetup(kind, a)) {
+    throw std::invalid_argument("Preconditioner: zero pivot in ILU(0)");
+  }
+  pending_ilu0_ = nullptr;
+}
+
+bool ppc::core::Preconditioner::FactorIlu0(const CsrMatrix &a) {
+  lu_ = a;
+  const std::size_t n = lu_.Size();
+  diagonal_positions_.resize(n);
+  for (std::size_t i = 0; i < n; i++) {
+    const auto *row_begin = lu_.col_idx.data() + lu_.row_ptr[i];
+    const auto *row_end = lu_.col_idx.data() + lu_.row_ptr[i + 1];
+    diagonal_positions_[i] = std::lower_bound(row_begin, row_end, static_cast<int>(i)) - lu_.col_idx.data();
+  }
+
+  // IKJ elimination restricted to the pattern of A; position_of maps a column of row i to its entry
+  std::vector<std::size_t> position_of(n, kNoEntry);
+  for (std::size_t i = 0; i < n; i++) {
+    const auto row_begin = static_cast<std::size_t>(lu_.row_ptr[i]);
+    const auto row_end = static_cast<std::size_t>(lu_.row_ptr[i + 1]);
+    for (std::size_t k = row_begin; k < row_end; k++) {
+      position_of[lu_.col_idx[k]] = k;
+    }
+    for (std::size_t k = row_begin; k < diagonal_positions_[i]; k++) {
+      const auto pivot_row = static_cast<std::size_t>(lu_.col_idx[k]);
+      lu_.values[k] /= lu_.values[diagonal_positions_[pivot_row]];
+      const double factor = lu_.values[k];
+      const auto pivot_end = static_cast<std::size_t>(lu_.row_ptr[pivot_row + 1]);
+      for (std::size_t m = diagonal_positions_[pivot_row] + 1; m < pivot_end; m++) {
+        const std::size_t target = position_of[lu_.col_idx[m]];
+        if (target != kNoEntry) {
+          lu_.values[target] -= factor * lu_.values[m];
+        }
+      }
+    }
+    if (lu_.values[diagonal_positions_[i]] == 0.0) {
+      return false;
+    }
+    for (std::size_t k = row_begin; k < row_end; k++) {
+      position_of[lu_.col_idx[k]] = kNoEntry;
+    }
+  }
+  return true;
+}
+
+double ppc::core::Preconditioner::Apply(KrylovKernels &kernels, const double *r, double *z) const {
+  if (kind_ == kJacobiPreconditioner) {
+    return kernels.ScaleDot(size_, inverse_diagonal_.data(), r, z);
+  }
+  Solve(kernels, r, z);
+  return kernels.Dot(size_, r, z);
+}
+
+void ppc::core::Preconditioner::Solve(KrylovKernels &kernels, const double *r, double *z) const {
+  switch (kind_) {
+    case kNoPreconditioner:
+      std::copy(r, r + size_, z);
+      break;
+    case kJacobiPreconditioner:
+      kernels.Scale(size_, inverse_diagonal_.data(), r, z);
+      break;
+    case kIlu0Preconditioner:
+      SolveIlu0(r, z);
+      break;
+  }
+}
+
+void ppc::core::Preconditioner::ApplyBatch(KrylovKernels &kernels, std::size_t k, const double *r, double *z,
+                                           double *out) const {
+  switch (kind_) {
+    case kNoPreconditioner:
+      std::copy(r, r + (size_ * k), z);
+      break;
+    case kJacobiPreconditioner:
+      kernels.ScaleDotBatch(size_, k, inverse_diagonal_.data(), r, z, out);
+      return;
+    case kIlu0Preconditioner:
+      SolveIlu0(r, z, k);
+      break;
+  }
+  kernels.DotBatch(size_, k, r, z, out);
+}
+
+void ppc::core::Preconditioner::SolveIlu0(const double *r, double *z, std::size_t vectors) const {
+  // L y = r, then U z = y, both in z
+  for (std::size_t i = 0; i < size_; i++) {
+    double *z_row = z + (i * vectors);
+    std::copy(r + (i * vectors), r + ((i + 1) * vectors), z_row);
+    for (auto k = static_cast<std::size_t>(lu_.row_ptr[i]); k < diagonal_positions_[i]; k++) {
+      const double *z_col = z + (static_cast<std::size_t>(lu_.col_idx[k]) * vectors);
+      for (std::size_t j = 0; j < vectors; j++) {
+        z_row[j] -= lu_.values[k] * z_col[j];
+      }
+    }
+  }
+  for (std::size_t i = size_; i-- > 0;) {
+    double *z_row = z + (i * vectors);
+    const auto row_end = static_cast<std::size_t>(lu_.row_ptr[i + 1]);
+    for (std::size_t k = diagonal_positions_[i] + 1; k < row_end; k++) {
+      const double *z_col = z + (static_cast<std::size_t>(lu_.col_idx[k]) * vectors);
+      for (std::size_t j = 0; j < vectors; j++) {
+        z_row[j] -= lu_.values[k] * z_col[j];
+      }
+    }
+    for (std::size_t j = 0; j < vectors; j++) {
+      z_row[j] /= lu_.values[diagonal_positions_[i]];
+    }
+  }
+}
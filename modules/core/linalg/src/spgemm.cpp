@@ -0,0 +1,18 @@
+#include "core/linalg/include/spgemm.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+
+#include "core/sparse/include/sparse_kernels.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+
+ppc::core::CcsMatrix ppc::core::SpGemm::Multiply(const CcsView &a, const CcsView &b, double drop_tolerance) {
+  if (a.cols != b.rows) {
+    throw std::invalid_argument("SpGemm: inner dimensions differ");
+  }
+  return ppc::sparse::MultiplyColumns(a.Columns(), b.Columns(), runner_, drop_tolerance);
+}
+
+void ppc::core::SpGemm::ExclusiveScan(std::size_t n, const int *counts, int *offsets) {
+  ppc::sparse::detail::ExclusiveScan(n, counts, offsets, runner_);
+}
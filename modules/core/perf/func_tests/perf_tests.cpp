@@ -1,13 +1,99 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include "core/perf/func_tests/test_task.hpp"
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/perf_counters.hpp"
+#include "core/perf/include/perf_sink.hpp"
+#include "core/task/include/memory_profile.hpp"
 #include "core/task/include/task.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+// Stage bookkeeping the way Task::InternalOrderTest did it before the state machine:
+// every call appends a string and rescans the whole history
+class LegacyOrderTest {
+ public:
+  void Check(const std::string &str) {
+    if (!functions_order_.empty() && str == functions_order_.back() && str == "Run") {
+      return;
+    }
+    functions_order_.push_back(str);
+    for (size_t i = 0; i < functions_order_.size(); i++) {
+      if (functions_order_[i] != right_functions_order_[i % right_functions_order_.size()]) {
+        throw std::invalid_argument("order");
+      }
+    }
+  }
+
+ private:
+  std::vector<std::string> functions_order_;
+  std::vector<std::string> right_functions_order_ = {"Validation", "PreProcessing", "Run", "PostProcessing"};
+};
+
+class EmptyTask : public ppc::core::Task {
+ public:
+  explicit EmptyTask(const ppc::core::TaskDataPtr &task_data) : Task(task_data) {}
+  bool ValidationImpl() override { return true; }
+  bool PreProcessingImpl() override { return true; }
+  bool RunImpl() override { return true; }
+  bool PostProcessingImpl() override { return true; }
+};
+
+// Does all of its work on a pool worker that only exists after the first Run,
+// like an OpenMP team or ThreadPool::Global() brought up lazily by a task
+class WorkerTask : public ppc::core::Task {
+ public:
+  static constexpr uint64_t kIterations = 10000000;
+
+  explicit WorkerTask(const ppc::core::TaskDataPtr &task_data) : Task(task_data) {}
+  bool ValidationImpl() override { return true; }
+  bool PreProcessingImpl() override { return true; }
+  bool RunImpl() override {
+    if (!pool_) {
+      pool_ = std::make_unique<ppc::core::ThreadPool>(2);
+    }
+    std::atomic<bool> done{false};
+    pool_->Submit([this, &done] {
+      volatile uint64_t sum = 0;
+      for (uint64_t i = 0; i < kIterations; i++) {
+        sum = sum + i;
+      }
+      result_ = sum;
+      done.store(true, std::memory_order_release);
+    });
+    while (!done.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    return true;
+  }
+  bool PostProcessingImpl() override { return result_ > 0; }
+
+ private:
+  std::unique_ptr<ppc::core::ThreadPool> pool_;
+  uint64_t result_ = 0;
+};
+
+double NsPerCall(std::chrono::steady_clock::time_point begin, uint64_t calls) {
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count()) /
+         static_cast<double>(calls);
+}
+
+}  // namespace
 
 TEST(perf_tests, check_perf_pipeline) {
   // Create data
@@ -175,3 +261,364 @@ TEST(perf_tests, check_perf_task_float) {
   ASSERT_LE(perf_results->time_sec, ppc::core::PerfResults::kMaxTime);
   EXPECT_EQ(out[0], in.size());
 }
+
+TEST(perf_tests, check_perf_warmup_and_samples) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  perf_attr->num_warmup = 3;
+  int timer_calls = 0;
+  perf_attr->current_timer = [&] { return 0.5 * static_cast<double>(timer_calls++); };
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+
+  // Warmup runs are not timed: one timestamp at the start and one per timed run
+  EXPECT_EQ(timer_calls, 11);
+  EXPECT_EQ(perf_results->num_warmup, 3U);
+  ASSERT_EQ(perf_results->samples.size(), 10U);
+  EXPECT_DOUBLE_EQ(perf_results->time_sec, 5.0);
+  EXPECT_DOUBLE_EQ(perf_results->median_sec, 0.5);
+  EXPECT_DOUBLE_EQ(perf_results->stddev_sec, 0.0);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_perf_statistics) {
+  ppc::core::PerfResults perf_results;
+  for (int i = 100; i >= 1; i--) {
+    perf_results.samples.push_back(static_cast<double>(i));
+  }
+  perf_results.ComputeStatistics();
+
+  EXPECT_DOUBLE_EQ(perf_results.min_sec, 1.0);
+  EXPECT_DOUBLE_EQ(perf_results.max_sec, 100.0);
+  EXPECT_DOUBLE_EQ(perf_results.mean_sec, 50.5);
+  EXPECT_DOUBLE_EQ(perf_results.median_sec, 50.5);
+  EXPECT_NEAR(perf_results.p95_sec, 95.05, 1e-9);
+  EXPECT_NEAR(perf_results.p99_sec, 99.01, 1e-9);
+  EXPECT_NEAR(perf_results.stddev_sec, 29.011491975882016, 1e-9);
+  EXPECT_NEAR(perf_results.ci95_sec, 1.96 * 29.011491975882016 / 10.0, 1e-9);
+}
+
+TEST(perf_tests, check_perf_adaptive_stops_on_stable_samples) {
+  std::vector<uint32_t> in(200, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Every run takes exactly one time unit, so the interval is already tight
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 5;
+  perf_attr->adaptive = true;
+  perf_attr->time_budget_sec = 1e9;
+  int timer_calls = 0;
+  perf_attr->current_timer = [&] { return static_cast<double>(timer_calls++); };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+
+  EXPECT_EQ(perf_results->samples.size(), 5U);
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_perf_adaptive_respects_limits) {
+  std::vector<uint32_t> in(200, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Runs alternate between one and three time units, the interval never gets tight enough.
+  // After the first num_running runs every timed run is preceded by a clock restart once the
+  // statistics are updated; that bookkeeping takes 100 units here and must not be timed.
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 2;
+  perf_attr->adaptive = true;
+  perf_attr->max_running = 50;
+  perf_attr->time_budget_sec = 1e9;
+  double now = 0.0;
+  int timer_calls = 0;
+  int runs = 0;
+  perf_attr->current_timer = [&] {
+    const int call = timer_calls++;
+    const bool ends_run = call >= 1 && (call <= 2 || call % 2 == 0);
+    if (ends_run) {
+      now += (runs++ % 2 == 0) ? 1.0 : 3.0;
+    } else {
+      now += 100.0;
+    }
+    return now;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+  EXPECT_EQ(perf_results->samples.size(), 50U);
+  EXPECT_DOUBLE_EQ(perf_results->max_sec, 3.0);
+
+  // Same noise, but the time budget runs out first
+  perf_attr->time_budget_sec = 20.0;
+  now = 0.0;
+  timer_calls = 0;
+  runs = 0;
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+  EXPECT_EQ(perf_results->samples.size(), 10U);
+  EXPECT_DOUBLE_EQ(perf_results->time_sec, 20.0);
+}
+
+TEST(perf_tests, check_perf_record_from_path) {
+  ppc::core::PerfResults perf_results;
+  perf_results.time_sec = 0.5;
+  perf_results.input_size = 2000;
+  perf_results.samples = {0.25, 0.25};
+  perf_results.ComputeStatistics();
+
+  auto record = ppc::core::PerfResultSink::MakeRecord("tasks/omp/example", "pipeline", perf_results);
+  EXPECT_EQ(record.task_id, "example");
+  EXPECT_EQ(record.technology, "omp");
+  EXPECT_EQ(record.type_of_running, "pipeline");
+  EXPECT_EQ(record.input_size, 2000U);
+  EXPECT_EQ(record.status, "ok");
+
+  auto win_record = ppc::core::PerfResultSink::MakeRecord("tasks\\seq\\example", "task_run", perf_results);
+  EXPECT_EQ(win_record.task_id, "example");
+  EXPECT_EQ(win_record.technology, "seq");
+
+  perf_results.time_sec = ppc::core::PerfResults::kMaxTime;
+  EXPECT_EQ(ppc::core::PerfResultSink::MakeRecord("tasks/omp/example", "pipeline", perf_results).status, "timeout");
+}
+
+TEST(perf_tests, check_perf_record_json_and_csv) {
+  ppc::core::PerfRecord record;
+  record.task_id = "example";
+  record.technology = "tbb";
+  record.type_of_running = "task_run";
+  record.num_threads = 4;
+  record.input_size = 90000;
+  record.host = "node \"1\"";
+  record.results.time_sec = 0.5;
+  record.results.samples = {0.25, 0.25};
+  record.results.ComputeStatistics();
+
+  auto json = ppc::core::PerfResultSink::ToJson(record);
+  EXPECT_EQ(json.front(), '{');
+  EXPECT_EQ(json.back(), '}');
+  EXPECT_NE(json.find("\"task_id\":\"example\""), std::string::npos);
+  EXPECT_NE(json.find("\"technology\":\"tbb\""), std::string::npos);
+  EXPECT_NE(json.find("\"num_threads\":4"), std::string::npos);
+  EXPECT_NE(json.find("\"input_size\":90000"), std::string::npos);
+  EXPECT_NE(json.find("\"samples\":[0.25,0.25]"), std::string::npos);
+  EXPECT_NE(json.find("\"host\":\"node \\\"1\\\"\""), std::string::npos);
+
+  auto csv = ppc::core::PerfResultSink::ToCsv(record);
+  auto header = ppc::core::PerfResultSink::CsvHeader();
+  EXPECT_EQ(std::count(csv.begin(), csv.end(), ','), std::count(header.begin(), header.end(), ','));
+  EXPECT_EQ(csv.rfind("example,tbb,task_run,4,90000,ok,0.5,2,0,", 0), 0U);
+  EXPECT_NE(csv.find("\"node \"\"1\"\"\""), std::string::npos);
+}
+
+TEST(perf_tests, check_perf_sink_appends_records) {
+  auto path = std::filesystem::temp_directory_path() / "ppc_perf_sink_test.csv";
+  std::filesystem::remove(path);
+
+  ppc::core::PerfRecord record;
+  record.task_id = "example";
+  record.technology = "seq";
+  ppc::core::PerfResultSink sink(path.string(), ppc::core::PerfResultSink::kCsv);
+  sink.Write(record);
+  sink.Write(record);
+
+  std::ifstream in(path);
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(in, line);) {
+    lines.push_back(line);
+  }
+  in.close();
+  std::filesystem::remove(path);
+
+  ASSERT_EQ(lines.size(), 3U);
+  EXPECT_EQ(lines[0], ppc::core::PerfResultSink::CsvHeader());
+  EXPECT_EQ(lines[1], lines[2]);
+}
+
+TEST(perf_tests, check_perf_counters_ratios) {
+  ppc::core::PerfCounters counters;
+  EXPECT_FALSE(counters.Any());
+  EXPECT_LT(counters.Ipc(), 0.0);
+
+  counters.values[ppc::core::PerfCounters::kCycles] = 2000;
+  counters.values[ppc::core::PerfCounters::kInstructions] = 3000;
+  counters.values[ppc::core::PerfCounters::kBranches] = 400;
+  counters.values[ppc::core::PerfCounters::kBranchMisses] = 10;
+  EXPECT_TRUE(counters.Any());
+  EXPECT_DOUBLE_EQ(counters.Ipc(), 1.5);
+  EXPECT_DOUBLE_EQ(counters.BranchMissRate(), 0.025);
+  EXPECT_LT(counters.LlcMissRate(), 0.0);
+
+  ppc::core::PerfRecord record;
+  record.results.counters = counters;
+  auto json = ppc::core::PerfResultSink::ToJson(record);
+  EXPECT_NE(json.find("\"cycles\":2000"), std::string::npos);
+  EXPECT_NE(json.find("\"llc_misses\":null"), std::string::npos);
+  EXPECT_NE(json.find("\"ipc\":1.5"), std::string::npos);
+  auto csv = ppc::core::PerfResultSink::ToCsv(record);
+  auto header = ppc::core::PerfResultSink::CsvHeader();
+  EXPECT_EQ(std::count(csv.begin(), csv.end(), ','), std::count(header.begin(), header.end(), ','));
+}
+
+TEST(perf_tests, check_perf_counters_collected_or_unavailable) {
+  // Create data
+  std::vector<uint32_t> in(200000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 5;
+  perf_attr->collect_counters = true;
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Counters the kernel refuses are reported as unavailable instead of failing the run
+  ppc::core::Perf perf_analyzer(test_task);
+  ASSERT_NO_THROW(perf_analyzer.TaskRun(perf_attr, perf_results));
+  ppc::core::PerfCounterGroup group;
+  if (!group.Available()) {
+    EXPECT_FALSE(perf_results->counters.Any());
+  }
+  if (perf_results->counters.Has(ppc::core::PerfCounters::kInstructions)) {
+    EXPECT_GT(perf_results->counters.values[ppc::core::PerfCounters::kInstructions], 200000);
+  }
+  EXPECT_EQ(out[0], in.size());
+}
+
+TEST(perf_tests, check_perf_counters_see_lazily_started_workers) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  auto test_task = std::make_shared<WorkerTask>(task_data);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 3;
+  perf_attr->collect_counters = true;
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // The worker is started by an untimed run, so the counters attach to it before the timed runs
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  EXPECT_EQ(perf_results->num_warmup, 1U);
+  if (perf_results->counters.Has(ppc::core::PerfCounters::kInstructions)) {
+    EXPECT_GT(perf_results->counters.values[ppc::core::PerfCounters::kInstructions], 3 * WorkerTask::kIterations);
+  }
+}
+
+TEST(perf_tests, check_order_test_overhead) {
+  constexpr uint64_t kPipelines = 2000;
+  constexpr uint64_t kCalls = 4 * kPipelines;
+
+  LegacyOrderTest legacy;
+  auto begin = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < kPipelines; i++) {
+    legacy.Check("Validation");
+    legacy.Check("PreProcessing");
+    legacy.Check("Run");
+    legacy.Check("PostProcessing");
+  }
+  const double legacy_ns = NsPerCall(begin, kCalls);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  EmptyTask task(task_data);
+  task_data->state_of_testing = ppc::core::TaskData::kPerf;
+  begin = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < kPipelines; i++) {
+    task.Validation();
+    task.PreProcessing();
+    task.Run();
+    task.PostProcessing();
+  }
+  const double task_ns = NsPerCall(begin, kCalls);
+
+  std::cout << "order test overhead per call: legacy " << legacy_ns << " ns, state machine " << task_ns
+            << " ns (includes the virtual call)\n";
+  EXPECT_LT(task_ns, legacy_ns);
+}
+
+TEST(perf_tests, check_perf_memory_profile) {
+  // Create data
+  std::vector<uint32_t> in(2000, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Create Task
+  auto test_task = std::make_shared<ppc::test::perf::TestTask<uint32_t>>(task_data);
+
+  // Create Perf attributes
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 3;
+  perf_attr->collect_memory = true;
+
+  // Create and init perf results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Memory comes from one extra profiled pipeline
+  ppc::core::Perf perf_analyzer(test_task);
+  perf_analyzer.PipelineRun(perf_attr, perf_results);
+  EXPECT_FALSE(ppc::core::MemoryProfiler::Enabled());
+  for (const auto &stage : perf_results->memory.stages) {
+    EXPECT_EQ(stage.calls, 1U);
+  }
+
+  ppc::core::PerfRecord record;
+  record.results = *perf_results;
+  EXPECT_NE(ppc::core::PerfResultSink::ToJson(record).find("\"run_allocations\":"), std::string::npos);
+  auto csv = ppc::core::PerfResultSink::ToCsv(record);
+  auto header = ppc::core::PerfResultSink::CsvHeader();
+  EXPECT_EQ(std::count(csv.begin(), csv.end(), ','), std::count(header.begin(), header.end(), ','));
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "core/perf/include/scaling.hpp"
+#include "core/task/include/task.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+// Sums its input on the global thread pool
+class PoolSumTask : public ppc::core::Task {
+ public:
+  explicit PoolSumTask(const ppc::core::TaskDataPtr &task_data) : Task(task_data) {}
+
+  bool ValidationImpl() override { return task_data->HasInput<double>(0) && task_data->HasOutput<double>(0); }
+
+  bool PreProcessingImpl() override { return true; }
+
+  bool RunImpl() override {
+    auto input = task_data->GetInput<double>(0);
+    task_data->GetOutput<double>(0)[0] = ppc::core::ThreadPool::Global().ParallelReduce(
+        int64_t{0}, static_cast<int64_t>(input.size()), 0.0,
+        [&](int64_t begin, int64_t end, double acc) {
+          for (int64_t i = begin; i < end; i++) {
+            acc += input[i];
+          }
+          return acc;
+        },
+        [](double a, double b) { return a + b; });
+    return true;
+  }
+
+  bool PostProcessingImpl() override { return true; }
+};
+
+std::shared_ptr<ppc::core::Task> MakePoolSumTask(uint64_t input_size) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  auto input = task_data->AllocateInput<double>(input_size);
+  for (auto &value : input) {
+    value = 1.0;
+  }
+  task_data->AllocateOutput<double>(1);
+  return std::make_shared<PoolSumTask>(task_data);
+}
+
+ppc::core::ScalingCurve MakeCurve(ppc::core::ScalingCurve::Kind kind, const std::vector<double> &times) {
+  ppc::core::ScalingCurve curve;
+  curve.kind = kind;
+  curve.input_size = 100;
+  int threads = 1;
+  for (double time : times) {
+    curve.points.push_back({.num_threads = threads, .input_size = 100, .time_sec = time});
+    threads *= 2;
+  }
+  return curve;
+}
+
+}  // namespace
+
+TEST(scaling_tests, strong_scaling_of_amdahl_task) {
+  // 10% serial work: T(p) = 0.1 + 0.9 / p
+  auto curve = MakeCurve(ppc::core::ScalingCurve::kStrong, {1.0, 0.55, 0.325, 0.2125, 0.15625});
+  ppc::core::ScalingStudy::Analyze(curve, 0.5, 0.05);
+
+  EXPECT_DOUBLE_EQ(curve.points[0].speedup, 1.0);
+  EXPECT_NEAR(curve.points[2].speedup, 1.0 / 0.325, 1e-12);
+  for (size_t i = 1; i < curve.points.size(); i++) {
+    EXPECT_NEAR(curve.points[i].serial_fraction, 0.1, 1e-12);
+    EXPECT_NEAR(curve.points[i].efficiency, curve.points[i].speedup / curve.points[i].num_threads, 1e-12);
+  }
+  // efficiency is 0.59 on 8 threads and 0.40 on 16
+  EXPECT_EQ(curve.saturation_threads, 8);
+}
+
+TEST(scaling_tests, strong_scaling_stops_when_speedup_flattens) {
+  auto curve = MakeCurve(ppc::core::ScalingCurve::kStrong, {1.0, 0.5, 0.49, 0.25});
+  ppc::core::ScalingStudy::Analyze(curve, 0.1, 0.05);
+  EXPECT_EQ(curve.saturation_threads, 2);
+}
+
+TEST(scaling_tests, weak_scaling_uses_scaled_speedup) {
+  auto curve = MakeCurve(ppc::core::ScalingCurve::kWeak, {1.0, 1.0, 1.0, 1.25});
+  ppc::core::ScalingStudy::Analyze(curve, 0.5, 0.05);
+
+  EXPECT_DOUBLE_EQ(curve.points[2].speedup, 4.0);
+  EXPECT_DOUBLE_EQ(curve.points[2].efficiency, 1.0);
+  EXPECT_DOUBLE_EQ(curve.points[2].serial_fraction, 0.0);
+  EXPECT_DOUBLE_EQ(curve.points[3].efficiency, 0.8);
+  EXPECT_EQ(curve.saturation_threads, 8);
+}
+
+TEST(scaling_tests, sweeps_threads_and_sizes) {
+  const int saved_threads = ppc::util::GetPPCNumThreads();
+  ppc::core::ScalingAttr attr;
+  attr.thread_counts = {1, 2};
+  attr.input_sizes = {1 << 12, 1 << 14};
+  attr.num_running = 3;
+  std::vector<int> applied;
+  attr.set_num_threads = [&](int num_threads) { applied.push_back(num_threads); };
+  ppc::core::ScalingStudy study(MakePoolSumTask, attr);
+
+  auto strong = study.StrongScaling();
+  ASSERT_EQ(strong.size(), 2U);
+  ASSERT_EQ(strong[1].points.size(), 2U);
+  EXPECT_EQ(strong[1].points[1].num_threads, 2);
+  EXPECT_EQ(strong[1].points[1].input_size, uint64_t{1} << 14);
+  EXPECT_GT(strong[1].points[1].time_sec, 0.0);
+
+  auto weak = study.WeakScaling();
+  EXPECT_EQ(weak[0].points[1].input_size, uint64_t{2} << 12);
+  EXPECT_EQ(applied, std::vector<int>({1, 2, 1, 2, saved_threads, 1, 2, 1, 2, saved_threads}));
+  EXPECT_EQ(ppc::util::GetPPCNumThreads(), saved_threads);
+
+  ppc::core::ScalingStudy::Print("core/perf", strong);
+  auto csv = ppc::core::ScalingStudy::ToCsv("core/perf", strong);
+  EXPECT_EQ(std::count(csv.begin(), csv.end(), '\n'), 5);
+}
+
+TEST(scaling_tests, rejects_unsorted_thread_counts) {
+  ppc::core::ScalingAttr attr;
+  attr.thread_counts = {4, 2};
+  EXPECT_THROW(ppc::core::ScalingStudy(MakePoolSumTask, attr), std::invalid_argument);
+}
+
+TEST(scaling_tests, rejects_more_threads_than_the_global_pool) {
+  const int saved_threads = ppc::util::GetPPCNumThreads();
+  const int pool_threads = ppc::core::ThreadPool::Global().NumThreads();
+  ppc::core::ScalingAttr attr;
+  attr.thread_counts = {1, pool_threads + 1};
+  attr.input_sizes = {1 << 10};
+  ppc::core::ScalingStudy study(MakePoolSumTask, attr);
+  EXPECT_THROW((void)study.StrongScaling(), std::runtime_error);
+  EXPECT_EQ(ppc::util::GetPPCNumThreads(), saved_threads);
+
+  attr.thread_counts = {1, pool_threads};
+  ppc::core::ScalingStudy fitting(MakePoolSumTask, attr);
+  EXPECT_EQ(fitting.StrongScaling()[0].points.back().num_threads, pool_threads);
+}
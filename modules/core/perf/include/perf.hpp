@@ -3,7 +3,10 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <vector>
 
+#include "core/perf/include/perf_counters.hpp"
+#include "core/task/include/memory_profile.hpp"
 #include "core/task/include/task.hpp"
 
 namespace ppc::core {
@@ -11,14 +14,55 @@ namespace ppc::core {
 struct PerfAttr {
   // count of task's running
   uint64_t num_running;
+  // count of untimed runs before measurement (first-touch page faults, thread pool spin-up)
+  uint64_t num_warmup = 0;
   std::function<double()> current_timer = [&] { return 0.0; };
+  // adaptive mode: after num_running runs keep going until the 95% confidence interval
+  // of the mean is within target_relative_ci of the mean or time_budget_sec is spent
+  bool adaptive = false;
+  double target_relative_ci = 0.02;
+  double time_budget_sec = 5.0;
+  uint64_t max_running = 1000;
+  // hardware/software event counters around the timed runs (also enabled by PPC_PERF_COUNTERS);
+  // implies at least one warmup run so that worker threads exist before counting starts
+  bool collect_counters = false;
+  // per-stage allocations and peak RSS from one extra untimed pipeline (also enabled by PPC_MEMORY_PROFILE)
+  bool collect_memory = false;
 };
 
 struct PerfResults {
-  // measurement of task's time (in seconds)
+  // measurement of task's time (in seconds), total over all timed runs
   double time_sec = 0.0;
-  enum TypeOfRunning : uint8_t { kPipeline, kTaskRun, kNone } type_of_running = kNone;
+  enum TypeOfRunning : uint8_t { kPipeline, kTaskRun, kBatch, kNone } type_of_running = kNone;
   constexpr static double kMaxTime = 10.0;
+  // total count of input elements of the measured task
+  uint64_t input_size = 0;
+  // batch runs (PipelineExecutor): completed and dropped inputs, completed inputs per second
+  uint64_t num_items = 0;
+  uint64_t num_failed_items = 0;
+  double throughput_items_per_sec = 0.0;
+
+  // time of every timed run (in seconds), in order of execution
+  std::vector<double> samples;
+  uint64_t num_warmup = 0;
+  // distribution of samples (in seconds)
+  double min_sec = 0.0;
+  double max_sec = 0.0;
+  double mean_sec = 0.0;
+  double median_sec = 0.0;
+  double p95_sec = 0.0;
+  double p99_sec = 0.0;
+  double stddev_sec = 0.0;
+  // half width of the 95% confidence interval of the mean
+  double ci95_sec = 0.0;
+
+  // event totals over all timed runs, unavailable unless counters were requested and permitted
+  PerfCounters counters;
+  // per-stage memory usage, empty unless memory profiling was requested
+  MemoryProfile memory;
+
+  // recompute distribution fields from samples
+  void ComputeStatistics();
 };
 
 class Perf {
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace ppc::core {
+
+// Event totals over a measured region, summed over all threads of the process.
+// A value of -1 means the event could not be counted on this machine
+struct PerfCounters {
+  enum Event : uint8_t {
+    kCycles,
+    kInstructions,
+    kLlcReferences,
+    kLlcMisses,
+    kBranches,
+    kBranchMisses,
+    kPageFaults,
+    kContextSwitches,
+    kNumEvents
+  };
+
+  std::array<int64_t, kNumEvents> values = MakeUnavailable();
+
+  [[nodiscard]] bool Has(Event event) const { return values[event] >= 0; }
+  [[nodiscard]] bool Any() const;
+  // Instructions per cycle, LLC misses per LLC reference, branch misses per branch; -1 if unavailable
+  [[nodiscard]] double Ipc() const { return Ratio(kInstructions, kCycles); }
+  [[nodiscard]] double LlcMissRate() const { return Ratio(kLlcMisses, kLlcReferences); }
+  [[nodiscard]] double BranchMissRate() const { return Ratio(kBranchMisses, kBranches); }
+
+  static const char* EventName(Event event);
+
+ private:
+  static constexpr std::array<int64_t, kNumEvents> MakeUnavailable() {
+    std::array<int64_t, kNumEvents> values{};
+    values.fill(-1);
+    return values;
+  }
+  [[nodiscard]] double Ratio(Event numerator, Event denominator) const;
+};
+
+// Linux perf_event_open counters for every thread of the process that exists when the
+// group is built or started. Counts of threads started later are inherited, but the kernel
+// only adds them to the parent when such a thread exits, so long-lived OpenMP or ThreadPool
+// workers must be running before Start to be counted. Events the kernel refuses, e.g. under
+// a restrictive perf_event_paranoid or inside a VM without a PMU, are left out, and on
+// other platforms nothing is counted
+class PerfCounterGroup {
+ public:
+  PerfCounterGroup();
+  ~PerfCounterGroup();
+  PerfCounterGroup(const PerfCounterGroup&) = delete;
+  PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+  PerfCounterGroup(PerfCounterGroup&&) = delete;
+  PerfCounterGroup& operator=(PerfCounterGroup&&) = delete;
+
+  // Counting is requested by PerfAttr::collect_counters or the PPC_PERF_COUNTERS environment variable
+  static bool EnabledByEnvironment();
+
+  [[nodiscard]] bool Available() const { return !counters_.empty(); }
+  // Attach to threads started since the group was built, then reset and start all counters
+  void Start();
+  void Stop();
+  // Totals since Start, scaled when the kernel had to multiplex counters
+  [[nodiscard]] PerfCounters Read() const;
+
+ private:
+  struct Counter {
+    PerfCounters::Event event;
+    int fd;
+  };
+  // Open counters of every event for threads of the process not attached yet
+  void AttachNewThreads();
+
+  std::vector<Counter> counters_;
+  std::vector<int> threads_;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+#include "core/perf/include/perf.hpp"
+
+namespace ppc::core {
+
+// One perf measurement in a form that scripts can consume without parsing logs
+struct PerfRecord {
+  std::string task_id;
+  // seq, omp, tbb, stl, mpi or all
+  std::string technology;
+  // pipeline, task_run or none
+  std::string type_of_running;
+  int num_threads = 1;
+  uint64_t input_size = 0;
+  // ok, or timeout when time_sec exceeds PerfResults::kMaxTime
+  std::string status = "ok";
+  std::string host;
+  unsigned hardware_concurrency = 0;
+  PerfResults results;
+};
+
+// Appends one record per perf run to a JSON lines or CSV file
+class PerfResultSink {
+ public:
+  enum Format : uint8_t { kJson, kCsv };
+
+  PerfResultSink(std::string path, Format format);
+
+  // Sink configured by the PPC_PERF_RESULTS environment variable, the format
+  // follows the file extension (.csv, otherwise JSON lines)
+  static std::optional<PerfResultSink> FromEnvironment();
+
+  // Fill task id and technology from a "tasks/<technology>/<task_id>" path and host info from the machine
+  static PerfRecord MakeRecord(const std::string& relative_path, const std::string& type_of_running,
+                               const PerfResults& perf_results);
+
+  static std::string ToJson(const PerfRecord& record);
+  static std::string CsvHeader();
+  static std::string ToCsv(const PerfRecord& record);
+
+  void Write(const PerfRecord& record) const;
+
+ private:
+  std::string path_;
+  Format format_;
+};
+
+}  // namespace ppc::core
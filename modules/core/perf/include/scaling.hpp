@@ -0,0 +1,87 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+struct ScalingAttr {
+  // thread counts to sweep in increasing order, empty - powers of two up to hardware_concurrency
+  std::vector<int> thread_counts;
+  // strong scaling: total input sizes; weak scaling: input size per thread
+  std::vector<uint64_t> input_sizes;
+  // per point: untimed runs, then timed Run() calls whose median is the point's time
+  uint64_t num_warmup = 1;
+  uint64_t num_running = 5;
+  std::function<double()> current_timer = [] {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  };
+  // a point stops scaling when its efficiency drops below min_efficiency or its speedup
+  // grows less than min_speedup_gain (relative) over the previous thread count
+  double min_efficiency = 0.5;
+  double min_speedup_gain = 0.05;
+  // applied before each point; the default calls ppc::util::SetPPCNumThreads, which also moves the TBB
+  // limit of the TBB test runner, and sets the global thread pool. A sweep then throws
+  // std::runtime_error if that pool already exists with too few threads
+  std::function<void(int)> set_num_threads;
+};
+
+struct ScalingPoint {
+  int num_threads = 1;
+  uint64_t input_size = 0;
+  // median time of one Run() call
+  double time_sec = 0.0;
+  // relative to the first thread count, which is assumed to scale perfectly
+  double speedup = 0.0;
+  double efficiency = 0.0;
+  // Karp-Flatt experimentally determined serial fraction, 0 for the first point
+  double serial_fraction = 0.0;
+};
+
+struct ScalingCurve {
+  enum Kind : uint8_t { kStrong, kWeak } kind = kStrong;
+  // total input size (strong) or input size per thread (weak)
+  uint64_t input_size = 0;
+  std::vector<ScalingPoint> points;
+  // largest thread count before the curve stops scaling
+  int saturation_threads = 0;
+};
+
+// Sweeps a task over thread counts and input sizes. Every point gets a fresh task from the
+// factory, measured like Perf::TaskRun; speedup, efficiency and serial fraction follow from
+// the measured times. Weak scaling uses the scaled (Gustafson) speedup p * T(1) / T(p)
+class ScalingStudy {
+ public:
+  // Builds a task with initialized data of the given total input size
+  using TaskFactory = std::function<std::shared_ptr<Task>(uint64_t input_size)>;
+
+  ScalingStudy(TaskFactory task_factory, ScalingAttr scaling_attr);
+
+  [[nodiscard]] std::vector<ScalingCurve> StrongScaling() const;
+  [[nodiscard]] std::vector<ScalingCurve> WeakScaling() const;
+
+  // Fill speedup, efficiency, serial fraction and saturation from point times
+  static void Analyze(ScalingCurve& curve, double min_efficiency, double min_speedup_gain);
+  // One line per point: "<name>:scaling_<kind>:<size>: threads=... speedup=..." and a
+  // saturation line per curve
+  static void Print(const std::string& name, const std::vector<ScalingCurve>& curves);
+  // One row per point, with a header row
+  static std::string ToCsv(const std::string& name, const std::vector<ScalingCurve>& curves);
+
+ private:
+  [[nodiscard]] std::vector<ScalingCurve> Sweep(ScalingCurve::Kind kind) const;
+  [[nodiscard]] double Measure(uint64_t input_size) const;
+
+  TaskFactory task_factory_;
+  ScalingAttr scaling_attr_;
+  // set_num_threads is the default one, which limits ThreadPool::Global()
+  bool uses_global_pool_ = false;
+};
+
+}  // namespace ppc::core
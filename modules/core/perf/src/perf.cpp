@@ -2,17 +2,137 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <numeric>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
+#include "core/perf/include/perf_counters.hpp"
+#include "core/perf/include/perf_sink.hpp"
+#include "core/task/include/memory_profile.hpp"
 #include "core/task/include/task.hpp"
 
+namespace {
+
+uint64_t InputSize(const ppc::core::TaskData& task_data) {
+  return std::accumulate(task_data.inputs_count.begin(), task_data.inputs_count.end(), uint64_t{0});
+}
+
+// Linear interpolation between closest ranks of sorted samples
+double Percentile(const std::vector<double>& sorted, double fraction) {
+  const double pos = fraction * static_cast<double>(sorted.size() - 1);
+  const auto lower = static_cast<size_t>(std::floor(pos));
+  const size_t upper = std::min(lower + 1, sorted.size() - 1);
+  return sorted[lower] + ((pos - static_cast<double>(lower)) * (sorted[upper] - sorted[lower]));
+}
+
+void PrintDistribution(const std::string& relative_path, const std::string& type_test_name,
+                       const ppc::core::PerfResults& perf_results) {
+  if (perf_results.samples.empty()) {
+    return;
+  }
+  std::stringstream dist_str;
+  dist_str << std::scientific << std::setprecision(4);
+  dist_str << relative_path << ":" << type_test_name << ":stats:";
+  dist_str << " runs=" << perf_results.samples.size() << " warmup=" << perf_results.num_warmup;
+  dist_str << " min=" << perf_results.min_sec << " median=" << perf_results.median_sec;
+  dist_str << " mean=" << perf_results.mean_sec << " p95=" << perf_results.p95_sec;
+  dist_str << " p99=" << perf_results.p99_sec << " max=" << perf_results.max_sec;
+  dist_str << " stddev=" << perf_results.stddev_sec << " ci95=" << perf_results.ci95_sec;
+  if (perf_results.type_of_running == ppc::core::PerfResults::TypeOfRunning::kBatch) {
+    dist_str << " items=" << perf_results.num_items << " failed=" << perf_results.num_failed_items;
+    dist_str << " throughput=" << perf_results.throughput_items_per_sec;
+  }
+  std::cout << dist_str.str() << '\n';
+}
+
+void PrintCounters(const std::string& relative_path, const std::string& type_test_name,
+                   const ppc::core::PerfResults& perf_results) {
+  using Counters = ppc::core::PerfCounters;
+  const auto& counters = perf_results.counters;
+  if (!counters.Any()) {
+    return;
+  }
+  std::stringstream counters_str;
+  counters_str << relative_path << ":" << type_test_name << ":counters:";
+  for (int event = 0; event < Counters::kNumEvents; event++) {
+    if (counters.Has(static_cast<Counters::Event>(event))) {
+      counters_str << " " << Counters::EventName(static_cast<Counters::Event>(event)) << "="
+                   << counters.values[event];
+    }
+  }
+  counters_str << std::fixed << std::setprecision(4);
+  if (counters.Ipc() >= 0.0) {
+    counters_str << " ipc=" << counters.Ipc();
+  }
+  if (counters.LlcMissRate() >= 0.0) {
+    counters_str << " llc_miss_rate=" << counters.LlcMissRate();
+  }
+  if (counters.BranchMissRate() >= 0.0) {
+    counters_str << " branch_miss_rate=" << counters.BranchMissRate();
+  }
+  std::cout << counters_str.str() << '\n';
+}
+
+void PrintMemory(const std::string& relative_path, const std::string& type_test_name,
+                 const ppc::core::PerfResults& perf_results) {
+  const auto& memory = perf_results.memory;
+  if (memory.Empty()) {
+    return;
+  }
+  std::stringstream memory_str;
+  memory_str << relative_path << ":" << type_test_name << ":memory:";
+  for (size_t i = 0; i < memory.stages.size(); i++) {
+    const auto& stage = memory.stages[i];
+    if (stage.calls == 0) {
+      continue;
+    }
+    memory_str << " " << ppc::core::MemoryProfile::kStageNames[i] << "{allocs=" << stage.allocations
+               << " bytes=" << stage.allocated_bytes << " peak_rss_delta=" << stage.peak_rss_delta_bytes << "}";
+  }
+  std::cout << memory_str.str() << '\n';
+}
+
+void RunPipeline(ppc::core::Task& task) {
+  task.Validation();
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+}
+
+// Memory is profiled on one extra untimed pipeline, so the probes do not skew the timings
+bool ProfileMemory(ppc::core::Task& task, const ppc::core::PerfAttr& perf_attr,
+                   ppc::core::PerfResults& perf_results) {
+  using ppc::core::MemoryProfiler;
+  if (!perf_attr.collect_memory && !MemoryProfiler::EnabledByEnvironment()) {
+    return false;
+  }
+  const bool was_enabled = MemoryProfiler::Enabled();
+  task.ResetMemoryProfile();
+  MemoryProfiler::SetEnabled(true);
+  try {
+    RunPipeline(task);
+  } catch (...) {
+    MemoryProfiler::SetEnabled(was_enabled);
+    throw;
+  }
+  MemoryProfiler::SetEnabled(was_enabled);
+  perf_results.memory = task.GetMemoryProfile();
+  return true;
+}
+
+}  // namespace
+
 ppc::core::Perf::Perf(const std::shared_ptr<Task>& task_ptr) { SetTask(task_ptr); }
 
 void ppc::core::Perf::SetTask(const std::shared_ptr<Task>& task_ptr) {
@@ -23,41 +143,107 @@ void ppc::core::Perf::SetTask(const std::shared_ptr<Task>& task_ptr) {
 void ppc::core::Perf::PipelineRun(const std::shared_ptr<PerfAttr>& perf_attr,
                                   const std::shared_ptr<ppc::core::PerfResults>& perf_results) const {
   perf_results->type_of_running = PerfResults::TypeOfRunning::kPipeline;
+  perf_results->input_size = InputSize(*task_->GetData());
 
-  CommonRun(
-      perf_attr,
-      [&]() {
-        task_->Validation();
-        task_->PreProcessing();
-        task_->Run();
-        task_->PostProcessing();
-      },
-      perf_results);
+  CommonRun(perf_attr, [&]() { RunPipeline(*task_); }, perf_results);
+  ProfileMemory(*task_, *perf_attr, *perf_results);
 }
 
 void ppc::core::Perf::TaskRun(const std::shared_ptr<PerfAttr>& perf_attr,
                               const std::shared_ptr<ppc::core::PerfResults>& perf_results) const {
   perf_results->type_of_running = PerfResults::TypeOfRunning::kTaskRun;
+  perf_results->input_size = InputSize(*task_->GetData());
 
   task_->Validation();
   task_->PreProcessing();
   CommonRun(perf_attr, [&]() { task_->Run(); }, perf_results);
   task_->PostProcessing();
 
-  task_->Validation();
-  task_->PreProcessing();
-  task_->Run();
-  task_->PostProcessing();
+  if (!ProfileMemory(*task_, *perf_attr, *perf_results)) {
+    RunPipeline(*task_);
+  }
+}
+
+void ppc::core::PerfResults::ComputeStatistics() {
+  if (samples.empty()) {
+    min_sec = max_sec = mean_sec = median_sec = p95_sec = p99_sec = stddev_sec = ci95_sec = 0.0;
+    return;
+  }
+
+  std::vector<double> sorted(samples);
+  std::ranges::sort(sorted);
+  const auto n = static_cast<double>(sorted.size());
+
+  min_sec = sorted.front();
+  max_sec = sorted.back();
+  mean_sec = std::accumulate(sorted.begin(), sorted.end(), 0.0) / n;
+  median_sec = Percentile(sorted, 0.5);
+  p95_sec = Percentile(sorted, 0.95);
+  p99_sec = Percentile(sorted, 0.99);
+
+  double sq_sum = 0.0;
+  for (double s : sorted) {
+    sq_sum += (s - mean_sec) * (s - mean_sec);
+  }
+  stddev_sec = sorted.size() > 1 ? std::sqrt(sq_sum / (n - 1.0)) : 0.0;
+  ci95_sec = 1.96 * stddev_sec / std::sqrt(n);
 }
 
 void ppc::core::Perf::CommonRun(const std::shared_ptr<PerfAttr>& perf_attr, const std::function<void()>& pipeline,
                                 const std::shared_ptr<ppc::core::PerfResults>& perf_results) {
-  auto begin = perf_attr->current_timer();
-  for (uint64_t i = 0; i < perf_attr->num_running; i++) {
+  // Counters only see worker threads that exist when they start (see PerfCounterGroup),
+  // so at least one untimed run brings up the OpenMP team or the thread pool first
+  const bool count_events = perf_attr->collect_counters || PerfCounterGroup::EnabledByEnvironment();
+  const uint64_t num_warmup = count_events ? std::max<uint64_t>(perf_attr->num_warmup, 1) : perf_attr->num_warmup;
+  for (uint64_t i = 0; i < num_warmup; i++) {
     pipeline();
   }
-  auto end = perf_attr->current_timer();
-  perf_results->time_sec = end - begin;
+  perf_results->num_warmup = num_warmup;
+
+  auto& samples = perf_results->samples;
+  samples.clear();
+  samples.reserve(perf_attr->adaptive ? std::max(perf_attr->num_running, perf_attr->max_running)
+                                      : perf_attr->num_running);
+
+  std::optional<PerfCounterGroup> counters;
+  if (count_events) {
+    counters.emplace();
+    counters->Start();
+  }
+
+  // time_sec is the sum of the samples, so work between runs (the adaptive statistics) is never timed
+  double timed_sec = 0.0;
+  auto last = perf_attr->current_timer();
+  auto time_one_run = [&] {
+    pipeline();
+    auto now = perf_attr->current_timer();
+    samples.push_back(now - last);
+    timed_sec += now - last;
+    last = now;
+  };
+
+  for (uint64_t i = 0; i < perf_attr->num_running; i++) {
+    time_one_run();
+  }
+
+  if (perf_attr->adaptive) {
+    perf_results->ComputeStatistics();
+    last = perf_attr->current_timer();
+    while (samples.size() < perf_attr->max_running && timed_sec < perf_attr->time_budget_sec &&
+           (samples.size() < 2 || perf_results->ci95_sec > perf_attr->target_relative_ci * perf_results->mean_sec)) {
+      time_one_run();
+      perf_results->ComputeStatistics();
+      last = perf_attr->current_timer();
+    }
+  }
+
+  if (counters) {
+    counters->Stop();
+    perf_results->counters = counters->Read();
+  }
+
+  perf_results->time_sec = timed_sec;
+  perf_results->ComputeStatistics();
 }
 
 void ppc::core::Perf::PrintPerfStatistic(const std::shared_ptr<PerfResults>& perf_results) {
@@ -72,6 +258,8 @@ void ppc::core::Perf::PrintPerfStatistic(const std::shared_ptr<PerfResults>& per
     type_test_name = "task_run";
   } else if (perf_results->type_of_running == PerfResults::TypeOfRunning::kPipeline) {
     type_test_name = "pipeline";
+  } else if (perf_results->type_of_running == PerfResults::TypeOfRunning::kBatch) {
+    type_test_name = "batch";
   } else {
     type_test_name = "none";
   }
@@ -82,10 +270,17 @@ void ppc::core::Perf::PrintPerfStatistic(const std::shared_ptr<PerfResults>& per
   auto last_found_position = relative_path.find(perf_regex_template) - 1;
   relative_path.erase(last_found_position, relative_path.length() - 1);
 
+  if (auto sink = PerfResultSink::FromEnvironment()) {
+    sink->Write(PerfResultSink::MakeRecord(relative_path, type_test_name, *perf_results));
+  }
+
   std::stringstream perf_res_str;
   if (time_secs < PerfResults::kMaxTime) {
     perf_res_str << std::fixed << std::setprecision(10) << time_secs;
     std::cout << relative_path << ":" << type_test_name << ":" << perf_res_str.str() << '\n';
+    PrintDistribution(relative_path, type_test_name, *perf_results);
+    PrintCounters(relative_path, type_test_name, *perf_results);
+    PrintMemory(relative_path, type_test_name, *perf_results);
   } else {
     std::stringstream err_msg;
     err_msg << '\n' << "Task execute time need to be: ";
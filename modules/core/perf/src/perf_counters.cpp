@@ -0,0 +1,196 @@
+#include "core/perf/include/perf_counters.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <filesystem>
+#endif
+
+namespace {
+
+#ifdef __linux__
+
+struct EventConfig {
+  uint32_t type;
+  uint64_t config;
+};
+
+constexpr std::array<EventConfig, ppc::core::PerfCounters::kNumEvents> kEventConfigs = {{
+    {.type = PERF_TYPE_HARDWARE, .config = PERF_COUNT_HW_CPU_CYCLES},
+    {.type = PERF_TYPE_HARDWARE, .config = PERF_COUNT_HW_INSTRUCTIONS},
+    {.type = PERF_TYPE_HARDWARE, .config = PERF_COUNT_HW_CACHE_REFERENCES},
+    {.type = PERF_TYPE_HARDWARE, .config = PERF_COUNT_HW_CACHE_MISSES},
+    {.type = PERF_TYPE_HARDWARE, .config = PERF_COUNT_HW_BRANCH_INSTRUCTIONS},
+    {.type = PERF_TYPE_HARDWARE, .config = PERF_COUNT_HW_BRANCH_MISSES},
+    {.type = PERF_TYPE_SOFTWARE, .config = PERF_COUNT_SW_PAGE_FAULTS},
+    {.type = PERF_TYPE_SOFTWARE, .config = PERF_COUNT_SW_CONTEXT_SWITCHES},
+}};
+
+// Counter of one event for one thread and the threads it starts later, created disabled.
+// Kernel-side counting is tried first and dropped when perf_event_paranoid forbids it
+int OpenCounter(const EventConfig& event, pid_t tid) {
+  for (int exclude_kernel = 0; exclude_kernel <= 1; exclude_kernel++) {
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.type = event.type;
+    attr.config = event.config;
+    attr.disabled = 1;
+    attr.inherit = 1;
+    attr.exclude_kernel = exclude_kernel;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    const auto fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, tid, -1, -1, 0));
+    if (fd >= 0) {
+      return fd;
+    }
+    if (errno != EACCES && errno != EPERM) {
+      return -1;
+    }
+  }
+  return -1;
+}
+
+std::vector<pid_t> ProcessThreads() {
+  std::vector<pid_t> tids;
+  std::error_code ec;
+  for (const auto& entry : std::filesystem::directory_iterator("/proc/self/task", ec)) {
+    tids.push_back(static_cast<pid_t>(std::stol(entry.path().filename().string())));
+  }
+  if (tids.empty()) {
+    tids.push_back(0);
+  }
+  return tids;
+}
+
+#endif
+
+}  // namespace
+
+bool ppc::core::PerfCounters::Any() const {
+  for (auto value : values) {
+    if (value >= 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+double ppc::core::PerfCounters::Ratio(Event numerator, Event denominator) const {
+  if (!Has(numerator) || !Has(denominator) || values[denominator] == 0) {
+    return -1.0;
+  }
+  return static_cast<double>(values[numerator]) / static_cast<double>(values[denominator]);
+}
+
+const char* ppc::core::PerfCounters::EventName(Event event) {
+  switch (event) {
+    case kCycles:
+      return "cycles";
+    case kInstructions:
+      return "instructions";
+    case kLlcReferences:
+      return "llc_references";
+    case kLlcMisses:
+      return "llc_misses";
+    case kBranches:
+      return "branches";
+    case kBranchMisses:
+      return "branch_misses";
+    case kPageFaults:
+      return "page_faults";
+    case kContextSwitches:
+      return "context_switches";
+    case kNumEvents:
+      break;
+  }
+  return "unknown";
+}
+
+ppc::core::PerfCounterGroup::PerfCounterGroup() { AttachNewThreads(); }
+
+void ppc::core::PerfCounterGroup::AttachNewThreads() {
+#ifdef __linux__
+  for (auto tid : ProcessThreads()) {
+    if (std::find(threads_.begin(), threads_.end(), tid) != threads_.end()) {
+      continue;
+    }
+    threads_.push_back(tid);
+    for (int event = 0; event < PerfCounters::kNumEvents; event++) {
+      const int fd = OpenCounter(kEventConfigs[event], tid);
+      if (fd < 0) {
+        continue;
+      }
+      counters_.push_back({.event = static_cast<PerfCounters::Event>(event), .fd = fd});
+    }
+  }
+#endif
+}
+
+ppc::core::PerfCounterGroup::~PerfCounterGroup() {
+#ifdef __linux__
+  for (const auto& counter : counters_) {
+    close(counter.fd);
+  }
+#endif
+}
+
+bool ppc::core::PerfCounterGroup::EnabledByEnvironment() {
+#ifdef __linux__
+  const char* value = std::getenv("PPC_PERF_COUNTERS");
+  return value != nullptr && std::string(value) != "" && std::string(value) != "0";
+#else
+  return false;
+#endif
+}
+
+void ppc::core::PerfCounterGroup::Start() {
+  AttachNewThreads();
+#ifdef __linux__
+  for (const auto& counter : counters_) {
+    ioctl(counter.fd, PERF_EVENT_IOC_RESET, 0);
+  }
+  for (const auto& counter : counters_) {
+    ioctl(counter.fd, PERF_EVENT_IOC_ENABLE, 0);
+  }
+#endif
+}
+
+void ppc::core::PerfCounterGroup::Stop() {
+#ifdef __linux__
+  for (const auto& counter : counters_) {
+    ioctl(counter.fd, PERF_EVENT_IOC_DISABLE, 0);
+  }
+#endif
+}
+
+ppc::core::PerfCounters ppc::core::PerfCounterGroup::Read() const {
+  PerfCounters counters;
+#ifdef __linux__
+  for (const auto& counter : counters_) {
+    // value, time enabled, time running
+    std::array<uint64_t, 3> data{};
+    if (read(counter.fd, data.data(), sizeof(data)) != static_cast<ssize_t>(sizeof(data))) {
+      continue;
+    }
+    auto value = static_cast<double>(data[0]);
+    if (data[2] != 0 && data[2] < data[1]) {
+      value *= static_cast<double>(data[1]) / static_cast<double>(data[2]);
+    }
+    auto& total = counters.values[counter.event];
+    total = (total < 0 ? 0 : total) + static_cast<int64_t>(value);
+  }
+#endif
+  return counters;
+}
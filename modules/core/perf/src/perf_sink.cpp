@@ -0,0 +1,269 @@
+#include "core/perf/include/perf_sink.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <ios>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+#include "core/perf/include/perf.hpp"
+#include "core/perf/include/perf_counters.hpp"
+#include "core/task/include/memory_profile.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+std::string GetEnv(const char* name) {
+#ifdef _WIN32
+  size_t len;
+  char value[1024];
+  errno_t err = getenv_s(&len, value, sizeof(value), name);
+  if (err != 0 || len == 0) {
+    return {};
+  }
+  return value;
+#else
+  const char* value = std::getenv(name);
+  return value != nullptr ? value : std::string{};
+#endif
+}
+
+std::string GetHostName() {
+#ifdef _WIN32
+  return GetEnv("COMPUTERNAME");
+#else
+  std::vector<char> name(256, '\0');
+  if (gethostname(name.data(), name.size() - 1) != 0) {
+    return {};
+  }
+  return name.data();
+#endif
+}
+
+std::string EscapeJson(const std::string& str) {
+  std::stringstream escaped;
+  for (char c : str) {
+    switch (c) {
+      case '"':
+        escaped << "\\\"";
+        break;
+      case '\\':
+        escaped << "\\\\";
+        break;
+      case '\n':
+        escaped << "\\n";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          escaped << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+        } else {
+          escaped << c;
+        }
+    }
+  }
+  return escaped.str();
+}
+
+std::string EscapeCsv(const std::string& str) {
+  if (str.find_first_of(",\"\n") == std::string::npos) {
+    return str;
+  }
+  std::string escaped = "\"";
+  for (char c : str) {
+    if (c == '"') {
+      escaped += '"';
+    }
+    escaped += c;
+  }
+  return escaped + "\"";
+}
+
+// Counter columns in CSV and JSON order, unavailable values are written as empty/null
+std::vector<std::pair<std::string, std::string>> CounterFields(const ppc::core::PerfCounters& counters) {
+  using Counters = ppc::core::PerfCounters;
+  std::vector<std::pair<std::string, std::string>> fields;
+  for (int event = 0; event < Counters::kNumEvents; event++) {
+    const auto id = static_cast<Counters::Event>(event);
+    fields.emplace_back(Counters::EventName(id), counters.Has(id) ? std::to_string(counters.values[event]) : "");
+  }
+  auto ratio = [](double value) {
+    std::stringstream str;
+    str << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+    return value >= 0.0 ? str.str() : std::string{};
+  };
+  fields.emplace_back("ipc", ratio(counters.Ipc()));
+  fields.emplace_back("llc_miss_rate", ratio(counters.LlcMissRate()));
+  fields.emplace_back("branch_miss_rate", ratio(counters.BranchMissRate()));
+  return fields;
+}
+
+// Per-stage memory columns, empty for stages that were not profiled
+std::vector<std::pair<std::string, std::string>> MemoryFields(const ppc::core::MemoryProfile& memory) {
+  std::vector<std::pair<std::string, std::string>> fields;
+  for (size_t i = 0; i < memory.stages.size(); i++) {
+    const auto& stage = memory.stages[i];
+    const std::string prefix = std::string(ppc::core::MemoryProfile::kStageNames[i]) + "_";
+    auto value = [&](uint64_t v) { return stage.calls == 0 ? std::string{} : std::to_string(v); };
+    fields.emplace_back(prefix + "allocations", value(stage.allocations));
+    fields.emplace_back(prefix + "allocated_bytes", value(stage.allocated_bytes));
+    fields.emplace_back(prefix + "peak_rss_delta_bytes", value(stage.peak_rss_delta_bytes));
+  }
+  return fields;
+}
+
+}  // namespace
+
+ppc::core::PerfResultSink::PerfResultSink(std::string path, Format format) : path_(std::move(path)), format_(format) {}
+
+std::optional<ppc::core::PerfResultSink> ppc::core::PerfResultSink::FromEnvironment() {
+  std::string path = GetEnv("PPC_PERF_RESULTS");
+  if (path.empty()) {
+    return std::nullopt;
+  }
+  auto format = std::filesystem::path(path).extension() == ".csv" ? Format::kCsv : Format::kJson;
+  return PerfResultSink(std::move(path), format);
+}
+
+ppc::core::PerfRecord ppc::core::PerfResultSink::MakeRecord(const std::string& relative_path,
+                                                            const std::string& type_of_running,
+                                                            const PerfResults& perf_results) {
+  PerfRecord record;
+  std::vector<std::string> parts;
+  std::stringstream path_stream(relative_path);
+  std::string part;
+  while (std::getline(path_stream, part, '/')) {
+    std::stringstream sub_stream(part);
+    while (std::getline(sub_stream, part, '\\')) {
+      if (!part.empty()) {
+        parts.push_back(part);
+      }
+    }
+  }
+  if (!parts.empty()) {
+    record.task_id = parts.back();
+  }
+  if (parts.size() > 1) {
+    record.technology = parts[parts.size() - 2];
+  }
+  record.type_of_running = type_of_running;
+  record.num_threads = ppc::util::GetPPCNumThreads();
+  record.input_size = perf_results.input_size;
+  record.status = perf_results.time_sec < PerfResults::kMaxTime ? "ok" : "timeout";
+  record.host = GetHostName();
+  record.hardware_concurrency = std::thread::hardware_concurrency();
+  record.results = perf_results;
+  return record;
+}
+
+std::string ppc::core::PerfResultSink::ToJson(const PerfRecord& record) {
+  const auto& res = record.results;
+  std::stringstream json;
+  json << std::setprecision(std::numeric_limits<double>::max_digits10);
+  json << "{\"task_id\":\"" << EscapeJson(record.task_id) << "\"";
+  json << ",\"technology\":\"" << EscapeJson(record.technology) << "\"";
+  json << ",\"type_of_running\":\"" << EscapeJson(record.type_of_running) << "\"";
+  json << ",\"num_threads\":" << record.num_threads;
+  json << ",\"input_size\":" << record.input_size;
+  json << ",\"status\":\"" << EscapeJson(record.status) << "\"";
+  json << ",\"time_sec\":" << res.time_sec;
+  json << ",\"runs\":" << res.samples.size();
+  json << ",\"warmup\":" << res.num_warmup;
+  json << ",\"min_sec\":" << res.min_sec;
+  json << ",\"median_sec\":" << res.median_sec;
+  json << ",\"mean_sec\":" << res.mean_sec;
+  json << ",\"p95_sec\":" << res.p95_sec;
+  json << ",\"p99_sec\":" << res.p99_sec;
+  json << ",\"max_sec\":" << res.max_sec;
+  json << ",\"stddev_sec\":" << res.stddev_sec;
+  json << ",\"ci95_sec\":" << res.ci95_sec;
+  json << ",\"items\":" << res.num_items;
+  json << ",\"failed_items\":" << res.num_failed_items;
+  json << ",\"throughput_items_per_sec\":" << res.throughput_items_per_sec;
+  json << ",\"counters\":{";
+  const auto counter_fields = CounterFields(res.counters);
+  for (size_t i = 0; i < counter_fields.size(); i++) {
+    const auto& [name, value] = counter_fields[i];
+    json << (i == 0 ? "" : ",") << "\"" << name << "\":" << (value.empty() ? "null" : value);
+  }
+  json << "}";
+  json << ",\"memory\":{";
+  const auto memory_fields = MemoryFields(res.memory);
+  for (size_t i = 0; i < memory_fields.size(); i++) {
+    const auto& [name, value] = memory_fields[i];
+    json << (i == 0 ? "" : ",") << "\"" << name << "\":" << (value.empty() ? "null" : value);
+  }
+  json << "}";
+  json << ",\"samples\":[";
+  for (size_t i = 0; i < res.samples.size(); i++) {
+    json << (i == 0 ? "" : ",") << res.samples[i];
+  }
+  json << "]";
+  json << ",\"host\":\"" << EscapeJson(record.host) << "\"";
+  json << ",\"hardware_concurrency\":" << record.hardware_concurrency;
+  json << "}";
+  return json.str();
+}
+
+std::string ppc::core::PerfResultSink::CsvHeader() {
+  std::string header =
+      "task_id,technology,type_of_running,num_threads,input_size,status,time_sec,runs,warmup,"
+      "min_sec,median_sec,mean_sec,p95_sec,p99_sec,max_sec,stddev_sec,ci95_sec,items,failed_items,"
+      "throughput_items_per_sec,";
+  for (const auto& field : CounterFields(PerfCounters{})) {
+    header += field.first + ",";
+  }
+  for (const auto& field : MemoryFields(MemoryProfile{})) {
+    header += field.first + ",";
+  }
+  return header + "host,hardware_concurrency";
+}
+
+std::string ppc::core::PerfResultSink::ToCsv(const PerfRecord& record) {
+  const auto& res = record.results;
+  std::stringstream csv;
+  csv << std::setprecision(std::numeric_limits<double>::max_digits10);
+  csv << EscapeCsv(record.task_id) << ',' << EscapeCsv(record.technology) << ',';
+  csv << EscapeCsv(record.type_of_running) << ',' << record.num_threads << ',' << record.input_size << ',';
+  csv << EscapeCsv(record.status) << ',' << res.time_sec << ',' << res.samples.size() << ',' << res.num_warmup << ',';
+  csv << res.min_sec << ',' << res.median_sec << ',' << res.mean_sec << ',' << res.p95_sec << ',';
+  csv << res.p99_sec << ',' << res.max_sec << ',' << res.stddev_sec << ',' << res.ci95_sec << ',';
+  csv << res.num_items << ',' << res.num_failed_items << ',' << res.throughput_items_per_sec << ',';
+  for (const auto& field : CounterFields(res.counters)) {
+    csv << field.second << ',';
+  }
+  for (const auto& field : MemoryFields(res.memory)) {
+    csv << field.second << ',';
+  }
+  csv << EscapeCsv(record.host) << ',' << record.hardware_concurrency;
+  return csv.str();
+}
+
+void ppc::core::PerfResultSink::Write(const PerfRecord& record) const {
+  std::error_code ec;
+  const bool needs_header = format_ == Format::kCsv && (!std::filesystem::exists(path_, ec) ||
+                                                        std::filesystem::file_size(path_, ec) == 0);
+  std::ofstream out(path_, std::ios::app);
+  if (!out) {
+    throw std::runtime_error("Cannot open perf results file: " + path_);
+  }
+  if (needs_header) {
+    out << CsvHeader() << '\n';
+  }
+  out << (format_ == Format::kCsv ? ToCsv(record) : ToJson(record)) << '\n';
+}
@@ -0,0 +1,168 @@
+#include "core/perf/include/scaling.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+#include "core/util/include/util.hpp"
+
+namespace {
+
+std::vector<int> DefaultThreadCounts() {
+  const int max_threads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  std::vector<int> counts;
+  for (int threads = 1; threads < max_threads; threads *= 2) {
+    counts.push_back(threads);
+  }
+  counts.push_back(max_threads);
+  return counts;
+}
+
+const char* KindName(ppc::core::ScalingCurve::Kind kind) {
+  return kind == ppc::core::ScalingCurve::kStrong ? "scaling_strong" : "scaling_weak";
+}
+
+}  // namespace
+
+ppc::core::ScalingStudy::ScalingStudy(TaskFactory task_factory, ScalingAttr scaling_attr)
+    : task_factory_(std::move(task_factory)), scaling_attr_(std::move(scaling_attr)) {
+  if (scaling_attr_.thread_counts.empty()) {
+    scaling_attr_.thread_counts = DefaultThreadCounts();
+  }
+  if (!std::ranges::is_sorted(scaling_attr_.thread_counts) || scaling_attr_.thread_counts.front() < 1) {
+    throw std::invalid_argument("ScalingStudy: thread counts must be positive and increasing");
+  }
+  if (!scaling_attr_.set_num_threads) {
+    uses_global_pool_ = true;
+    scaling_attr_.set_num_threads = [](int num_threads) {
+      ppc::util::SetPPCNumThreads(num_threads);
+      ThreadPool::Global().SetConcurrency(num_threads);
+    };
+  }
+}
+
+std::vector<ppc::core::ScalingCurve> ppc::core::ScalingStudy::StrongScaling() const {
+  return Sweep(ScalingCurve::kStrong);
+}
+
+std::vector<ppc::core::ScalingCurve> ppc::core::ScalingStudy::WeakScaling() const {
+  return Sweep(ScalingCurve::kWeak);
+}
+
+std::vector<ppc::core::ScalingCurve> ppc::core::ScalingStudy::Sweep(ScalingCurve::Kind kind) const {
+  const int saved_threads = ppc::util::GetPPCNumThreads();
+  // The global pool is created for the largest count, smaller counts only limit its concurrency
+  ppc::util::SetPPCNumThreads(scaling_attr_.thread_counts.back());
+  const int pool_threads = ThreadPool::Global().NumThreads();
+  ppc::util::SetPPCNumThreads(saved_threads);
+  // SetConcurrency caps at the pool size, so a pool created earlier with fewer threads would
+  // silently run the larger points on fewer threads than they report
+  if (uses_global_pool_ && pool_threads < scaling_attr_.thread_counts.back()) {
+    throw std::runtime_error("ScalingStudy: the global thread pool has " + std::to_string(pool_threads) +
+                             " threads, fewer than the " + std::to_string(scaling_attr_.thread_counts.back()) +
+                             " to sweep");
+  }
+
+  std::vector<ScalingCurve> curves;
+  try {
+    for (auto input_size : scaling_attr_.input_sizes) {
+      ScalingCurve curve;
+      curve.kind = kind;
+      curve.input_size = input_size;
+      for (int num_threads : scaling_attr_.thread_counts) {
+        const uint64_t total_size = kind == ScalingCurve::kStrong ? input_size : input_size * num_threads;
+        scaling_attr_.set_num_threads(num_threads);
+        const double time_sec = Measure(total_size);
+        curve.points.push_back({.num_threads = num_threads, .input_size = total_size, .time_sec = time_sec});
+      }
+      Analyze(curve, scaling_attr_.min_efficiency, scaling_attr_.min_speedup_gain);
+      curves.push_back(std::move(curve));
+    }
+  } catch (...) {
+    scaling_attr_.set_num_threads(saved_threads);
+    throw;
+  }
+  scaling_attr_.set_num_threads(saved_threads);
+  return curves;
+}
+
+double ppc::core::ScalingStudy::Measure(uint64_t input_size) const {
+  auto perf_attr = std::make_shared<PerfAttr>();
+  perf_attr->num_running = std::max<uint64_t>(scaling_attr_.num_running, 1);
+  perf_attr->num_warmup = scaling_attr_.num_warmup;
+  perf_attr->current_timer = scaling_attr_.current_timer;
+  auto perf_results = std::make_shared<PerfResults>();
+
+  Perf perf_analyzer(task_factory_(input_size));
+  perf_analyzer.TaskRun(perf_attr, perf_results);
+  return perf_results->median_sec;
+}
+
+void ppc::core::ScalingStudy::Analyze(ScalingCurve& curve, double min_efficiency, double min_speedup_gain) {
+  curve.saturation_threads = 0;
+  if (curve.points.empty()) {
+    return;
+  }
+  const auto& base = curve.points.front();
+  bool saturated = false;
+  for (size_t i = 0; i < curve.points.size(); i++) {
+    auto& point = curve.points[i];
+    const double p = point.num_threads;
+    // Relative to the base point: strong - the same work in less time, weak - p / p0 times
+    // the work in the same time
+    const double ratio = point.time_sec > 0.0 ? base.time_sec / point.time_sec : 0.0;
+    point.speedup = (curve.kind == ScalingCurve::kWeak ? p : base.num_threads) * ratio;
+    point.efficiency = point.speedup / p;
+    point.serial_fraction =
+        p > 1.0 && point.speedup > 0.0 ? ((1.0 / point.speedup) - (1.0 / p)) / (1.0 - (1.0 / p)) : 0.0;
+
+    const bool scales = i == 0 || (point.efficiency >= min_efficiency &&
+                                   point.speedup >= curve.points[i - 1].speedup * (1.0 + min_speedup_gain));
+    if (!saturated && scales) {
+      curve.saturation_threads = point.num_threads;
+    }
+    saturated = saturated || !scales;
+  }
+}
+
+void ppc::core::ScalingStudy::Print(const std::string& name, const std::vector<ScalingCurve>& curves) {
+  for (const auto& curve : curves) {
+    for (const auto& point : curve.points) {
+      std::stringstream line;
+      line << name << ":" << KindName(curve.kind) << ":" << curve.input_size << ":";
+      line << " threads=" << point.num_threads << " input_size=" << point.input_size;
+      line << std::scientific << std::setprecision(4) << " time=" << point.time_sec;
+      line << std::fixed << " speedup=" << point.speedup << " efficiency=" << point.efficiency;
+      line << " serial_fraction=" << point.serial_fraction;
+      std::cout << line.str() << '\n';
+    }
+    std::cout << name << ":" << KindName(curve.kind) << ":" << curve.input_size
+              << ": saturation_threads=" << curve.saturation_threads << '\n';
+  }
+}
+
+std::string ppc::core::ScalingStudy::ToCsv(const std::string& name, const std::vector<ScalingCurve>& curves) {
+  std::stringstream csv;
+  csv << std::setprecision(std::numeric_limits<double>::max_digits10);
+  csv << "name,kind,base_input_size,num_threads,input_size,time_sec,speedup,efficiency,serial_fraction,"
+         "saturation_threads\n";
+  for (const auto& curve : curves) {
+    for (const auto& point : curve.points) {
+      csv << name << ',' << KindName(curve.kind) << ',' << curve.input_size << ',' << point.num_threads << ',';
+      csv << point.input_size << ',' << point.time_sec << ',' << point.speedup << ',' << point.efficiency << ',';
+      csv << point.serial_fraction << ',' << curve.saturation_threads << '\n';
+    }
+  }
+  return csv.str();
+}
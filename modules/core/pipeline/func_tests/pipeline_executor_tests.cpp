@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/pipeline/include/pipeline_executor.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+// Sums its input; every stage sleeps for stage_delay and live tasks are tracked
+class SumTask : public ppc::core::Task {
+ public:
+  struct Probe {
+    std::chrono::milliseconds stage_delay{0};
+    std::atomic<int> live = 0;
+    std::atomic<int> max_live = 0;
+    bool throw_in_run = false;
+  };
+
+  SumTask(const ppc::core::TaskDataPtr &task_data, Probe &probe) : Task(task_data), probe_(probe) {
+    int live = ++probe_.live;
+    int max_live = probe_.max_live;
+    while (live > max_live && !probe_.max_live.compare_exchange_weak(max_live, live)) {
+    }
+  }
+  SumTask(const SumTask &) = delete;
+  SumTask &operator=(const SumTask &) = delete;
+  SumTask(SumTask &&) = delete;
+  SumTask &operator=(SumTask &&) = delete;
+  ~SumTask() override { probe_.live--; }
+
+  bool ValidationImpl() override { return task_data->HasInput<int>(0) && task_data->HasOutput<int>(0); }
+
+  bool PreProcessingImpl() override {
+    std::this_thread::sleep_for(probe_.stage_delay);
+    input_ = task_data->GetInput<int>(0);
+    return true;
+  }
+
+  bool RunImpl() override {
+    std::this_thread::sleep_for(probe_.stage_delay);
+    if (probe_.throw_in_run) {
+      throw std::runtime_error("run failed");
+    }
+    for (int value : input_) {
+      sum_ += value;
+    }
+    return true;
+  }
+
+  bool PostProcessingImpl() override {
+    std::this_thread::sleep_for(probe_.stage_delay);
+    task_data->GetOutput<int>(0)[0] = sum_;
+    return true;
+  }
+
+ private:
+  Probe &probe_;
+  std::span<const int> input_;
+  int sum_ = 0;
+};
+
+struct Batch {
+  std::vector<std::vector<int>> inputs;
+  std::vector<int> outputs;
+  std::vector<ppc::core::TaskDataPtr> task_data;
+
+  Batch(std::size_t count, std::size_t size) : inputs(count), outputs(count, -1) {
+    for (std::size_t i = 0; i < count; i++) {
+      inputs[i].assign(size, static_cast<int>(i));
+      auto data = std::make_shared<ppc::core::TaskData>();
+      data->AddInput(inputs[i].data(), inputs[i].size());
+      data->AddOutput(&outputs[i], 1);
+      task_data.push_back(data);
+    }
+  }
+};
+
+ppc::core::PipelineExecutor MakeExecutor(SumTask::Probe &probe, ppc::core::PipelineAttr attr = {}) {
+  return {[&probe](ppc::core::TaskDataPtr task_data) { return std::make_shared<SumTask>(task_data, probe); },
+          std::move(attr)};
+}
+
+}  // namespace
+
+TEST(pipeline_executor_tests, processes_every_input) {
+  SumTask::Probe probe;
+  Batch batch(20, 100);
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  MakeExecutor(probe).Run(batch.task_data, perf_results);
+
+  for (std::size_t i = 0; i < batch.outputs.size(); i++) {
+    EXPECT_EQ(batch.outputs[i], static_cast<int>(i) * 100);
+  }
+  EXPECT_EQ(perf_results->type_of_running, ppc::core::PerfResults::kBatch);
+  EXPECT_EQ(perf_results->num_items, 20U);
+  EXPECT_EQ(perf_results->num_failed_items, 0U);
+  EXPECT_EQ(perf_results->samples.size(), 20U);
+  EXPECT_EQ(perf_results->input_size, 2000U);
+  EXPECT_GT(perf_results->throughput_items_per_sec, 0.0);
+  EXPECT_EQ(probe.live, 0);
+}
+
+TEST(pipeline_executor_tests, reads_stream_until_null) {
+  SumTask::Probe probe;
+  Batch batch(5, 10);
+  std::size_t next = 0;
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  MakeExecutor(probe).Run(
+      [&]() -> ppc::core::TaskDataPtr { return next < batch.task_data.size() ? batch.task_data[next++] : nullptr; },
+      perf_results);
+
+  EXPECT_EQ(perf_results->num_items, 5U);
+  EXPECT_EQ(batch.outputs[4], 40);
+}
+
+TEST(pipeline_executor_tests, overlaps_stages) {
+  SumTask::Probe probe;
+  probe.stage_delay = std::chrono::milliseconds(10);
+  Batch batch(10, 10);
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  MakeExecutor(probe).Run(batch.task_data, perf_results);
+
+  // 30 ms of stages per input; the overlap shows as several inputs in flight at once, not as wall-clock
+  // time, which a loaded or instrumented run cannot bound
+  EXPECT_EQ(perf_results->num_items, 10U);
+  EXPECT_GE(perf_results->min_sec, 0.03);
+  EXPECT_GE(probe.max_live, 2);
+}
+
+TEST(pipeline_executor_tests, respects_in_flight_limit) {
+  SumTask::Probe probe;
+  probe.stage_delay = std::chrono::milliseconds(1);
+  Batch batch(16, 10);
+  ppc::core::PipelineAttr attr;
+  attr.max_in_flight = 2;
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  MakeExecutor(probe, attr).Run(batch.task_data, perf_results);
+
+  EXPECT_EQ(perf_results->num_items, 16U);
+  EXPECT_LE(probe.max_live, 2);
+}
+
+TEST(pipeline_executor_tests, respects_memory_budget) {
+  SumTask::Probe probe;
+  probe.stage_delay = std::chrono::milliseconds(1);
+  Batch batch(16, 250);
+  const auto bytes = ppc::core::PipelineExecutor::BufferBytes(*batch.task_data[0]);
+  ASSERT_EQ(bytes, (250 + 1) * sizeof(int));
+  ppc::core::PipelineAttr attr;
+  attr.max_in_flight = 8;
+  attr.memory_budget_bytes = (2 * bytes) + 1;
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  MakeExecutor(probe, attr).Run(batch.task_data, perf_results);
+
+  EXPECT_EQ(perf_results->num_items, 16U);
+  EXPECT_LE(probe.max_live, 2);
+}
+
+TEST(pipeline_executor_tests, input_over_budget_runs_alone) {
+  SumTask::Probe probe;
+  Batch batch(4, 1000);
+  ppc::core::PipelineAttr attr;
+  attr.memory_budget_bytes = 16;
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  MakeExecutor(probe, attr).Run(batch.task_data, perf_results);
+
+  EXPECT_EQ(perf_results->num_items, 4U);
+  EXPECT_EQ(probe.max_live, 1);
+}
+
+TEST(pipeline_executor_tests, drops_invalid_inputs) {
+  SumTask::Probe probe;
+  Batch batch(6, 10);
+  batch.task_data[2]->output_slots.clear();
+  batch.task_data[2]->outputs.clear();
+  batch.task_data[2]->outputs_count.clear();
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  MakeExecutor(probe).Run(batch.task_data, perf_results);
+
+  EXPECT_EQ(perf_results->num_items, 5U);
+  EXPECT_EQ(perf_results->num_failed_items, 1U);
+  EXPECT_EQ(batch.outputs[2], -1);
+  EXPECT_EQ(batch.outputs[5], 50);
+}
+
+TEST(pipeline_executor_tests, rethrows_stage_exception) {
+  SumTask::Probe probe;
+  probe.throw_in_run = true;
+  Batch batch(8, 10);
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  EXPECT_THROW(MakeExecutor(probe).Run(batch.task_data, perf_results), std::runtime_error);
+  EXPECT_EQ(perf_results->num_items, 0U);
+  EXPECT_EQ(probe.live, 0);
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+struct PipelineAttr {
+  // upper bound on inputs between Validation and the end of PostProcessing
+  std::size_t max_in_flight = 3;
+  // upper bound on the buffer bytes of in-flight inputs (see BufferBytes), 0 - unlimited.
+  // An input larger than the whole budget is still processed, alone
+  std::size_t memory_budget_bytes = 0;
+  std::function<double()> current_timer = [] {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  };
+};
+
+// Streams inputs through one task instance per input, overlapping the stages of
+// different inputs: Validation + PreProcessing of input N+1 and PostProcessing of
+// input N-1 run while Run() works on input N. Each stage has its own thread and
+// handles inputs in arrival order, so every task still sees the usual call order
+class PipelineExecutor {
+ public:
+  using TaskFactory = std::function<std::shared_ptr<Task>(TaskDataPtr)>;
+  // Returns the next input, nullptr at the end of the stream
+  using Source = std::function<TaskDataPtr()>;
+
+  PipelineExecutor(TaskFactory task_factory, PipelineAttr pipeline_attr);
+
+  // Pull inputs until the source is exhausted and wait for all of them. Per-input latency
+  // goes to samples, throughput to throughput_items_per_sec. Inputs whose stage returns
+  // false are dropped and counted in num_failed_items; the first exception thrown by a
+  // stage stops admission and is rethrown once the pipeline drains
+  void Run(const Source& source, const std::shared_ptr<PerfResults>& perf_results) const;
+  void Run(const std::vector<TaskDataPtr>& batch, const std::shared_ptr<PerfResults>& perf_results) const;
+
+  // Bytes of the input and output buffers; buffers without a typed slot count one byte per element
+  static std::size_t BufferBytes(const TaskData& task_data);
+
+ private:
+  TaskFactory task_factory_;
+  PipelineAttr pipeline_attr_;
+};
+
+}  // namespace ppc::core
@@ -0,0 +1,247 @@
+#include "core/pipeline/include/pipeline_executor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+struct Item {
+  ppc::core::TaskDataPtr task_data;
+  std::shared_ptr<ppc::core::Task> task;
+  std::size_t bytes = 0;
+  double start = 0.0;
+};
+
+// Hand-off queue between two stages, its size is bounded by admission
+class Channel {
+ public:
+  void Push(Item item) {
+    {
+      std::lock_guard lock(mutex_);
+      items_.push_back(std::move(item));
+    }
+    ready_.notify_one();
+  }
+
+  void Close() {
+    {
+      std::lock_guard lock(mutex_);
+      closed_ = true;
+    }
+    ready_.notify_all();
+  }
+
+  // Next item in arrival order, nullopt once closed and empty
+  std::optional<Item> Pop() {
+    std::unique_lock lock(mutex_);
+    ready_.wait(lock, [&] { return closed_ || !items_.empty(); });
+    if (items_.empty()) {
+      return std::nullopt;
+    }
+    Item item = std::move(items_.front());
+    items_.pop_front();
+    return item;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable ready_;
+  std::deque<Item> items_;
+  bool closed_ = false;
+};
+
+// Count and bytes of admitted inputs that have not left the pipeline yet
+class Budget {
+ public:
+  Budget(std::size_t max_items, std::size_t max_bytes)
+      : max_items_(std::max<std::size_t>(max_items, 1)), max_bytes_(max_bytes) {}
+
+  void AcquireSlot() {
+    std::unique_lock lock(mutex_);
+    released_.wait(lock, [&] { return items_ < max_items_; });
+    items_++;
+  }
+
+  // Called after AcquireSlot, once the size of the input is known
+  void AcquireBytes(std::size_t bytes) {
+    std::unique_lock lock(mutex_);
+    released_.wait(lock, [&] { return max_bytes_ == 0 || bytes_ + bytes <= max_bytes_ || items_ == 1; });
+    bytes_ += bytes;
+  }
+
+  void Release(std::size_t bytes) {
+    {
+      std::lock_guard lock(mutex_);
+      items_--;
+      bytes_ -= bytes;
+    }
+    released_.notify_all();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable released_;
+  std::size_t max_items_;
+  std::size_t max_bytes_;
+  std::size_t items_ = 0;
+  std::size_t bytes_ = 0;
+};
+
+std::size_t SlotBytes(const std::vector<std::uint32_t>& counts, const std::vector<ppc::core::BufferSlot>& slots) {
+  std::size_t total = 0;
+  for (std::size_t i = 0; i < counts.size(); i++) {
+    if (i < slots.size() && slots[i].IsTyped()) {
+      const auto& slot = slots[i];
+      total += slot.extent == 0 ? 0 : (((slot.extent - 1) * slot.stride) + 1) * slot.element_size;
+    } else {
+      total += counts[i];
+    }
+  }
+  return total;
+}
+
+}  // namespace
+
+ppc::core::PipelineExecutor::PipelineExecutor(TaskFactory task_factory, PipelineAttr pipeline_attr)
+    : task_factory_(std::move(task_factory)), pipeline_attr_(std::move(pipeline_attr)) {}
+
+std::size_t ppc::core::PipelineExecutor::BufferBytes(const TaskData& task_data) {
+  return SlotBytes(task_data.inputs_count, task_data.input_slots) +
+         SlotBytes(task_data.outputs_count, task_data.output_slots);
+}
+
+void ppc::core::PipelineExecutor::Run(const std::vector<TaskDataPtr>& batch,
+                                      const std::shared_ptr<PerfResults>& perf_results) const {
+  std::size_t next = 0;
+  Run([&]() -> TaskDataPtr { return next < batch.size() ? batch[next++] : nullptr; }, perf_results);
+}
+
+void ppc::core::PipelineExecutor::Run(const Source& source, const std::shared_ptr<PerfResults>& perf_results) const {
+  const auto& timer = pipeline_attr_.current_timer;
+  Budget budget(pipeline_attr_.max_in_flight, pipeline_attr_.memory_budget_bytes);
+  Channel to_run;
+  Channel to_post;
+
+  std::mutex results_mutex;
+  std::vector<double> latencies;
+  uint64_t num_failed = 0;
+  uint64_t input_size = 0;
+  std::exception_ptr error;
+  std::atomic<bool> stopped = false;
+
+  auto save_error = [&] {
+    std::lock_guard lock(results_mutex);
+    if (!error) {
+      error = std::current_exception();
+    }
+    stopped = true;
+  };
+  // Inputs in flight when a stage throws are dropped as failed
+  auto stage = [&](const Item& item, bool (Task::*step)()) {
+    if (stopped) {
+      return false;
+    }
+    try {
+      return ((*item.task).*step)();
+    } catch (...) {
+      save_error();
+      return false;
+    }
+  };
+  // The task and its buffers are released before the next input is admitted
+  auto finish = [&](Item& item, bool ok) {
+    {
+      std::lock_guard lock(results_mutex);
+      if (ok) {
+        latencies.push_back(timer() - item.start);
+      } else {
+        num_failed++;
+      }
+    }
+    item.task.reset();
+    item.task_data.reset();
+    budget.Release(item.bytes);
+  };
+
+  std::thread run_stage([&] {
+    while (auto item = to_run.Pop()) {
+      if (stage(*item, &Task::Run)) {
+        to_post.Push(std::move(*item));
+      } else {
+        finish(*item, false);
+      }
+    }
+    to_post.Close();
+  });
+  std::thread post_stage([&] {
+    while (auto item = to_post.Pop()) {
+      const bool ok = stage(*item, &Task::PostProcessing);
+      finish(*item, ok);
+    }
+  });
+
+  const double begin = timer();
+  while (!stopped) {
+    budget.AcquireSlot();
+    Item item;
+    try {
+      item.task_data = source();
+    } catch (...) {
+      save_error();
+    }
+    if (!item.task_data) {
+      budget.Release(0);
+      break;
+    }
+    item.bytes = BufferBytes(*item.task_data);
+    budget.AcquireBytes(item.bytes);
+    item.start = timer();
+    input_size += std::accumulate(item.task_data->inputs_count.begin(), item.task_data->inputs_count.end(),
+                                  uint64_t{0});
+    try {
+      item.task = task_factory_(item.task_data);
+      item.task_data->state_of_testing = TaskData::StateOfTesting::kPerf;
+    } catch (...) {
+      save_error();
+    }
+    if (item.task && stage(item, &Task::Validation) && stage(item, &Task::PreProcessing)) {
+      to_run.Push(std::move(item));
+    } else {
+      finish(item, false);
+    }
+  }
+  to_run.Close();
+  run_stage.join();
+  post_stage.join();
+  const double end = timer();
+
+  perf_results->type_of_running = PerfResults::TypeOfRunning::kBatch;
+  perf_results->input_size = input_size;
+  perf_results->num_warmup = 0;
+  perf_results->samples = std::move(latencies);
+  perf_results->num_items = perf_results->samples.size();
+  perf_results->num_failed_items = num_failed;
+  perf_results->time_sec = end - begin;
+  perf_results->throughput_items_per_sec =
+      perf_results->time_sec > 0.0 ? static_cast<double>(perf_results->num_items) / perf_results->time_sec : 0.0;
+  perf_results->ComputeStatistics();
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
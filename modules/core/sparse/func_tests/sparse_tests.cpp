@@ -0,0 +1,338 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/sparse/include/sparse_kernels.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+template <class T>
+T RandomValue(std::mt19937 &gen) {
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  if constexpr (std::is_same_v<T, std::complex<double>>) {
+    const double re = value(gen);
+    return {re, value(gen)};
+  } else {
+    return static_cast<T>(value(gen));
+  }
+}
+
+// about density * rows * cols entries in random order, some of them at the same coordinates
+template <class T, class I>
+ppc::sparse::Coo<T, I> RandomCoo(std::size_t rows, std::size_t cols, double density, uint32_t seed) {
+  std::mt19937 gen(seed);
+  const auto count = static_cast<std::size_t>(density * static_cast<double>(rows * cols));
+  std::uniform_int_distribution<std::size_t> row(0, rows - 1);
+  std::uniform_int_distribution<std::size_t> col(0, cols - 1);
+  ppc::sparse::Coo<T, I> coo{.rows = rows, .cols = cols, .row_idx = {}, .col_idx = {}, .values = {}};
+  for (std::size_t e = 0; e < count; e++) {
+    coo.row_idx.push_back(static_cast<I>(row(gen)));
+    coo.col_idx.push_back(static_cast<I>(col(gen)));
+    coo.values.push_back(RandomValue<T>(gen));
+  }
+  return coo;
+}
+
+template <class T, class I>
+std::vector<T> Dense(const ppc::sparse::Coo<T, I> &coo) {
+  std::vector<T> dense(coo.rows * coo.cols);
+  for (std::size_t e = 0; e < coo.NonZeros(); e++) {
+    dense[(static_cast<std::size_t>(coo.row_idx[e]) * coo.cols) + static_cast<std::size_t>(coo.col_idx[e])] +=
+        coo.values[e];
+  }
+  return dense;
+}
+
+template <class Matrix>
+auto Dense(const Matrix &matrix) {
+  std::vector<std::remove_cvref_t<decltype(matrix.values.front())>> dense(matrix.rows * matrix.cols);
+  matrix.ToDense(dense.data());
+  return dense;
+}
+
+template <class T>
+std::vector<T> DenseProduct(const std::vector<T> &a, const std::vector<T> &b, std::size_t m, std::size_t k,
+                            std::size_t n) {
+  std::vector<T> c(m * n);
+  for (std::size_t i = 0; i < m; i++) {
+    for (std::size_t p = 0; p < k; p++) {
+      for (std::size_t j = 0; j < n; j++) {
+        c[(i * n) + j] += a[(i * k) + p] * b[(p * n) + j];
+      }
+    }
+  }
+  return c;
+}
+
+template <class T>
+void ExpectNear(const std::vector<T> &actual, const std::vector<T> &expected, double tolerance) {
+  ASSERT_EQ(actual.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); i++) {
+    EXPECT_LE(std::abs(actual[i] - expected[i]), tolerance) << "entry " << i;
+  }
+}
+
+template <class Matrix>
+void ExpectSame(const Matrix &actual, const Matrix &expected) {
+  EXPECT_EQ(actual.rows, expected.rows);
+  EXPECT_EQ(actual.cols, expected.cols);
+  EXPECT_EQ(actual.View().major, expected.View().major);
+  const auto a = actual.View();
+  const auto e = expected.View();
+  EXPECT_EQ(std::vector(a.ptr, a.ptr + a.major + 1), std::vector(e.ptr, e.ptr + e.major + 1));
+  EXPECT_EQ(std::vector(a.idx, a.idx + actual.NonZeros()), std::vector(e.idx, e.idx + expected.NonZeros()));
+  EXPECT_EQ(actual.values, expected.values);
+}
+
+// Chunks handed out dynamically by a pool, so the chunk-to-thread mapping changes between runs
+ppc::sparse::ChunkRunner PoolRunner(ppc::core::ThreadPool &pool) {
+  return [&pool](std::size_t count, const std::function<void(std::size_t)> &body) {
+    pool.ParallelFor(
+        0, static_cast<int64_t>(count),
+        [&body](int64_t begin, int64_t end) {
+          for (int64_t chunk = begin; chunk < end; chunk++) {
+            body(static_cast<std::size_t>(chunk));
+          }
+        },
+        ppc::core::ThreadPool::kDynamic, 1);
+  };
+}
+
+template <class T, class I>
+void CheckConversions() {
+  // small enough for a single sort chunk, and large enough for several
+  for (const auto &[n, density] : {std::pair<std::size_t, double>{37, 0.2}, {700, 0.08}}) {
+    const auto coo = RandomCoo<T, I>(n, n + 13, density, 1);
+    const auto expected = Dense(coo);
+    const auto csr = ppc::sparse::ToCsr(coo);
+    const auto csc = ppc::sparse::ToCsc(coo);
+    EXPECT_TRUE(csr.IsValid());
+    EXPECT_TRUE(csc.IsValid());
+    ExpectNear(Dense(csr), expected, 1e-12);
+    ExpectNear(Dense(csc), expected, 1e-12);
+
+    ExpectSame(ppc::sparse::ToCsc(csr), csc);
+    ExpectSame(ppc::sparse::ToCsr(csc), csr);
+    ExpectSame(ppc::sparse::ToCsr(ppc::sparse::ToCoo(csr)), csr);
+    ExpectSame(ppc::sparse::ToCsc(ppc::sparse::ToCoo(csc)), csc);
+    ExpectSame(ppc::sparse::Csr<T, I>::FromDense(expected.data(), csr.rows, csr.cols), csr);
+    ExpectSame(ppc::sparse::Csc<T, I>::FromDense(expected.data(), csc.rows, csc.cols), csc);
+  }
+}
+
+template <class T, class I>
+void CheckTranspose() {
+  const auto csr = ppc::sparse::ToCsr(RandomCoo<T, I>(300, 170, 0.05, 2));
+  const auto dense = Dense(csr);
+  std::vector<T> transposed(dense.size());
+  for (std::size_t i = 0; i < csr.rows; i++) {
+    for (std::size_t j = 0; j < csr.cols; j++) {
+      transposed[(j * csr.rows) + i] = dense[(i * csr.cols) + j];
+    }
+  }
+  const auto t = ppc::sparse::Transpose(csr);
+  EXPECT_EQ(t.rows, csr.cols);
+  EXPECT_TRUE(t.IsValid());
+  EXPECT_EQ(Dense(t), transposed);
+  ExpectSame(ppc::sparse::Transpose(t), csr);
+
+  const auto csc = ppc::sparse::ToCsc(csr);
+  EXPECT_EQ(Dense(ppc::sparse::Transpose(csc)), transposed);
+}
+
+template <class T, class I>
+void CheckKernels() {
+  const auto a = ppc::sparse::ToCsr(RandomCoo<T, I>(120, 90, 0.06, 3));
+  const auto b = ppc::sparse::ToCsr(RandomCoo<T, I>(90, 140, 0.06, 4));
+  const auto da = Dense(a);
+  const auto db = Dense(b);
+
+  std::mt19937 gen(5);
+  std::vector<T> x(a.cols);
+  for (auto &value : x) {
+    value = RandomValue<T>(gen);
+  }
+  const auto expected_y = DenseProduct(da, x, a.rows, a.cols, 1);
+  std::vector<T> y(a.rows);
+  ppc::sparse::Multiply(a, x.data(), y.data());
+  ExpectNear(y, expected_y, 1e-5);
+  ppc::sparse::Multiply(ppc::sparse::ToCsc(a), x.data(), y.data());
+  ExpectNear(y, expected_y, 1e-5);
+
+  const auto expected_c = DenseProduct(da, db, a.rows, a.cols, b.cols);
+  const auto c = ppc::sparse::Multiply(a, b);
+  EXPECT_EQ(c.rows, a.rows);
+  EXPECT_EQ(c.cols, b.cols);
+  EXPECT_TRUE(c.IsValid());
+  ExpectNear(Dense(c), expected_c, 1e-5);
+  const auto c_csc = ppc::sparse::Multiply(ppc::sparse::ToCsc(a), ppc::sparse::ToCsc(b));
+  EXPECT_TRUE(c_csc.IsValid());
+  ExpectNear(Dense(c_csc), expected_c, 1e-5);
+  EXPECT_THROW(ppc::sparse::Multiply(a, a), std::invalid_argument);
+}
+
+// Transpose of the per-task CCS containers: a vector of entries per row, then concatenated
+ppc::sparse::Csc<double> VectorOfVectorsTranspose(const ppc::sparse::Csc<double> &a) {
+  std::vector<std::vector<double>> values(a.rows);
+  std::vector<std::vector<int>> indexes(a.rows);
+  for (std::size_t j = 0; j < a.cols; j++) {
+    for (int e = a.col_ptr[j]; e < a.col_ptr[j + 1]; e++) {
+      values[a.row_idx[e]].emplace_back(a.values[e]);
+      indexes[a.row_idx[e]].emplace_back(static_cast<int>(j));
+    }
+  }
+  ppc::sparse::Csc<double> t{.rows = a.cols, .cols = a.rows, .col_ptr = {0}, .row_idx = {}, .values = {}};
+  for (std::size_t i = 0; i < a.rows; i++) {
+    t.values.insert(t.values.end(), values[i].begin(), values[i].end());
+    t.row_idx.insert(t.row_idx.end(), indexes[i].begin(), indexes[i].end());
+    t.col_ptr.push_back(static_cast<int>(t.values.size()));
+  }
+  return t;
+}
+
+// Dense-to-CCS conversion of the per-task containers: every column read down the row-major matrix
+ppc::sparse::Csc<double> ColumnScanFromDense(const std::vector<double> &a, std::size_t rows, std::size_t cols) {
+  ppc::sparse::Csc<double> m{.rows = rows, .cols = cols, .col_ptr = {0}, .row_idx = {}, .values = {}};
+  for (std::size_t j = 0; j < cols; j++) {
+    for (std::size_t i = 0; i < rows; i++) {
+      if (a[(i * cols) + j] != 0.0) {
+        m.row_idx.push_back(static_cast<int>(i));
+        m.values.push_back(a[(i * cols) + j]);
+      }
+    }
+    m.col_ptr.push_back(static_cast<int>(m.values.size()));
+  }
+  return m;
+}
+
+}  // namespace
+
+TEST(sparse_tests, conversions_double_int) { CheckConversions<double, int>(); }
+
+TEST(sparse_tests, conversions_complex_int64) { CheckConversions<std::complex<double>, int64_t>(); }
+
+TEST(sparse_tests, transpose_double_int) { CheckTranspose<double, int>(); }
+
+TEST(sparse_tests, transpose_float_int64) { CheckTranspose<float, int64_t>(); }
+
+TEST(sparse_tests, kernels_double_int) { CheckKernels<double, int>(); }
+
+TEST(sparse_tests, kernels_float_int64) { CheckKernels<float, int64_t>(); }
+
+TEST(sparse_tests, kernels_complex_int) { CheckKernels<std::complex<double>, int>(); }
+
+TEST(sparse_tests, coo_duplicates_and_bounds) {
+  const ppc::sparse::Coo<double> coo{
+      .rows = 2, .cols = 3, .row_idx = {1, 0, 1, 1}, .col_idx = {2, 1, 0, 2}, .values = {1.0, 2.0, 3.0, 4.0}};
+  const auto csr = ppc::sparse::ToCsr(coo);
+  EXPECT_EQ(csr.row_ptr, (std::vector<int>{0, 1, 3}));
+  EXPECT_EQ(csr.col_idx, (std::vector<int>{1, 0, 2}));
+  EXPECT_EQ(csr.values, (std::vector<double>{2.0, 3.0, 5.0}));
+
+  auto outside = coo;
+  outside.col_idx[0] = 3;
+  EXPECT_THROW(ppc::sparse::ToCsr(outside), std::out_of_range);
+  outside.col_idx[0] = -1;
+  EXPECT_THROW(ppc::sparse::ToCsc(outside), std::out_of_range);
+}
+
+TEST(sparse_tests, index_type_limits) {
+  // int8_t indices: 200 columns do not fit, nor do 200 entries
+  const std::vector<double> wide(200, 1.0);
+  EXPECT_THROW((ppc::sparse::Csr<double, int8_t>::FromDense(wide.data(), 1, 200)), std::length_error);
+  EXPECT_THROW((ppc::sparse::Csr<double, int8_t>::FromDense(wide.data(), 2, 100)), std::length_error);
+  EXPECT_NO_THROW((ppc::sparse::Csr<double, int16_t>::FromDense(wide.data(), 2, 100)));
+}
+
+TEST(sparse_tests, results_do_not_depend_on_runner) {
+  const auto coo = RandomCoo<double, int64_t>(3000, 2500, 0.012, 6);
+  const auto csr = ppc::sparse::ToCsr(coo);
+  const auto csc = ppc::sparse::ToCsc(coo);
+  const auto transposed = ppc::sparse::Transpose(csr);
+  const auto product = ppc::sparse::Multiply(csr, transposed, {}, 1e-12);
+  std::vector<double> x(csr.cols, 1.0);
+  std::vector<double> y(csr.rows);
+  ppc::sparse::Multiply(csr, x.data(), y.data());
+  for (int threads : {2, 3, 8}) {
+    ppc::core::ThreadPool pool(threads);
+    const auto runner = PoolRunner(pool);
+    ExpectSame(ppc::sparse::ToCsr(coo, runner), csr);
+    ExpectSame(ppc::sparse::ToCsc(coo, runner), csc);
+    ExpectSame(ppc::sparse::ToCsc(csr, runner), csc);
+    ExpectSame(ppc::sparse::Transpose(csr, runner), transposed);
+    ExpectSame(ppc::sparse::Multiply(csr, transposed, runner, 1e-12), product);
+    std::vector<double> y_threads(csr.rows);
+    ppc::sparse::Multiply(csr, x.data(), y_threads.data(), runner);
+    EXPECT_EQ(y_threads, y) << threads;
+  }
+}
+
+TEST(sparse_tests, product_plan_balances_skewed_columns) {
+  // column j of B holds about kN / (j + 1) rows, so the first columns of C take most of the work
+  constexpr std::size_t kN = 4000;
+  std::mt19937 gen(9);
+  std::uniform_int_distribution<int> row(0, static_cast<int>(kN) - 1);
+  ppc::sparse::Coo<double> coo{.rows = kN, .cols = kN, .row_idx = {}, .col_idx = {}, .values = {}};
+  for (std::size_t j = 0; j < kN; j++) {
+    for (std::size_t e = 0; e < std::max<std::size_t>(kN / (j + 1), 2); e++) {
+      coo.row_idx.push_back(row(gen));
+      coo.col_idx.push_back(static_cast<int>(j));
+      coo.values.push_back(1.0);
+    }
+  }
+  const auto b = ppc::sparse::ToCsc(coo);
+  const auto a = ppc::sparse::ToCsc(RandomCoo<double, int>(kN, kN, 0.002, 10));
+  const auto plan = ppc::sparse::PlanProduct(b.View(), a.View());
+
+  ASSERT_EQ(plan.flops.size(), kN);
+  std::int64_t total = 0;
+  std::int64_t heaviest = 0;
+  for (std::size_t j = 0; j < kN; j++) {
+    std::int64_t flops = 0;
+    for (int e = b.col_ptr[j]; e < b.col_ptr[j + 1]; e++) {
+      flops += a.col_ptr[b.row_idx[e] + 1] - a.col_ptr[b.row_idx[e]];
+    }
+    ASSERT_EQ(plan.flops[j], flops) << j;
+    total += flops + 1;
+    heaviest = std::max(heaviest, flops + 1);
+  }
+  const std::size_t bins = plan.bins.size() - 1;
+  EXPECT_GE(bins, ppc::sparse::kMinProductBins);
+  EXPECT_EQ(plan.bins.front(), 0U);
+  EXPECT_EQ(plan.bins.back(), kN);
+  for (std::size_t bin = 0; bin < bins; bin++) {
+    ASSERT_LE(plan.bins[bin], plan.bins[bin + 1]);
+    std::int64_t weight = 0;
+    for (std::size_t j = plan.bins[bin]; j < plan.bins[bin + 1]; j++) {
+      weight += plan.flops[j] + 1;
+    }
+    // a bin overshoots its share by at most one column
+    EXPECT_LE(weight, (total / static_cast<std::int64_t>(bins)) + heaviest) << "bin " << bin;
+  }
+  // the heavy head of B is spread over many bins instead of filling the first of fixed-size chunks
+  EXPECT_GT(std::ranges::count_if(plan.bins, [](std::size_t bound) { return bound < 64; }), 4);
+}
+
+// The counting-sort transpose and the panel-wise dense conversion against the containers of the tasks
+TEST(sparse_tests, against_task_containers) {
+  constexpr std::size_t kN = 20000;
+  const auto a = ppc::sparse::ToCsc(RandomCoo<double, int>(kN, kN, 1e-4, 7));
+  ExpectSame(ppc::sparse::Transpose(a), VectorOfVectorsTranspose(a));
+
+  constexpr std::size_t kDense = 300;
+  const auto dense = Dense(ppc::sparse::ToCsc(RandomCoo<double, int>(kDense, kDense, 0.02, 8)));
+  ExpectSame(ppc::sparse::Csc<double>::FromDense(dense.data(), kDense, kDense),
+             ColumnScanFromDense(dense, kDense, kDense));
+}
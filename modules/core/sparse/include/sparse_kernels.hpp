@@ -0,0 +1,319 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "core/sparse/include/sparse_matrix.hpp"
+
+namespace ppc::sparse {
+
+// work per bin of a product, in multiply-adds, and the fewest bins a product is cut into
+constexpr std::size_t kProductFlops = std::size_t{1} << 14;
+constexpr std::size_t kMinProductBins = 64;
+// a row (column) of C with fewer than minor / kHashRatio multiply-adds is summed in a hash table
+constexpr std::size_t kHashRatio = 16;
+
+// Schedule of a Gustavson product: flops[j] - multiply-adds of major index j of C, and bins[b] ..
+// bins[b + 1] - the major indices of bin b. A major index weighs its multiply-adds plus one, and the
+// bins are cut at equal shares of the total weight, about kProductFlops each, so under skewed operands
+// (power-law degrees) a bin of a few heavy rows costs as much as a bin of many light ones. The plan
+// depends on the operands only
+struct ProductPlan {
+  std::vector<std::int64_t> flops;
+  std::vector<std::size_t> bins;
+};
+
+// Plan of the product whose major index j sums the major indices of right picked by major index j of
+// left: rows of A and B for a CSR product, columns of B and A for a CSC one
+template <class T, class I>
+ProductPlan PlanProduct(const CompressedView<T, I> &left, const CompressedView<T, I> &right,
+                        const ChunkRunner &runner = {}) {
+  const std::size_t major = left.major;
+  ProductPlan plan;
+  plan.flops.resize(major);
+  detail::RunRanges(runner, major, detail::kMajorChunk, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t j = begin; j < end; j++) {
+      std::int64_t flops = 0;
+      for (I e = left.ptr[j]; e < left.ptr[j + 1]; e++) {
+        const I k = left.idx[e];
+        flops += static_cast<std::int64_t>(right.ptr[k + 1] - right.ptr[k]);
+      }
+      plan.flops[j] = flops;
+    }
+  });
+  // weight of major indices [0, j): before[j] + j
+  std::vector<std::int64_t> before(major + 1);
+  detail::ExclusiveScan(major, plan.flops.data(), before.data(), runner);
+  auto weight = [&before](std::size_t j) { return static_cast<std::size_t>(before[j]) + j; };
+  const std::size_t total = weight(major);
+  const std::size_t bins = std::clamp<std::size_t>(std::max(detail::Chunks(total, kProductFlops), kMinProductBins), 1,
+                                                   std::max<std::size_t>(major, 1));
+  plan.bins.push_back(0);
+  for (std::size_t b = 1; b < bins; b++) {
+    const std::size_t target = (total / bins * b) + (total % bins * b / bins);
+    // first major index with at least target before it
+    std::size_t low = plan.bins.back();
+    std::size_t high = major;
+    while (low < high) {
+      const std::size_t middle = low + ((high - low) / 2);
+      if (weight(middle) < target) {
+        low = middle + 1;
+      } else {
+        high = middle;
+      }
+    }
+    plan.bins.push_back(low);
+  }
+  plan.bins.push_back(major);
+  return plan;
+}
+
+namespace detail {
+
+// Accumulator of one major index of C, kept per thread and reused across major indices and products
+template <class T, class I>
+struct Accumulator {
+  static constexpr I kEmptySlot = -1;
+  // dense: minor index i is in the current row when stamp[i] == generation
+  std::vector<std::uint64_t> stamp;
+  std::vector<T> dense;
+  std::uint64_t generation = 0;
+  // hash: open addressing with linear probing over a power-of-two table
+  std::vector<I> keys;
+  std::vector<T> hashed;
+  // minor indices of the current row for the dense array, slots for the hash table
+  std::vector<I> touched;
+  bool use_hash = false;
+  // sorted (minor index, value) entries of the current row
+  std::vector<std::pair<I, T>> entries;
+};
+
+template <class T, class I>
+Accumulator<T, I> &ThreadAccumulator(std::size_t minor) {
+  thread_local Accumulator<T, I> accumulator;
+  if (accumulator.stamp.size() < minor) {
+    accumulator.stamp.resize(minor, 0);
+    accumulator.dense.resize(minor);
+  }
+  return accumulator;
+}
+
+// Collects the minor indices of major index j of the product in acc.touched, with their sums if
+// numeric; flops is its multiply-add count from the plan. Entry (j, k) of left picks major index k of
+// right, so for CSR operands left = A and right = B, and for CSC operands left = B and right = A
+template <class T, class I>
+void Gather(const CompressedView<T, I> &left, const CompressedView<T, I> &right, std::size_t j, std::size_t flops,
+            bool numeric, Accumulator<T, I> &acc) {
+  acc.touched.clear();
+  acc.use_hash = flops * kHashRatio < right.minor;
+  if (acc.use_hash) {
+    std::size_t size = 8;
+    while (size < 2 * flops) {
+      size *= 2;
+    }
+    const std::size_t mask = size - 1;
+    acc.keys.assign(size, Accumulator<T, I>::kEmptySlot);
+    acc.hashed.resize(size);
+    for (I e = left.ptr[j]; e < left.ptr[j + 1]; e++) {
+      const I k = left.idx[e];
+      for (I f = right.ptr[k]; f < right.ptr[k + 1]; f++) {
+        const I i = right.idx[f];
+        std::size_t slot = (static_cast<std::size_t>(i) * 0x9E3779B1U) & mask;
+        while (acc.keys[slot] != Accumulator<T, I>::kEmptySlot && acc.keys[slot] != i) {
+          slot = (slot + 1) & mask;
+        }
+        if (acc.keys[slot] == Accumulator<T, I>::kEmptySlot) {
+          acc.keys[slot] = i;
+          acc.hashed[slot] = T{};
+          acc.touched.push_back(static_cast<I>(slot));
+        }
+        if (numeric) {
+          acc.hashed[slot] += right.values[f] * left.values[e];
+        }
+      }
+    }
+    return;
+  }
+  const std::uint64_t generation = ++acc.generation;
+  for (I e = left.ptr[j]; e < left.ptr[j + 1]; e++) {
+    const I k = left.idx[e];
+    for (I f = right.ptr[k]; f < right.ptr[k + 1]; f++) {
+      const I i = right.idx[f];
+      if (acc.stamp[i] != generation) {
+        acc.stamp[i] = generation;
+        acc.dense[i] = T{};
+        acc.touched.push_back(i);
+      }
+      if (numeric) {
+        acc.dense[i] += right.values[f] * left.values[e];
+      }
+    }
+  }
+}
+
+// Entries gathered by a numeric Gather, sorted by minor index
+template <class T, class I>
+void SortedEntries(Accumulator<T, I> &acc) {
+  acc.entries.clear();
+  if (acc.use_hash) {
+    for (const I slot : acc.touched) {
+      acc.entries.emplace_back(acc.keys[slot], acc.hashed[slot]);
+    }
+    std::ranges::sort(acc.entries, {}, &std::pair<I, T>::first);
+    return;
+  }
+  std::ranges::sort(acc.touched);
+  for (const I i : acc.touched) {
+    acc.entries.emplace_back(i, acc.dense[i]);
+  }
+}
+
+// Gustavson's product, one major index of the result at a time: major index j is the sum of the
+// major indices of right picked by the entries of major index j of left, so the work follows the
+// multiply-adds. The bins of PlanProduct go to the runner; a symbolic pass counts the entries of every
+// major index, a scan places them and a numeric pass writes them in place. Entries with |c| <=
+// drop_tolerance are left out when the tolerance is not negative
+template <class T, class I>
+Compressed<T, I> Gustavson(const CompressedView<T, I> &left, const CompressedView<T, I> &right, double drop_tolerance,
+                           const ChunkRunner &runner) {
+  Compressed<T, I> c;
+  const std::size_t major = left.major;
+  c.ptr.assign(major + 1, 0);
+  const auto plan = PlanProduct(left, right, runner);
+  const std::size_t chunks = plan.bins.size() - 1;
+  auto range = [&plan](std::size_t chunk) { return std::pair{plan.bins[chunk], plan.bins[chunk + 1]}; };
+
+  // symbolic: entries per major index of C
+  std::vector<I> counts(major);
+  Run(runner, chunks, [&](std::size_t chunk) {
+    auto &acc = ThreadAccumulator<T, I>(right.minor);
+    const auto [begin, end] = range(chunk);
+    for (std::size_t j = begin; j < end; j++) {
+      Gather(left, right, j, static_cast<std::size_t>(plan.flops[j]), false, acc);
+      counts[j] = static_cast<I>(acc.touched.size());
+    }
+  });
+  ExclusiveScan(major, counts.data(), c.ptr.data(), runner);
+  c.idx.resize(static_cast<std::size_t>(c.ptr[major]));
+  c.values.resize(c.idx.size());
+
+  // numeric: every major index written at its offset; counts become the entries kept
+  Run(runner, chunks, [&](std::size_t chunk) {
+    auto &acc = ThreadAccumulator<T, I>(right.minor);
+    const auto [begin, end] = range(chunk);
+    for (std::size_t j = begin; j < end; j++) {
+      Gather(left, right, j, static_cast<std::size_t>(plan.flops[j]), true, acc);
+      SortedEntries(acc);
+      I kept = 0;
+      for (const auto &[i, value] : acc.entries) {
+        if (drop_tolerance < 0.0 || std::abs(value) > drop_tolerance) {
+          c.idx[c.ptr[j] + kept] = i;
+          c.values[c.ptr[j] + kept] = value;
+          kept++;
+        }
+      }
+      counts[j] = kept;
+    }
+  });
+  if (drop_tolerance < 0.0) {
+    return c;
+  }
+
+  // compaction of the major indices that lost entries
+  std::vector<I> kept_ptr(major + 1);
+  ExclusiveScan(major, counts.data(), kept_ptr.data(), runner);
+  if (kept_ptr[major] == c.ptr[major]) {
+    return c;
+  }
+  std::vector<I> idx(static_cast<std::size_t>(kept_ptr[major]));
+  std::vector<T> values(idx.size());
+  Run(runner, chunks, [&](std::size_t chunk) {
+    const auto [begin, end] = range(chunk);
+    for (std::size_t j = begin; j < end; j++) {
+      std::copy_n(c.idx.begin() + c.ptr[j], counts[j], idx.begin() + kept_ptr[j]);
+      std::copy_n(c.values.begin() + c.ptr[j], counts[j], values.begin() + kept_ptr[j]);
+    }
+  });
+  c.ptr = std::move(kept_ptr);
+  c.idx = std::move(idx);
+  c.values = std::move(values);
+  return c;
+}
+
+}  // namespace detail
+
+// y = A * x, rows in chunks on the runner
+template <class T, class I>
+void Multiply(const Csr<T, I> &a, const T *x, T *y, const ChunkRunner &runner = {}) {
+  detail::RunRanges(runner, a.rows, detail::kMajorChunk, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; i++) {
+      T sum{};
+      for (I e = a.row_ptr[i]; e < a.row_ptr[i + 1]; e++) {
+        sum += a.values[e] * x[a.col_idx[e]];
+      }
+      y[i] = sum;
+    }
+  });
+}
+
+// y = A * x by columns. The columns scatter into all of y, so this runs in order; ToCsr once and the
+// CSR product spreads the rows over threads
+template <class T, class I>
+void Multiply(const Csc<T, I> &a, const T *x, T *y) {
+  std::fill(y, y + a.rows, T{});
+  for (std::size_t j = 0; j < a.cols; j++) {
+    for (I e = a.col_ptr[j]; e < a.col_ptr[j + 1]; e++) {
+      y[a.row_idx[e]] += a.values[e] * x[j];
+    }
+  }
+}
+
+// C = A * B row by row with Gustavson's algorithm, rows of C in the flop-balanced bins of PlanProduct
+// on the runner. Each thread sums a row in its own accumulator: a dense array over the columns of B, or a
+// small hash table for a row with far fewer multiply-adds than columns, so the result does not depend
+// on the runner. Entries with |c| <= drop_tolerance are left out; a negative tolerance keeps the
+// structural product. Throws std::invalid_argument if a.cols != b.rows and std::length_error if C
+// has more entries than I can address
+template <class T, class I>
+Csr<T, I> Multiply(const Csr<T, I> &a, const Csr<T, I> &b, const ChunkRunner &runner = {},
+                   double drop_tolerance = -1.0) {
+  if (a.cols != b.rows) {
+    throw std::invalid_argument("sparse: inner dimensions differ");
+  }
+  auto c = detail::Gustavson(a.View(), b.View(), drop_tolerance, runner);
+  return {.rows = a.rows,
+          .cols = b.cols,
+          .row_ptr = std::move(c.ptr),
+          .col_idx = std::move(c.idx),
+          .values = std::move(c.values)};
+}
+
+// C = A * B for CSC operands kept elsewhere, given as views of their columns (major = cols): column j
+// of C sums the columns of A picked by column j of B. Same bins, accumulators, tolerance and errors as
+// the CSR product
+template <class T, class I>
+Csc<T, I> MultiplyColumns(const CompressedView<T, I> &a, const CompressedView<T, I> &b, const ChunkRunner &runner = {},
+                          double drop_tolerance = -1.0) {
+  if (a.major != b.minor) {
+    throw std::invalid_argument("sparse: inner dimensions differ");
+  }
+  auto c = detail::Gustavson(b, a, drop_tolerance, runner);
+  return {.rows = a.minor,
+          .cols = b.major,
+          .col_ptr = std::move(c.ptr),
+          .row_idx = std::move(c.idx),
+          .values = std::move(c.values)};
+}
+
+template <class T, class I>
+Csc<T, I> Multiply(const Csc<T, I> &a, const Csc<T, I> &b, const ChunkRunner &runner = {},
+                   double drop_tolerance = -1.0) {
+  return MultiplyColumns(a.View(), b.View(), runner, drop_tolerance);
+}
+
+}  // namespace ppc::sparse
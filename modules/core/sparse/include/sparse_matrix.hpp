@@ -0,0 +1,567 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/thread_pool/include/chunk_runner.hpp"
+
+namespace ppc::sparse {
+
+// Runs body(0), ..., body(count - 1), possibly concurrently; an empty runner runs them in order
+using ChunkRunner = ppc::core::ChunkRunner;
+
+// Non-owning view of a compressed matrix from its major side: major index m holds the minor indices
+// idx[ptr[m] .. ptr[m + 1]) and their values. The rows of a CSR matrix and the columns of a CSC one
+template <class T, class I>
+struct CompressedView {
+  std::size_t major = 0;
+  std::size_t minor = 0;
+  const I *ptr = nullptr;
+  const I *idx = nullptr;
+  const T *values = nullptr;
+};
+
+namespace detail {
+
+constexpr std::size_t kScanChunk = 4096;
+// major indices per chunk of the loops that treat every row (column) on its own
+constexpr std::size_t kMajorChunk = 256;
+// columns per chunk of a column-wise read of a row-major dense matrix
+constexpr std::size_t kPanelWidth = 64;
+// entries per chunk of a counting sort, and the most chunks it is cut into
+constexpr std::size_t kSortGrain = std::size_t{1} << 14;
+constexpr std::size_t kMaxSortChunks = 64;
+
+inline std::size_t Chunks(std::size_t n, std::size_t chunk) { return (n + chunk - 1) / chunk; }
+
+inline void Run(const ChunkRunner &runner, std::size_t count, const std::function<void(std::size_t)> &body) {
+  if (count <= 1 || !runner) {
+    ppc::core::RunSequential(count, body);
+  } else {
+    runner(count, body);
+  }
+}
+
+// body(begin, end) over [0, n) in chunks of the given size
+template <class Body>
+void RunRanges(const ChunkRunner &runner, std::size_t n, std::size_t chunk, const Body &body) {
+  Run(runner, Chunks(n, chunk), [&](std::size_t c) { body(c * chunk, std::min(n, (c + 1) * chunk)); });
+}
+
+template <class I>
+I ToIndex(std::size_t n) {
+  if (n > static_cast<std::size_t>(std::numeric_limits<I>::max())) {
+    throw std::length_error("sparse: size does not fit in the index type");
+  }
+  return static_cast<I>(n);
+}
+
+// offsets[0] = 0 and offsets[i + 1] = counts[0] + ... + counts[i], chunk by chunk. Throws
+// std::length_error if the total does not fit in I
+template <class I, class Count>
+void ExclusiveScan(std::size_t n, const Count *counts, I *offsets, const ChunkRunner &runner) {
+  const std::size_t chunks = Chunks(n, kScanChunk);
+  // totals[c] - sum of the chunks before chunk c
+  std::vector<std::uint64_t> totals(chunks + 1, 0);
+  Run(runner, chunks, [&](std::size_t chunk) {
+    const std::size_t end = std::min(n, (chunk + 1) * kScanChunk);
+    std::uint64_t sum = 0;
+    for (std::size_t i = chunk * kScanChunk; i < end; i++) {
+      sum += static_cast<std::uint64_t>(counts[i]);
+    }
+    totals[chunk + 1] = sum;
+  });
+  for (std::size_t chunk = 0; chunk < chunks; chunk++) {
+    totals[chunk + 1] += totals[chunk];
+  }
+  if (totals[chunks] > static_cast<std::uint64_t>(std::numeric_limits<I>::max())) {
+    throw std::length_error("sparse: more entries than the index type can address");
+  }
+  offsets[0] = 0;
+  Run(runner, chunks, [&](std::size_t chunk) {
+    const std::size_t end = std::min(n, (chunk + 1) * kScanChunk);
+    auto running = totals[chunk];
+    for (std::size_t i = chunk * kScanChunk; i < end; i++) {
+      running += static_cast<std::uint64_t>(counts[i]);
+      offsets[i + 1] = static_cast<I>(running);
+    }
+  });
+}
+
+// Chunks of a counting sort of nnz entries into buckets: enough to spread the work, and few enough
+// that the per-chunk histograms take no more room than the entries themselves
+inline std::size_t SortChunks(std::size_t nnz, std::size_t buckets) {
+  const std::size_t by_room = nnz / std::max<std::size_t>(buckets, 1);
+  return std::clamp<std::size_t>(std::min(nnz / kSortGrain, by_room), 1, kMaxSortChunks);
+}
+
+// bounds[c] .. bounds[c + 1] - major indices of chunk c, cut so that every chunk holds about as many
+// entries
+template <class T, class I>
+std::vector<std::size_t> BalancedBounds(const CompressedView<T, I> &m, std::size_t chunks) {
+  std::vector<std::size_t> bounds{0};
+  const auto nnz = static_cast<std::size_t>(m.ptr[m.major]);
+  for (std::size_t c = 1; c < chunks; c++) {
+    const auto target = static_cast<I>((nnz / chunks * c) + (nnz % chunks * c / chunks));
+    const auto first = static_cast<std::size_t>(std::lower_bound(m.ptr, m.ptr + m.major + 1, target) - m.ptr);
+    bounds.push_back(std::clamp(first, bounds.back(), m.major));
+  }
+  bounds.push_back(m.major);
+  return bounds;
+}
+
+// Stable parallel counting sort. visit(c, f) calls f(key, args...) for the entries of chunk c, in the
+// same order on every call, with every key below buckets. ptr[0 .. buckets] receives the bucket
+// offsets and place(position, args...) is called once per entry: a bucket holds the entries of chunk
+// 0 first, then those of chunk 1, and so on, each in visiting order, so the result does not depend on
+// the runner
+template <class I, class Visit, class Place>
+void CountingSort(std::size_t chunks, std::size_t buckets, const Visit &visit, const Place &place, I *ptr,
+                  const ChunkRunner &runner) {
+  // histogram of every chunk, then the next free position of every (chunk, bucket)
+  std::vector<I> cursor(chunks * buckets, 0);
+  Run(runner, chunks, [&](std::size_t c) {
+    I *histogram = cursor.data() + (c * buckets);
+    visit(c, [histogram](I key, const auto &...) { histogram[key]++; });
+  });
+  std::vector<I> totals(buckets);
+  RunRanges(runner, buckets, kScanChunk, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t b = begin; b < end; b++) {
+      I sum = 0;
+      for (std::size_t c = 0; c < chunks; c++) {
+        sum += cursor[(c * buckets) + b];
+      }
+      totals[b] = sum;
+    }
+  });
+  ExclusiveScan(buckets, totals.data(), ptr, runner);
+  RunRanges(runner, buckets, kScanChunk, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t b = begin; b < end; b++) {
+      I position = ptr[b];
+      for (std::size_t c = 0; c < chunks; c++) {
+        const I count = cursor[(c * buckets) + b];
+        cursor[(c * buckets) + b] = position;
+        position += count;
+      }
+    }
+  });
+  Run(runner, chunks, [&](std::size_t c) {
+    I *next = cursor.data() + (c * buckets);
+    visit(c, [next, &place](I key, const auto &...args) { place(next[key]++, args...); });
+  });
+}
+
+// Owning arrays of a compressed matrix
+template <class T, class I>
+struct Compressed {
+  std::vector<I> ptr;
+  std::vector<I> idx;
+  std::vector<T> values;
+};
+
+// The same matrix compressed from the other side: the minor indices of every major index come out in
+// increasing order, whatever their order in m
+template <class T, class I>
+Compressed<T, I> Transpose(const CompressedView<T, I> &m, const ChunkRunner &runner) {
+  Compressed<T, I> t;
+  const auto nnz = static_cast<std::size_t>(m.ptr[m.major]);
+  t.ptr.resize(m.minor + 1);
+  t.idx.resize(nnz);
+  t.values.resize(nnz);
+  const auto bounds = BalancedBounds(m, SortChunks(nnz, m.minor));
+  CountingSort(
+      bounds.size() - 1, m.minor,
+      [&](std::size_t c, const auto &f) {
+        for (std::size_t j = bounds[c]; j < bounds[c + 1]; j++) {
+          for (I e = m.ptr[j]; e < m.ptr[j + 1]; e++) {
+            f(m.idx[e], static_cast<I>(j), e);
+          }
+        }
+      },
+      [&t, &m](I position, I major, I e) {
+        t.idx[position] = major;
+        t.values[position] = m.values[e];
+      },
+      t.ptr.data(), runner);
+  return t;
+}
+
+// Sums the entries of every major index that repeat a minor index; expects them next to each other
+template <class T, class I>
+void MergeDuplicates(std::size_t major, Compressed<T, I> &m, const ChunkRunner &runner) {
+  std::vector<I> counts(major);
+  RunRanges(runner, major, kMajorChunk, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t j = begin; j < end; j++) {
+      I unique = 0;
+      for (I e = m.ptr[j]; e < m.ptr[j + 1]; e++) {
+        unique += (e == m.ptr[j] || m.idx[e] != m.idx[e - 1]) ? 1 : 0;
+      }
+      counts[j] = unique;
+    }
+  });
+  std::vector<I> ptr(major + 1);
+  ExclusiveScan(major, counts.data(), ptr.data(), runner);
+  if (ptr[major] == m.ptr[major]) {
+    return;
+  }
+  std::vector<I> idx(static_cast<std::size_t>(ptr[major]));
+  std::vector<T> values(idx.size());
+  RunRanges(runner, major, kMajorChunk, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t j = begin; j < end; j++) {
+      I out = ptr[j] - 1;
+      for (I e = m.ptr[j]; e < m.ptr[j + 1]; e++) {
+        if (e == m.ptr[j] || m.idx[e] != m.idx[e - 1]) {
+          idx[++out] = m.idx[e];
+          values[out] = m.values[e];
+        } else {
+          values[out] += m.values[e];
+        }
+      }
+    }
+  });
+  m.ptr = std::move(ptr);
+  m.idx = std::move(idx);
+  m.values = std::move(values);
+}
+
+// Coordinate entries compressed by major_idx with increasing minor indices; repeated pairs are summed.
+// Throws std::out_of_range if an index is outside the matrix
+template <class T, class I>
+Compressed<T, I> FromEntries(std::size_t major, std::size_t minor, const std::vector<I> &major_idx,
+                             const std::vector<I> &minor_idx, const std::vector<T> &values,
+                             const ChunkRunner &runner) {
+  const std::size_t nnz = values.size();
+  if (major_idx.size() != nnz || minor_idx.size() != nnz) {
+    throw std::invalid_argument("sparse: coordinate arrays differ in length");
+  }
+  auto outside = [](std::size_t extent) {
+    return [extent](I i) { return i < 0 || static_cast<std::size_t>(i) >= extent; };
+  };
+  if (std::ranges::any_of(major_idx, outside(major)) || std::ranges::any_of(minor_idx, outside(minor))) {
+    throw std::out_of_range("sparse: coordinate outside the matrix");
+  }
+  // bucket by the minor index, then transpose: a radix sort by (major, minor) that keeps equal pairs
+  // together
+  Compressed<T, I> by_minor;
+  by_minor.ptr.resize(minor + 1);
+  by_minor.idx.resize(nnz);
+  by_minor.values.resize(nnz);
+  const std::size_t chunks = SortChunks(nnz, minor);
+  CountingSort(
+      chunks, minor,
+      [&](std::size_t c, const auto &f) {
+        const std::size_t end = nnz * (c + 1) / chunks;
+        for (std::size_t e = nnz * c / chunks; e < end; e++) {
+          f(minor_idx[e], e);
+        }
+      },
+      [&](I position, std::size_t e) {
+        by_minor.idx[position] = major_idx[e];
+        by_minor.values[position] = values[e];
+      },
+      by_minor.ptr.data(), runner);
+  auto m = Transpose(CompressedView<T, I>{.major = minor,
+                                          .minor = major,
+                                          .ptr = by_minor.ptr.data(),
+                                          .idx = by_minor.idx.data(),
+                                          .values = by_minor.values.data()},
+                     runner);
+  MergeDuplicates(major, m, runner);
+  return m;
+}
+
+// The major index of every entry, for the coordinate form
+template <class T, class I>
+std::vector<I> MajorOfEntries(const CompressedView<T, I> &m, const ChunkRunner &runner) {
+  std::vector<I> major_idx(static_cast<std::size_t>(m.ptr[m.major]));
+  RunRanges(runner, m.major, kMajorChunk, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t j = begin; j < end; j++) {
+      std::fill(major_idx.begin() + m.ptr[j], major_idx.begin() + m.ptr[j + 1], static_cast<I>(j));
+    }
+  });
+  return major_idx;
+}
+
+// Nonzeros of a row-major rows x cols matrix, compressed by rows
+template <class T, class I>
+Compressed<T, I> FromDenseRows(const T *a, std::size_t rows, std::size_t cols, const ChunkRunner &runner) {
+  ToIndex<I>(cols);
+  Compressed<T, I> m;
+  std::vector<I> counts(rows);
+  RunRanges(runner, rows, kMajorChunk, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; i++) {
+      const T *row = a + (i * cols);
+      counts[i] = static_cast<I>(std::count_if(row, row + cols, [](const T &x) { return x != T{}; }));
+    }
+  });
+  m.ptr.resize(rows + 1);
+  ExclusiveScan(rows, counts.data(), m.ptr.data(), runner);
+  m.idx.resize(static_cast<std::size_t>(m.ptr[rows]));
+  m.values.resize(m.idx.size());
+  RunRanges(runner, rows, kMajorChunk, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; i++) {
+      I out = m.ptr[i];
+      for (std::size_t j = 0; j < cols; j++) {
+        if (a[(i * cols) + j] != T{}) {
+          m.idx[out] = static_cast<I>(j);
+          m.values[out++] = a[(i * cols) + j];
+        }
+      }
+    }
+  });
+  return m;
+}
+
+// Nonzeros of a row-major rows x cols matrix, compressed by columns. A chunk of kPanelWidth columns
+// is read row by row, so every read stays on a few contiguous cache lines
+template <class T, class I>
+Compressed<T, I> FromDenseColumns(const T *a, std::size_t rows, std::size_t cols, const ChunkRunner &runner) {
+  ToIndex<I>(rows);
+  Compressed<T, I> m;
+  std::vector<I> counts(cols, 0);
+  RunRanges(runner, cols, kPanelWidth, [&](std::size_t begin, std::size_t end) {
+    std::array<I, kPanelWidth> panel{};
+    for (std::size_t i = 0; i < rows; i++) {
+      const T *row = a + (i * cols);
+      for (std::size_t j = begin; j < end; j++) {
+        panel[j - begin] += (row[j] != T{}) ? 1 : 0;
+      }
+    }
+    std::copy_n(panel.begin(), end - begin, counts.begin() + static_cast<std::ptrdiff_t>(begin));
+  });
+  m.ptr.resize(cols + 1);
+  ExclusiveScan(cols, counts.data(), m.ptr.data(), runner);
+  m.idx.resize(static_cast<std::size_t>(m.ptr[cols]));
+  m.values.resize(m.idx.size());
+  RunRanges(runner, cols, kPanelWidth, [&](std::size_t begin, std::size_t end) {
+    std::array<I, kPanelWidth> next{};
+    std::copy_n(m.ptr.begin() + static_cast<std::ptrdiff_t>(begin), end - begin, next.begin());
+    for (std::size_t i = 0; i < rows; i++) {
+      const T *row = a + (i * cols);
+      for (std::size_t j = begin; j < end; j++) {
+        if (row[j] != T{}) {
+          m.idx[next[j - begin]] = static_cast<I>(i);
+          m.values[next[j - begin]++] = row[j];
+        }
+      }
+    }
+  });
+  return m;
+}
+
+// Writes the dense copy of m to out, where entry (major j, minor i) lands at out[j * major_stride +
+// i * minor_stride]; out is cleared first
+template <class T, class I>
+void ToDense(const CompressedView<T, I> &m, T *out, std::size_t major_stride, std::size_t minor_stride,
+             const ChunkRunner &runner) {
+  const std::size_t size = m.major * m.minor;
+  RunRanges(runner, size, kMajorChunk * kMajorChunk,
+            [out](std::size_t begin, std::size_t end) { std::fill(out + begin, out + end, T{}); });
+  RunRanges(runner, m.major, kMajorChunk, [&](std::size_t begin, std::size_t end) {
+    for (std::size_t j = begin; j < end; j++) {
+      for (I e = m.ptr[j]; e < m.ptr[j + 1]; e++) {
+        out[(j * major_stride) + (static_cast<std::size_t>(m.idx[e]) * minor_stride)] = m.values[e];
+      }
+    }
+  });
+}
+
+// Offsets monotone and in range, minor indices in range and strictly increasing for every major index
+template <class T, class I>
+bool IsValid(std::size_t major, std::size_t minor, const std::vector<I> &ptr, const std::vector<I> &idx,
+             const std::vector<T> &values) {
+  if (ptr.size() != major + 1 || ptr.front() != 0 || static_cast<std::size_t>(ptr.back()) != values.size() ||
+      idx.size() != values.size()) {
+    return false;
+  }
+  for (std::size_t j = 0; j < major; j++) {
+    if (ptr[j] > ptr[j + 1]) {
+      return false;
+    }
+    for (I e = ptr[j]; e < ptr[j + 1]; e++) {
+      if (idx[e] < 0 || static_cast<std::size_t>(idx[e]) >= minor || (e > ptr[j] && idx[e] <= idx[e - 1])) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace detail
+
+// Compressed sparse row matrix: row i holds the columns col_idx[row_ptr[i] .. row_ptr[i + 1]) in
+// increasing order, with their values. I is a signed index type, wide enough for every column and
+// for the number of entries; int64_t lifts the 2^31 limit of int
+template <class T, class I = int>
+struct Csr {
+  static_assert(std::is_integral_v<I> && std::is_signed_v<I>, "sparse indices must be a signed integer type");
+
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  // rows + 1 offsets into col_idx and values
+  std::vector<I> row_ptr;
+  std::vector<I> col_idx;
+  std::vector<T> values;
+
+  [[nodiscard]] std::size_t NonZeros() const { return values.size(); }
+  [[nodiscard]] bool IsValid() const { return detail::IsValid(rows, cols, row_ptr, col_idx, values); }
+  [[nodiscard]] CompressedView<T, I> View() const {
+    return {.major = rows, .minor = cols, .ptr = row_ptr.data(), .idx = col_idx.data(), .values = values.data()};
+  }
+  // writes the row-major rows x cols copy of the matrix to out
+  void ToDense(T *out, const ChunkRunner &runner = {}) const { detail::ToDense(View(), out, cols, 1, runner); }
+
+  // nonzeros of a dense row-major rows x cols matrix
+  static Csr FromDense(const T *a, std::size_t rows, std::size_t cols, const ChunkRunner &runner = {}) {
+    auto m = detail::FromDenseRows<T, I>(a, rows, cols, runner);
+    return {.rows = rows,
+            .cols = cols,
+            .row_ptr = std::move(m.ptr),
+            .col_idx = std::move(m.idx),
+            .values = std::move(m.values)};
+  }
+};
+
+// Compressed sparse column matrix: column j holds the rows row_idx[col_ptr[j] .. col_ptr[j + 1]) in
+// increasing order, with their values
+template <class T, class I = int>
+struct Csc {
+  static_assert(std::is_integral_v<I> && std::is_signed_v<I>, "sparse indices must be a signed integer type");
+
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  // cols + 1 offsets into row_idx and values
+  std::vector<I> col_ptr;
+  std::vector<I> row_idx;
+  std::vector<T> values;
+
+  [[nodiscard]] std::size_t NonZeros() const { return values.size(); }
+  // offsets monotone and in range, rows in range and strictly increasing in every column
+  [[nodiscard]] bool IsValid() const { return detail::IsValid(cols, rows, col_ptr, row_idx, values); }
+  [[nodiscard]] CompressedView<T, I> View() const {
+    return {.major = cols, .minor = rows, .ptr = col_ptr.data(), .idx = row_idx.data(), .values = values.data()};
+  }
+  // writes the row-major rows x cols copy of the matrix to out
+  void ToDense(T *out, const ChunkRunner &runner = {}) const { detail::ToDense(View(), out, 1, cols, runner); }
+
+  // nonzeros of a dense row-major rows x cols matrix
+  static Csc FromDense(const T *a, std::size_t rows, std::size_t cols, const ChunkRunner &runner = {}) {
+    auto m = detail::FromDenseColumns<T, I>(a, rows, cols, runner);
+    return {.rows = rows,
+            .cols = cols,
+            .col_ptr = std::move(m.ptr),
+            .row_idx = std::move(m.idx),
+            .values = std::move(m.values)};
+  }
+};
+
+// Coordinate matrix: entry e is (row_idx[e], col_idx[e], values[e]), in any order; repeated
+// coordinates add up when the matrix is compressed
+template <class T, class I = int>
+struct Coo {
+  static_assert(std::is_integral_v<I> && std::is_signed_v<I>, "sparse indices must be a signed integer type");
+
+  std::size_t rows = 0;
+  std::size_t cols = 0;
+  std::vector<I> row_idx;
+  std::vector<I> col_idx;
+  std::vector<T> values;
+
+  [[nodiscard]] std::size_t NonZeros() const { return values.size(); }
+};
+
+// Conversions and transposes run their chunks on the runner; the result never depends on it.
+// CSR <-> CSC is a transpose of the compressed arrays by a stable counting sort over the minor
+// indices: a histogram per chunk of entries, a scan and a scatter, O(nnz + rows + cols) in all
+
+template <class T, class I>
+Csc<T, I> ToCsc(const Csr<T, I> &a, const ChunkRunner &runner = {}) {
+  auto m = detail::Transpose(a.View(), runner);
+  return {.rows = a.rows,
+          .cols = a.cols,
+          .col_ptr = std::move(m.ptr),
+          .row_idx = std::move(m.idx),
+          .values = std::move(m.values)};
+}
+
+template <class T, class I>
+Csr<T, I> ToCsr(const Csc<T, I> &a, const ChunkRunner &runner = {}) {
+  auto m = detail::Transpose(a.View(), runner);
+  return {.rows = a.rows,
+          .cols = a.cols,
+          .row_ptr = std::move(m.ptr),
+          .col_idx = std::move(m.idx),
+          .values = std::move(m.values)};
+}
+
+// Throws std::out_of_range if an entry is outside the matrix
+template <class T, class I>
+Csr<T, I> ToCsr(const Coo<T, I> &a, const ChunkRunner &runner = {}) {
+  auto m = detail::FromEntries(a.rows, a.cols, a.row_idx, a.col_idx, a.values, runner);
+  return {.rows = a.rows,
+          .cols = a.cols,
+          .row_ptr = std::move(m.ptr),
+          .col_idx = std::move(m.idx),
+          .values = std::move(m.values)};
+}
+
+// Throws std::out_of_range if an entry is outside the matrix
+template <class T, class I>
+Csc<T, I> ToCsc(const Coo<T, I> &a, const ChunkRunner &runner = {}) {
+  auto m = detail::FromEntries(a.cols, a.rows, a.col_idx, a.row_idx, a.values, runner);
+  return {.rows = a.rows,
+          .cols = a.cols,
+          .col_ptr = std::move(m.ptr),
+          .row_idx = std::move(m.idx),
+          .values = std::move(m.values)};
+}
+
+// Entries row by row
+template <class T, class I>
+Coo<T, I> ToCoo(const Csr<T, I> &a, const ChunkRunner &runner = {}) {
+  return {.rows = a.rows,
+          .cols = a.cols,
+          .row_idx = detail::MajorOfEntries(a.View(), runner),
+          .col_idx = a.col_idx,
+          .values = a.values};
+}
+
+// Entries column by column
+template <class T, class I>
+Coo<T, I> ToCoo(const Csc<T, I> &a, const ChunkRunner &runner = {}) {
+  return {.rows = a.rows,
+          .cols = a.cols,
+          .row_idx = a.row_idx,
+          .col_idx = detail::MajorOfEntries(a.View(), runner),
+          .values = a.values};
+}
+
+template <class T, class I>
+Csr<T, I> Transpose(const Csr<T, I> &a, const ChunkRunner &runner = {}) {
+  auto m = detail::Transpose(a.View(), runner);
+  return {.rows = a.cols,
+          .cols = a.rows,
+          .row_ptr = std::move(m.ptr),
+          .col_idx = std::move(m.idx),
+          .values = std::move(m.values)};
+}
+
+template <class T, class I>
+Csc<T, I> Transpose(const Csc<T, I> &a, const ChunkRunner &runner = {}) {
+  auto m = detail::Transpose(a.View(), runner);
+  return {.rows = a.cols,
+          .cols = a.rows,
+          .col_ptr = std::move(m.ptr),
+          .row_idx = std::move(m.idx),
+          .values = std::move(m.values)};
+}
+
+}  // namespace ppc::sparse
@@ -1,11 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 #include "core/task/func_tests/test_task.hpp"
+#include "core/task/include/memory_profile.hpp"
 #include "core/task/include/task.hpp"
 
 TEST(task_tests, check_int32_t) {
@@ -52,6 +56,42 @@ TEST(task_tests, check_int32_t_slow) {
   ASSERT_EQ(static_cast<size_t>(out[0]), in.size());
 }
 
+TEST(task_tests, check_order_over_cycles) {
+  // Create data
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+
+  // Create TaskData
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Repeated Run calls and several full cycles are allowed
+  ppc::test::task::TestTask<int32_t> test_task(task_data);
+  task_data->state_of_testing = ppc::core::TaskData::kPerf;
+  for (int cycle = 0; cycle < 3; cycle++) {
+    ASSERT_TRUE(test_task.Validation());
+    test_task.PreProcessing();
+    test_task.Run();
+    test_task.Run();
+    test_task.PostProcessing();
+  }
+
+  // Calls are numbered from the start of the first cycle, repeated Run calls excluded
+  test_task.Validation();
+  try {
+    test_task.Run();
+    FAIL() << "order violation was not detected";
+  } catch (const std::invalid_argument &e) {
+    const std::string message = e.what();
+    EXPECT_NE(message.find("Serial number: 14\n"), std::string::npos) << message;
+    EXPECT_NE(message.find("Yours function: Run\n"), std::string::npos) << message;
+    EXPECT_NE(message.find("Expected function: PreProcessing"), std::string::npos) << message;
+  }
+}
+
 TEST(task_tests, check_validate_func) {
   // Create data
   std::vector<int32_t> in(20, 1);
@@ -178,7 +218,171 @@ TEST(task_tests, check_wrong_order) {
   ASSERT_ANY_THROW(test_task.PostProcessing());
 }
 
+TEST(task_tests, check_views_are_zero_copy) {
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(3, 0);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  auto input = task_data->GetInput<int32_t>(0);
+  auto output = task_data->GetOutput<int32_t>(0);
+  EXPECT_EQ(input.data(), in.data());
+  EXPECT_EQ(input.size(), in.size());
+  EXPECT_EQ(output.data(), out.data());
+  EXPECT_EQ(output.size(), out.size());
+
+  output[2] = 7;
+  EXPECT_EQ(out[2], 7);
+}
+
+TEST(task_tests, check_views_bounds_and_access) {
+  std::vector<int32_t> in(20, 1);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->inputs.emplace_back(nullptr);
+  task_data->inputs_count.emplace_back(1);
+
+  EXPECT_THROW((void)task_data->GetInput<int32_t>(2), std::out_of_range);
+  EXPECT_THROW((void)task_data->GetOutput<int32_t>(0), std::out_of_range);
+  EXPECT_THROW((void)task_data->GetInput<int32_t>(1), std::invalid_argument);
+  EXPECT_THROW((void)task_data->GetMutableInput<int32_t>(0), std::logic_error);
+
+  task_data->inputs_access = ppc::core::TaskData::kInPlace;
+  auto input = task_data->GetMutableInput<int32_t>(0);
+  input[0] = 5;
+  EXPECT_EQ(in[0], 5);
+}
+
+TEST(task_tests, check_views_alignment) {
+  alignas(64) std::array<uint8_t, 128> buffer{};
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(buffer.data());
+  task_data->inputs_count.emplace_back(8);
+  task_data->inputs.emplace_back(buffer.data() + 1);
+  task_data->inputs_count.emplace_back(8);
+
+  EXPECT_NO_THROW((void)(task_data->GetInput<double, 64>(0)));
+  EXPECT_THROW((void)task_data->GetInput<double>(1), std::invalid_argument);
+  EXPECT_NO_THROW((void)task_data->GetInput<uint8_t>(1));
+}
+
+TEST(task_tests, check_typed_slots) {
+  std::vector<double> in(20, 1.0);
+  std::vector<double> out(1, 0.0);
+  std::vector<int32_t> legacy(4, 2);
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(legacy.data()));
+  task_data->inputs_count.emplace_back(legacy.size());
+  task_data->AddInput(in.data(), in.size());
+  task_data->AddOutput(out.data(), out.size());
+
+  ASSERT_EQ(task_data->inputs.size(), 2U);
+  ASSERT_EQ(task_data->input_slots.size(), 2U);
+  EXPECT_FALSE(task_data->input_slots[0].IsTyped());
+  EXPECT_EQ(task_data->inputs_count[1], in.size());
+  EXPECT_EQ(task_data->input_slots[1].element_size, sizeof(double));
+  EXPECT_GE(task_data->input_slots[1].alignment, alignof(double));
+
+  EXPECT_TRUE(task_data->HasInput<double>(1, in.size()));
+  EXPECT_FALSE(task_data->HasInput<double>(1, in.size() + 1));
+  EXPECT_FALSE(task_data->HasInput<float>(1));
+  EXPECT_TRUE(task_data->HasOutput<double>(0));
+
+  EXPECT_EQ(task_data->GetInput<int32_t>(0).size(), legacy.size());
+  EXPECT_EQ(task_data->GetInput<double>(1).data(), in.data());
+  EXPECT_THROW((void)task_data->GetInput<float>(1), std::invalid_argument);
+  task_data->GetOutput<double>(0)[0] = 3.0;
+  EXPECT_EQ(out[0], 3.0);
+}
+
+TEST(task_tests, check_typed_slots_64bit_extent_and_stride) {
+  std::vector<float> matrix(12, 0.F);
+  for (size_t i = 0; i < matrix.size(); i++) {
+    matrix[i] = static_cast<float>(i);
+  }
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  // Second column of a 4x3 row-major matrix
+  task_data->AddInput(matrix.data() + 1, 4, 3);
+  auto column = task_data->GetStridedInput<float>(0);
+  ASSERT_EQ(column.Size(), 4U);
+  EXPECT_EQ(column[0], 1.F);
+  EXPECT_EQ(column[3], 10.F);
+  EXPECT_THROW((void)task_data->GetInput<float>(0), std::invalid_argument);
+
+  const std::uint64_t huge_extent = std::uint64_t{1} << 33;
+  task_data->AddInput(matrix.data(), huge_extent);
+  EXPECT_EQ(task_data->inputs_count[1], UINT32_MAX);
+  EXPECT_EQ(task_data->input_slots[1].extent, huge_extent);
+}
+
+TEST(task_tests, check_allocated_buffers) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  auto in = task_data->AllocateInput<double>(1000);
+  auto out = task_data->AllocateOutput<int64_t>(1);
+  ASSERT_EQ(in.size(), 1000U);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(in.data()) % ppc::core::kCacheLineSize, 0U);
+  EXPECT_EQ(in[999], 0.0);
+  EXPECT_EQ((task_data->GetInput<double, ppc::core::kCacheLineSize>(0).data()), in.data());
+  EXPECT_EQ(task_data->GetOutput<int64_t>(0).data(), out.data());
+
+  auto big = task_data->AllocateInput<uint8_t>(ppc::core::kHugePageSize);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(big.data()) % ppc::core::kHugePageSize, 0U);
+  EXPECT_EQ(task_data->owned_buffers.size(), 3U);
+}
+
 int main(int argc, char **argv) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();
 }
+
+TEST(task_tests, check_memory_profile_of_stages) {
+  // Create data
+  std::vector<int32_t> in(20, 1);
+  std::vector<int32_t> out(1, 0);
+
+  // Create TaskData
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  constexpr size_t kBlocks = 16;
+  constexpr size_t kBlockSize = size_t{4} << 20;
+  ppc::test::task::AllocatingTask<int32_t> test_task(task_data, kBlocks, kBlockSize);
+
+  // Nothing is recorded while profiling is disabled
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+  EXPECT_TRUE(test_task.GetMemoryProfile().Empty());
+
+  ppc::core::MemoryProfiler::SetEnabled(true);
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+  ppc::core::MemoryProfiler::SetEnabled(false);
+
+  const auto &run = test_task.GetMemoryProfile().stages[2];
+  EXPECT_EQ(run.calls, 1U);
+  if (ppc::core::MemoryProfiler::CountsAllocations()) {
+    EXPECT_GE(run.allocations, kBlocks + 1);
+    EXPECT_EQ(run.deallocations, run.allocations);
+    EXPECT_GE(run.allocated_bytes, kBlocks * kBlockSize);
+    EXPECT_EQ(test_task.GetMemoryProfile().stages[0].allocations, 0U);
+  }
+  if (ppc::core::MemoryProfiler::PeakRss() != 0) {
+    EXPECT_GE(run.peak_rss_delta_bytes, kBlocks * kBlockSize / 2);
+  }
+}
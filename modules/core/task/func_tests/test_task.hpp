@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstddef>
 #include <thread>
 #include <vector>
 
@@ -46,4 +47,25 @@ class FakeSlowTask : public TestTask<T> {
   }
 };
 
+// Allocates num_blocks vectors of block_size bytes in Run and touches every page
+template <class T>
+class AllocatingTask : public TestTask<T> {
+ public:
+  AllocatingTask(ppc::core::TaskDataPtr task_data, size_t num_blocks, size_t block_size)
+      : TestTask<T>(task_data), num_blocks_(num_blocks), block_size_(block_size) {}
+
+  bool RunImpl() override {
+    std::vector<std::vector<char>> blocks;
+    blocks.reserve(num_blocks_);
+    for (size_t i = 0; i < num_blocks_; i++) {
+      blocks.emplace_back(block_size_, 1);
+    }
+    return TestTask<T>::RunImpl();
+  }
+
+ private:
+  size_t num_blocks_;
+  size_t block_size_;
+};
+
 }  // namespace ppc::test::task
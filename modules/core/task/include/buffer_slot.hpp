@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <typeindex>
+#include <typeinfo>
+
+namespace ppc::core {
+
+// Element type, extent and layout of one TaskData buffer
+struct BufferSlot {
+  uint8_t *data = nullptr;
+  // typeid(void) marks a buffer that was added through the raw inputs/outputs vectors
+  std::type_index type = typeid(void);
+  std::size_t element_size = 1;
+  // count of elements
+  std::uint64_t extent = 0;
+  // distance between consecutive elements, in elements
+  std::uint64_t stride = 1;
+  // largest power of two the address is aligned to (capped at 4096)
+  std::size_t alignment = 1;
+
+  [[nodiscard]] bool IsTyped() const { return type != typeid(void); }
+};
+
+// Non-owning view over elements placed every stride elements apart
+template <class T>
+class StridedView {
+ public:
+  StridedView() = default;
+  StridedView(T *data, std::uint64_t extent, std::uint64_t stride) : data_(data), extent_(extent), stride_(stride) {}
+
+  T &operator[](std::uint64_t i) const { return data_[i * stride_]; }
+  [[nodiscard]] std::uint64_t Size() const { return extent_; }
+  [[nodiscard]] std::uint64_t Stride() const { return stride_; }
+  [[nodiscard]] T *Data() const { return data_; }
+
+ private:
+  T *data_ = nullptr;
+  std::uint64_t extent_ = 0;
+  std::uint64_t stride_ = 1;
+};
+
+// Allocate a zeroed buffer owned by TaskData. Small buffers are aligned to a cache line,
+// buffers of at least kHugePageSize bytes to a huge page and advised to use huge pages
+constexpr std::size_t kCacheLineSize = 64;
+constexpr std::size_t kHugePageSize = std::size_t{2} << 20;
+std::shared_ptr<uint8_t> AllocateBuffer(std::size_t bytes);
+
+}  // namespace ppc::core
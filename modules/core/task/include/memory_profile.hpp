@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace ppc::core {
+
+// Heap and resident-set usage of one task stage, accumulated over its calls
+struct StageMemory {
+  uint64_t calls = 0;
+  // operator new/delete calls of the whole process while the stage ran
+  uint64_t allocations = 0;
+  uint64_t deallocations = 0;
+  uint64_t allocated_bytes = 0;
+  // largest growth of the peak resident set over the resident set at stage start
+  uint64_t peak_rss_delta_bytes = 0;
+};
+
+// Per-stage memory usage in Validation, PreProcessing, Run, PostProcessing order
+struct MemoryProfile {
+  static constexpr std::array<const char *, 4> kStageNames = {"validation", "pre_processing", "run",
+                                                              "post_processing"};
+  std::array<StageMemory, 4> stages;
+
+  [[nodiscard]] bool Empty() const;
+  // allocated_bytes summed over all stages
+  [[nodiscard]] uint64_t AllocatedBytes() const;
+};
+
+// Process-wide switch for stage memory profiling. The core library replaces the global
+// operator new/delete (except on Windows and in sanitizer builds) with malloc-based versions
+// that only count while profiling is enabled; when it is disabled a stage pays one relaxed
+// atomic load
+class MemoryProfiler {
+ public:
+  struct Counters {
+    uint64_t allocations = 0;
+    uint64_t deallocations = 0;
+    uint64_t allocated_bytes = 0;
+  };
+
+  static bool Enabled() { return enabled_.load(std::memory_order_relaxed); }
+  static void SetEnabled(bool value) { enabled_.store(value, std::memory_order_relaxed); }
+  // Profiling is requested by PerfAttr::collect_memory or the PPC_MEMORY_PROFILE environment variable
+  static bool EnabledByEnvironment();
+
+  // false where operator new is not replaced, allocation counts then stay zero
+  static bool CountsAllocations();
+  static Counters Snapshot();
+
+  // Resident set and its peak, in bytes (0 when unknown). ResetPeakRss makes the peak equal
+  // to the current resident set, where the kernel allows it
+  static uint64_t CurrentRss();
+  static uint64_t PeakRss();
+  static bool ResetPeakRss();
+
+ private:
+  static std::atomic<bool> enabled_;
+};
+
+// Measures one stage call when profiling is enabled
+class StageMemoryProbe {
+ public:
+  StageMemoryProbe();
+  void Finish(StageMemory &stage) const;
+
+ private:
+  bool active_;
+  MemoryProfiler::Counters start_;
+  uint64_t start_rss_ = 0;
+};
+
+}  // namespace ppc::core
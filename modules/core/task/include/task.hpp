@@ -1,11 +1,21 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <typeinfo>
 #include <vector>
 
+#include "core/task/include/buffer_slot.hpp"
+#include "core/task/include/memory_profile.hpp"
+
 namespace ppc::core {
 
 struct TaskData {
@@ -14,6 +24,165 @@ struct TaskData {
   std::vector<uint8_t *> outputs;
   std::vector<std::uint32_t> outputs_count;
   enum StateOfTesting : uint8_t { kFunc, kPerf } state_of_testing;
+  // Buffers are owned by the caller and outlive the task, so views over them stay valid
+  // until PostProcessing returns. kInPlace allows the task to overwrite its inputs
+  enum InputsAccess : uint8_t { kReadOnly, kInPlace } inputs_access = kReadOnly;
+  // Typed description of inputs/outputs added through AddInput/AddOutput, index-aligned
+  // with the raw vectors. Raw counts saturate at UINT32_MAX, slots keep 64-bit extents
+  std::vector<BufferSlot> input_slots;
+  std::vector<BufferSlot> output_slots;
+  // Buffers allocated through AllocateInput/AllocateOutput
+  std::vector<std::shared_ptr<uint8_t>> owned_buffers;
+
+  template <class T>
+  void AddInput(T *data, std::uint64_t extent, std::uint64_t stride = 1) {
+    AddSlot(inputs, inputs_count, input_slots, data, extent, stride);
+  }
+
+  template <class T>
+  void AddOutput(T *data, std::uint64_t extent, std::uint64_t stride = 1) {
+    AddSlot(outputs, outputs_count, output_slots, data, extent, stride);
+  }
+
+  // Framework-allocated buffers, aligned (huge-page aligned when large) and zeroed
+  template <class T>
+  std::span<T> AllocateInput(std::uint64_t extent) {
+    auto *data = Allocate<T>(extent);
+    AddInput(data, extent);
+    return {data, static_cast<std::size_t>(extent)};
+  }
+
+  template <class T>
+  std::span<T> AllocateOutput(std::uint64_t extent) {
+    auto *data = Allocate<T>(extent);
+    AddOutput(data, extent);
+    return {data, static_cast<std::size_t>(extent)};
+  }
+
+  // Zero-copy typed views over caller buffers, checked against counts, element type and alignment
+  template <class T, std::size_t Alignment = alignof(T)>
+  [[nodiscard]] std::span<const T> GetInput(std::size_t index) const {
+    return MakeView<const T, Alignment>(inputs, inputs_count, input_slots, index, "input");
+  }
+
+  template <class T, std::size_t Alignment = alignof(T)>
+  [[nodiscard]] std::span<T> GetMutableInput(std::size_t index) const {
+    if (inputs_access != kInPlace) {
+      throw std::logic_error("TaskData: inputs are read-only, set inputs_access to kInPlace");
+    }
+    return MakeView<T, Alignment>(inputs, inputs_count, input_slots, index, "input");
+  }
+
+  template <class T, std::size_t Alignment = alignof(T)>
+  [[nodiscard]] std::span<T> GetOutput(std::size_t index) const {
+    return MakeView<T, Alignment>(outputs, outputs_count, output_slots, index, "output");
+  }
+
+  // Views over slots added with a stride
+  template <class T>
+  [[nodiscard]] StridedView<const T> GetStridedInput(std::size_t index) const {
+    const auto &slot = CheckSlot<T>(input_slots, index, "input");
+    return {reinterpret_cast<const T *>(slot.data), slot.extent, slot.stride};
+  }
+
+  template <class T>
+  [[nodiscard]] StridedView<T> GetStridedOutput(std::size_t index) const {
+    const auto &slot = CheckSlot<T>(output_slots, index, "output");
+    return {reinterpret_cast<T *>(slot.data), slot.extent, slot.stride};
+  }
+
+  // Validation helpers: typed slot of element type T with at least min_extent elements
+  template <class T>
+  [[nodiscard]] bool HasInput(std::size_t index, std::uint64_t min_extent = 1) const {
+    return HasSlot<T>(input_slots, index, min_extent);
+  }
+
+  template <class T>
+  [[nodiscard]] bool HasOutput(std::size_t index, std::uint64_t min_extent = 1) const {
+    return HasSlot<T>(output_slots, index, min_extent);
+  }
+
+ private:
+  template <class T>
+  static void AddSlot(std::vector<uint8_t *> &buffers, std::vector<std::uint32_t> &counts,
+                      std::vector<BufferSlot> &slots, T *data, std::uint64_t extent, std::uint64_t stride) {
+    if (stride == 0) {
+      throw std::invalid_argument("TaskData: stride must be positive");
+    }
+    // Slots for buffers pushed into the raw vectors directly stay untyped
+    while (slots.size() < buffers.size()) {
+      slots.push_back({.data = buffers[slots.size()], .extent = counts[slots.size()]});
+    }
+    auto *bytes = reinterpret_cast<uint8_t *>(const_cast<std::remove_const_t<T> *>(data));
+    const auto address = reinterpret_cast<std::uintptr_t>(bytes);
+    const std::size_t alignment = address == 0 ? 4096 : std::min<std::uintptr_t>(address & (~address + 1), 4096);
+    slots.push_back({.data = bytes,
+                     .type = typeid(std::remove_cv_t<T>),
+                     .element_size = sizeof(T),
+                     .extent = extent,
+                     .stride = stride,
+                     .alignment = alignment});
+    buffers.push_back(bytes);
+    counts.push_back(static_cast<std::uint32_t>(std::min<std::uint64_t>(extent, UINT32_MAX)));
+  }
+
+  template <class T>
+  T *Allocate(std::uint64_t extent) {
+    static_assert(std::is_trivially_destructible_v<T>, "framework buffers hold trivially destructible types");
+    if (extent > SIZE_MAX / sizeof(T)) {
+      throw std::length_error("TaskData: buffer is too large");
+    }
+    owned_buffers.push_back(AllocateBuffer(static_cast<std::size_t>(extent) * sizeof(T)));
+    return reinterpret_cast<T *>(owned_buffers.back().get());
+  }
+
+  template <class T>
+  static bool HasSlot(const std::vector<BufferSlot> &slots, std::size_t index, std::uint64_t min_extent) {
+    return index < slots.size() && slots[index].type == typeid(std::remove_cv_t<T>) &&
+           slots[index].extent >= min_extent;
+  }
+
+  template <class T>
+  static const BufferSlot &CheckSlot(const std::vector<BufferSlot> &slots, std::size_t index, const char *kind) {
+    if (index >= slots.size() || !slots[index].IsTyped()) {
+      throw std::out_of_range(std::string("TaskData: no typed ") + kind + " with index " + std::to_string(index));
+    }
+    const auto &slot = slots[index];
+    if (slot.type != typeid(std::remove_cv_t<T>)) {
+      throw std::invalid_argument(std::string("TaskData: ") + kind + " " + std::to_string(index) + " holds " +
+                                  slot.type.name() + ", requested " + typeid(T).name());
+    }
+    return slot;
+  }
+
+  template <class T, std::size_t Alignment>
+  static std::span<T> MakeView(const std::vector<uint8_t *> &buffers, const std::vector<std::uint32_t> &counts,
+                               const std::vector<BufferSlot> &slots, std::size_t index, const char *kind) {
+    static_assert(Alignment >= alignof(T) && (Alignment & (Alignment - 1)) == 0, "invalid alignment");
+    if (index >= buffers.size() || index >= counts.size()) {
+      throw std::out_of_range(std::string("TaskData: no ") + kind + " with index " + std::to_string(index));
+    }
+    std::uint64_t extent = counts[index];
+    if (index < slots.size() && slots[index].IsTyped()) {
+      const auto &slot = CheckSlot<T>(slots, index, kind);
+      if (slot.stride != 1) {
+        throw std::invalid_argument(std::string("TaskData: ") + kind + " " + std::to_string(index) +
+                                    " is strided, use a strided view");
+      }
+      extent = slot.extent;
+    }
+    if (extent == 0) {
+      return {};
+    }
+    if (buffers[index] == nullptr) {
+      throw std::invalid_argument(std::string("TaskData: ") + kind + " " + std::to_string(index) + " is null");
+    }
+    if (reinterpret_cast<std::uintptr_t>(buffers[index]) % Alignment != 0) {
+      throw std::invalid_argument(std::string("TaskData: ") + kind + " " + std::to_string(index) +
+                                  " is not aligned to " + std::to_string(Alignment) + " bytes");
+    }
+    return {reinterpret_cast<T *>(buffers[index]), static_cast<std::size_t>(extent)};
+  }
 };
 
 using TaskDataPtr = std::shared_ptr<ppc::core::TaskData>;
@@ -42,10 +211,18 @@ class Task {
   // get input and output data
   [[nodiscard]] TaskDataPtr GetData() const;
 
+  // memory usage of the stages called while MemoryProfiler was enabled
+  [[nodiscard]] const MemoryProfile &GetMemoryProfile() const { return memory_profile_; }
+  void ResetMemoryProfile() { memory_profile_ = {}; }
+
   virtual ~Task();
 
  protected:
-  void InternalOrderTest(const std::string &str = __builtin_FUNCTION());
+  enum Stage : uint8_t { kValidation, kPreProcessing, kRun, kPostProcessing, kNumStages };
+
+  // Checks that stages go Validation -> PreProcessing -> Run (repeatable) -> PostProcessing
+  // in cycles; constant time and allocation free, throws invalid_argument otherwise
+  void InternalOrderTest(Stage stage);
   TaskDataPtr task_data;
 
   // implementation of "validation" function
@@ -61,8 +238,12 @@ class Task {
   virtual bool PostProcessingImpl() = 0;
 
  private:
-  std::vector<std::string> functions_order_;
-  std::vector<std::string> right_functions_order_ = {"Validation", "PreProcessing", "Run", "PostProcessing"};
+  static constexpr std::array<const char *, kNumStages> kStageNames = {"Validation", "PreProcessing", "Run",
+                                                                      "PostProcessing"};
+  // last accepted stage (kNumStages before the first call) and count of accepted calls
+  Stage last_stage_ = kNumStages;
+  uint64_t num_calls_ = 0;
+  MemoryProfile memory_profile_;
   const double max_test_time_ = 1.0;
   std::chrono::high_resolution_clock::time_point tmp_time_point_;
 };
@@ -0,0 +1,35 @@
+#include "core/task/include/buffer_slot.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+std::shared_ptr<uint8_t> ppc::core::AllocateBuffer(std::size_t bytes) {
+  const std::size_t alignment = bytes >= kHugePageSize ? kHugePageSize : kCacheLineSize;
+  const std::size_t padded = std::max<std::size_t>(alignment, (bytes + alignment - 1) / alignment * alignment);
+#ifdef _WIN32
+  void *ptr = _aligned_malloc(padded, alignment);
+  auto deleter = [](uint8_t *p) { _aligned_free(p); };
+#else
+  void *ptr = std::aligned_alloc(alignment, padded);
+  auto deleter = [](uint8_t *p) { std::free(p); };
+#endif
+  if (ptr == nullptr) {
+    throw std::bad_alloc();
+  }
+#ifdef __linux__
+  if (alignment == kHugePageSize) {
+    madvise(ptr, padded, MADV_HUGEPAGE);
+  }
+#endif
+  std::memset(ptr, 0, padded);
+  return {static_cast<uint8_t *>(ptr), deleter};
+}
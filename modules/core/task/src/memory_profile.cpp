@@ -0,0 +1,217 @@
+#include "core/task/include/memory_profile.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <string>
+
+// The allocation functions are left alone on Windows and under sanitizers, which rely on their own
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer)
+#define PPC_SANITIZED_BUILD
+#endif
+#endif
+#if !defined(_WIN32) && !defined(PPC_SANITIZED_BUILD) && !defined(__SANITIZE_ADDRESS__) && !defined(__SANITIZE_THREAD__)
+#define PPC_COUNT_ALLOCATIONS
+#endif
+
+namespace {
+
+std::atomic<uint64_t> allocations{0};
+std::atomic<uint64_t> deallocations{0};
+std::atomic<uint64_t> allocated_bytes{0};
+
+#ifdef __linux__
+// Value of a "Name:   123 kB" line of /proc/self/status, in bytes
+uint64_t ReadStatusKb(const std::string &name) {
+  std::ifstream status("/proc/self/status");
+  std::string key;
+  uint64_t value = 0;
+  while (status >> key) {
+    if (key == name + ":") {
+      status >> value;
+      return value * 1024;
+    }
+    status.ignore(256, '\n');
+  }
+  return 0;
+}
+#endif
+
+#ifdef PPC_COUNT_ALLOCATIONS
+void *CountedAllocate(std::size_t size, std::size_t alignment) {
+  if (ppc::core::MemoryProfiler::Enabled()) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+  }
+  const std::size_t bytes = std::max<std::size_t>(size, 1);
+  while (true) {
+    void *ptr = alignment <= alignof(std::max_align_t)
+                    ? std::malloc(bytes)
+                    : std::aligned_alloc(alignment, (bytes + alignment - 1) / alignment * alignment);
+    if (ptr != nullptr) {
+      return ptr;
+    }
+    auto handler = std::get_new_handler();
+    if (handler == nullptr) {
+      throw std::bad_alloc();
+    }
+    handler();
+  }
+}
+
+void *CountedAllocateNoThrow(std::size_t size, std::size_t alignment) noexcept {
+  try {
+    return CountedAllocate(size, alignment);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void CountedFree(void *ptr) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+  if (ppc::core::MemoryProfiler::Enabled()) {
+    deallocations.fetch_add(1, std::memory_order_relaxed);
+  }
+  std::free(ptr);
+}
+#endif
+
+}  // namespace
+
+std::atomic<bool> ppc::core::MemoryProfiler::enabled_{false};
+
+bool ppc::core::MemoryProfile::Empty() const {
+  return std::ranges::all_of(stages, [](const StageMemory &stage) { return stage.calls == 0; });
+}
+
+uint64_t ppc::core::MemoryProfile::AllocatedBytes() const {
+  uint64_t bytes = 0;
+  for (const auto &stage : stages) {
+    bytes += stage.allocated_bytes;
+  }
+  return bytes;
+}
+
+bool ppc::core::MemoryProfiler::EnabledByEnvironment() {
+#ifdef _WIN32
+  size_t len;
+  char value[16];
+  errno_t err = getenv_s(&len, value, sizeof(value), "PPC_MEMORY_PROFILE");
+  return err == 0 && len > 1 && std::string(value) != "0";
+#else
+  const char *value = std::getenv("PPC_MEMORY_PROFILE");
+  return value != nullptr && std::string(value) != "" && std::string(value) != "0";
+#endif
+}
+
+bool ppc::core::MemoryProfiler::CountsAllocations() {
+#ifdef PPC_COUNT_ALLOCATIONS
+  return true;
+#else
+  return false;
+#endif
+}
+
+ppc::core::MemoryProfiler::Counters ppc::core::MemoryProfiler::Snapshot() {
+  return {.allocations = allocations.load(std::memory_order_relaxed),
+          .deallocations = deallocations.load(std::memory_order_relaxed),
+          .allocated_bytes = allocated_bytes.load(std::memory_order_relaxed)};
+}
+
+uint64_t ppc::core::MemoryProfiler::CurrentRss() {
+#ifdef __linux__
+  return ReadStatusKb("VmRSS");
+#else
+  return 0;
+#endif
+}
+
+uint64_t ppc::core::MemoryProfiler::PeakRss() {
+#ifdef __linux__
+  return ReadStatusKb("VmHWM");
+#else
+  return 0;
+#endif
+}
+
+bool ppc::core::MemoryProfiler::ResetPeakRss() {
+#ifdef __linux__
+  std::ofstream clear_refs("/proc/self/clear_refs");
+  clear_refs << "5";
+  clear_refs.flush();
+  return static_cast<bool>(clear_refs);
+#else
+  return false;
+#endif
+}
+
+ppc::core::StageMemoryProbe::StageMemoryProbe() : active_(MemoryProfiler::Enabled()) {
+  if (active_) {
+    MemoryProfiler::ResetPeakRss();
+    start_rss_ = MemoryProfiler::CurrentRss();
+    start_ = MemoryProfiler::Snapshot();
+  }
+}
+
+void ppc::core::StageMemoryProbe::Finish(StageMemory &stage) const {
+  if (!active_) {
+    return;
+  }
+  const auto end = MemoryProfiler::Snapshot();
+  const uint64_t peak_rss = MemoryProfiler::PeakRss();
+  stage.calls++;
+  stage.allocations += end.allocations - start_.allocations;
+  stage.deallocations += end.deallocations - start_.deallocations;
+  stage.allocated_bytes += end.allocated_bytes - start_.allocated_bytes;
+  const uint64_t rss_delta = peak_rss > start_rss_ ? peak_rss - start_rss_ : 0;
+  stage.peak_rss_delta_bytes = std::max(stage.peak_rss_delta_bytes, rss_delta);
+}
+
+#ifdef PPC_COUNT_ALLOCATIONS
+// Replacement of the global allocation functions, counting while profiling is enabled
+
+void *operator new(std::size_t size) { return CountedAllocate(size, 0); }
+void *operator new[](std::size_t size) { return CountedAllocate(size, 0); }
+void *operator new(std::size_t size, const std::nothrow_t & /*tag*/) noexcept {
+  return CountedAllocateNoThrow(size, 0);
+}
+void *operator new[](std::size_t size, const std::nothrow_t & /*tag*/) noexcept {
+  return CountedAllocateNoThrow(size, 0);
+}
+void *operator new(std::size_t size, std::align_val_t alignment) {
+  return CountedAllocate(size, static_cast<std::size_t>(alignment));
+}
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+  return CountedAllocate(size, static_cast<std::size_t>(alignment));
+}
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t & /*tag*/) noexcept {
+  return CountedAllocateNoThrow(size, static_cast<std::size_t>(alignment));
+}
+void *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t & /*tag*/) noexcept {
+  return CountedAllocateNoThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *ptr) noexcept { CountedFree(ptr); }
+void operator delete[](void *ptr) noexcept { CountedFree(ptr); }
+void operator delete(void *ptr, std::size_t /*size*/) noexcept { CountedFree(ptr); }
+void operator delete[](void *ptr, std::size_t /*size*/) noexcept { CountedFree(ptr); }
+void operator delete(void *ptr, const std::nothrow_t & /*tag*/) noexcept { CountedFree(ptr); }
+void operator delete[](void *ptr, const std::nothrow_t & /*tag*/) noexcept { CountedFree(ptr); }
+void operator delete(void *ptr, std::align_val_t /*alignment*/) noexcept { CountedFree(ptr); }
+void operator delete[](void *ptr, std::align_val_t /*alignment*/) noexcept { CountedFree(ptr); }
+void operator delete(void *ptr, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept { CountedFree(ptr); }
+void operator delete[](void *ptr, std::size_t /*size*/, std::align_val_t /*alignment*/) noexcept { CountedFree(ptr); }
+void operator delete(void *ptr, std::align_val_t /*alignment*/, const std::nothrow_t & /*tag*/) noexcept {
+  CountedFree(ptr);
+}
+void operator delete[](void *ptr, std::align_val_t /*alignment*/, const std::nothrow_t & /*tag*/) noexcept {
+  CountedFree(ptr);
+}
+#endif
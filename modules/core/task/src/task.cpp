@@ -7,9 +7,12 @@
 #include <stdexcept>
 #include <string>
 
+#include "core/task/include/memory_profile.hpp"
+
 void ppc::core::Task::SetData(TaskDataPtr task_data_ptr) {
   task_data_ptr->state_of_testing = TaskData::StateOfTesting::kFunc;
-  functions_order_.clear();
+  last_stage_ = kNumStages;
+  num_calls_ = 0;
   this->task_data = std::move(task_data_ptr);
 }
 
@@ -18,45 +21,57 @@ ppc::core::TaskDataPtr ppc::core::Task::GetData() const { return task_data; }
 ppc::core::Task::Task(TaskDataPtr task_data) { SetData(std::move(task_data)); }
 
 bool ppc::core::Task::Validation() {
-  InternalOrderTest();
-  return ValidationImpl();
+  InternalOrderTest(kValidation);
+  StageMemoryProbe probe;
+  const bool result = ValidationImpl();
+  probe.Finish(memory_profile_.stages[kValidation]);
+  return result;
 }
 
 bool ppc::core::Task::PreProcessing() {
-  InternalOrderTest();
-  return PreProcessingImpl();
+  InternalOrderTest(kPreProcessing);
+  StageMemoryProbe probe;
+  const bool result = PreProcessingImpl();
+  probe.Finish(memory_profile_.stages[kPreProcessing]);
+  return result;
 }
 
 bool ppc::core::Task::Run() {
-  InternalOrderTest();
-  return RunImpl();
+  InternalOrderTest(kRun);
+  StageMemoryProbe probe;
+  const bool result = RunImpl();
+  probe.Finish(memory_profile_.stages[kRun]);
+  return result;
 }
 
 bool ppc::core::Task::PostProcessing() {
-  InternalOrderTest();
-  return PostProcessingImpl();
+  InternalOrderTest(kPostProcessing);
+  StageMemoryProbe probe;
+  const bool result = PostProcessingImpl();
+  probe.Finish(memory_profile_.stages[kPostProcessing]);
+  return result;
 }
 
-void ppc::core::Task::InternalOrderTest(const std::string& str) {
-  if (!functions_order_.empty() && str == functions_order_.back() && str == "Run") {
+void ppc::core::Task::InternalOrderTest(Stage stage) {
+  if (stage == kRun && last_stage_ == kRun) {
     return;
   }
 
-  functions_order_.push_back(str);
-
-  for (size_t i = 0; i < functions_order_.size(); i++) {
-    if (functions_order_[i] != right_functions_order_[i % right_functions_order_.size()]) {
-      throw std::invalid_argument("ORDER OF FUCTIONS IS NOT RIGHT: \n" + std::string("Serial number: ") +
-                                  std::to_string(i + 1) + "\n" + std::string("Yours function: ") + functions_order_[i] +
-                                  "\n" + std::string("Expected function: ") + right_functions_order_[i]);
-    }
+  const auto expected = static_cast<Stage>(last_stage_ == kNumStages ? kValidation : (last_stage_ + 1) % kNumStages);
+  if (stage != expected) {
+    throw std::invalid_argument("ORDER OF FUCTIONS IS NOT RIGHT: \n" + std::string("Serial number: ") +
+                                std::to_string(num_calls_ + 1) + "\n" + std::string("Yours function: ") +
+                                kStageNames[stage] + "\n" + std::string("Expected function: ") +
+                                kStageNames[expected]);
   }
+  last_stage_ = stage;
+  num_calls_++;
 
-  if (str == "PreProcessing" && task_data->state_of_testing == TaskData::StateOfTesting::kFunc) {
+  if (stage == kPreProcessing && task_data->state_of_testing == TaskData::StateOfTesting::kFunc) {
     tmp_time_point_ = std::chrono::high_resolution_clock::now();
   }
 
-  if (str == "PostProcessing" && task_data->state_of_testing == TaskData::StateOfTesting::kFunc) {
+  if (stage == kPostProcessing && task_data->state_of_testing == TaskData::StateOfTesting::kFunc) {
     auto end = std::chrono::high_resolution_clock::now();
     auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - tmp_time_point_).count();
     auto current_time = static_cast<double>(duration) * 1e-9;
@@ -72,4 +87,4 @@ void ppc::core::Task::InternalOrderTest(const std::string& str) {
   }
 }
 
-ppc::core::Task::~Task() { functions_order_.clear(); }
+ppc::core::Task::~Task() = default;
@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "core/thread_pool/include/thread_pool.hpp"
+
+namespace {
+
+void CheckCoverage(ppc::core::ThreadPool &pool, ppc::core::ThreadPool::Schedule schedule, int64_t chunk) {
+  constexpr int64_t kCount = 10007;
+  std::vector<std::atomic<int>> hits(kCount);
+  pool.ParallelFor(
+      0, kCount,
+      [&](int64_t begin, int64_t end) {
+        for (int64_t i = begin; i < end; i++) {
+          hits[i]++;
+        }
+      },
+      schedule, chunk);
+  for (int64_t i = 0; i < kCount; i++) {
+    ASSERT_EQ(hits[i].load(), 1) << "index " << i;
+  }
+}
+
+}  // namespace
+
+TEST(thread_pool_tests, parallel_for_covers_range_once) {
+  ppc::core::ThreadPool pool(4);
+  ASSERT_EQ(pool.NumThreads(), 4);
+  CheckCoverage(pool, ppc::core::ThreadPool::kStatic, 0);
+  CheckCoverage(pool, ppc::core::ThreadPool::kStatic, 13);
+  CheckCoverage(pool, ppc::core::ThreadPool::kDynamic, 0);
+  CheckCoverage(pool, ppc::core::ThreadPool::kDynamic, 7);
+  CheckCoverage(pool, ppc::core::ThreadPool::kGuided, 0);
+  CheckCoverage(pool, ppc::core::ThreadPool::kGuided, 32);
+}
+
+TEST(thread_pool_tests, parallel_for_on_single_thread_pool) {
+  ppc::core::ThreadPool pool(1);
+  CheckCoverage(pool, ppc::core::ThreadPool::kDynamic, 3);
+}
+
+TEST(thread_pool_tests, concurrency_limits_participants) {
+  ppc::core::ThreadPool pool(4);
+  pool.SetConcurrency(2);
+  EXPECT_EQ(pool.Concurrency(), 2);
+  std::atomic<int> chunks = 0;
+  pool.ParallelFor(0, 100, [&](int64_t, int64_t) { chunks++; });
+  EXPECT_EQ(chunks, 2);
+  CheckCoverage(pool, ppc::core::ThreadPool::kGuided, 0);
+
+  pool.SetConcurrency(100);
+  EXPECT_EQ(pool.Concurrency(), 4);
+}
+
+TEST(thread_pool_tests, parallel_reduce_sum) {
+  ppc::core::ThreadPool pool(3);
+  std::vector<int64_t> values(100000);
+  std::iota(values.begin(), values.end(), 1);
+  for (auto schedule :
+       {ppc::core::ThreadPool::kStatic, ppc::core::ThreadPool::kDynamic, ppc::core::ThreadPool::kGuided}) {
+    auto sum = pool.ParallelReduce(
+        int64_t{0}, static_cast<int64_t>(values.size()), int64_t{0},
+        [&](int64_t begin, int64_t end, int64_t acc) {
+          for (int64_t i = begin; i < end; i++) {
+            acc += values[i];
+          }
+          return acc;
+        },
+        [](int64_t a, int64_t b) { return a + b; }, schedule);
+    EXPECT_EQ(sum, int64_t{100000} * 100001 / 2);
+  }
+}
+
+TEST(thread_pool_tests, task_group_runs_nested_jobs) {
+  ppc::core::ThreadPool pool(4);
+  std::atomic<int> counter{0};
+  ppc::core::TaskGroup group(pool);
+  for (int i = 0; i < 8; i++) {
+    group.Run([&] {
+      pool.ParallelFor(0, 100, [&](int64_t begin, int64_t end) { counter += static_cast<int>(end - begin); });
+    });
+  }
+  group.Wait();
+  EXPECT_EQ(counter.load(), 800);
+}
+
+TEST(thread_pool_tests, task_group_rethrows) {
+  ppc::core::ThreadPool pool(2);
+  ppc::core::TaskGroup group(pool);
+  group.Run([] { throw std::runtime_error("job failed"); });
+  group.Run([] {});
+  EXPECT_THROW(group.Wait(), std::runtime_error);
+}
+
+TEST(thread_pool_tests, pool_versus_spawn_per_run) {
+  constexpr int kThreads = 4;
+  constexpr int kRuns = 200;
+  constexpr int64_t kCount = 4096;
+  std::vector<double> data(kCount, 1.0);
+
+  auto work = [&](int64_t begin, int64_t end) {
+    for (int64_t i = begin; i < end; i++) {
+      data[i] = (data[i] * 0.5) + 1.0;
+    }
+  };
+
+  auto t0 = std::chrono::high_resolution_clock::now();
+  for (int run = 0; run < kRuns; run++) {
+    std::vector<std::thread> threads(kThreads);
+    for (int t = 0; t < kThreads; t++) {
+      threads[t] = std::thread(work, kCount * t / kThreads, kCount * (t + 1) / kThreads);
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+  auto t1 = std::chrono::high_resolution_clock::now();
+
+  ppc::core::ThreadPool pool(kThreads);
+  for (int run = 0; run < kRuns; run++) {
+    pool.ParallelFor(0, kCount, work);
+  }
+  auto t2 = std::chrono::high_resolution_clock::now();
+
+  const auto spawn_us = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+  const auto pool_us = std::chrono::duration_cast<std::chrono::microseconds>(t2 - t1).count();
+  std::cout << "spawn per run: " << spawn_us / kRuns << " us/run, pool: " << pool_us / kRuns << " us/run\n";
+  EXPECT_NEAR(data[0], 2.0, 1e-9);
+  EXPECT_NEAR(data[kCount - 1], 2.0, 1e-9);
+}
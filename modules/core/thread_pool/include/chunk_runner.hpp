@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ppc::core {
+
+// Runs body(0), ..., body(count - 1), possibly concurrently, and returns when all have finished
+using ChunkRunner = std::function<void(std::size_t count, const std::function<void(std::size_t)> &body)>;
+
+// The ChunkRunner of a sequential task, and the fallback of the kernels that take an empty one
+inline void RunSequential(std::size_t count, const std::function<void(std::size_t)> &body) {
+  for (std::size_t chunk = 0; chunk < count; chunk++) {
+    body(chunk);
+  }
+}
+
+}  // namespace ppc::core
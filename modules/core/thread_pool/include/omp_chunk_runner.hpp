@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "core/thread_pool/include/chunk_runner.hpp"
+
+namespace ppc::core {
+
+// The ChunkRunner of an OpenMP task: the chunks are split statically over the team, so a sweep that
+// repeats every iteration hands each thread the same chunks and finds them in its cache.
+// Only for translation units built with OpenMP
+inline void RunOmp(std::size_t count, const std::function<void(std::size_t)> &body) {
+  const auto chunks = static_cast<int64_t>(count);
+#pragma omp parallel for schedule(static)
+  for (int64_t chunk = 0; chunk < chunks; chunk++) {
+    body(static_cast<std::size_t>(chunk));
+  }
+}
+
+}  // namespace ppc::core
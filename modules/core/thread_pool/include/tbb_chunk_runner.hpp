@@ -0,0 +1,18 @@
+#pragma once
+
+#include <oneapi/tbb/parallel_for.h>
+
+#include <cstddef>
+#include <functional>
+
+#include "core/thread_pool/include/chunk_runner.hpp"
+
+namespace ppc::core {
+
+// The ChunkRunner of a TBB task: one parallel_for over the chunks, in the arena of the caller.
+// Only for targets linked with TBB
+inline void RunTbb(std::size_t count, const std::function<void(std::size_t)> &body) {
+  oneapi::tbb::parallel_for(std::size_t{0}, count, [&body](std::size_t chunk) { body(chunk); });
+}
+
+}  // namespace ppc::core
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ppc::core {
+
+// Persistent work-stealing pool. The thread that waits for work takes part in it,
+// so a pool of NumThreads() threads spawns NumThreads() - 1 workers
+class ThreadPool {
+ public:
+  // How iterations of ParallelFor/ParallelReduce are handed out:
+  // kStatic - contiguous equal blocks (or round-robin chunks if chunk is set), deterministic
+  // kDynamic - chunks of a fixed size taken from a shared counter
+  // kGuided - chunks proportional to the remaining work, never smaller than chunk
+  enum Schedule : uint8_t { kStatic, kDynamic, kGuided };
+
+  explicit ThreadPool(int num_threads);
+  ~ThreadPool();
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+  ThreadPool(ThreadPool &&) = delete;
+  ThreadPool &operator=(ThreadPool &&) = delete;
+
+  // Process-wide pool sized by ppc::util::GetPPCNumThreads() on first use
+  static ThreadPool &Global();
+
+  [[nodiscard]] int NumThreads() const { return static_cast<int>(workers_.size()) + 1; }
+  // Threads taking part in ParallelFor/ParallelReduce, at most NumThreads(); lets thread
+  // sweeps reuse one pool instead of recreating it per thread count
+  [[nodiscard]] int Concurrency() const { return concurrency_.load(std::memory_order_relaxed); }
+  void SetConcurrency(int concurrency) {
+    concurrency_.store(std::clamp(concurrency, 1, NumThreads()), std::memory_order_relaxed);
+  }
+
+  void Submit(std::function<void()> job);
+  // Execute one queued job on the calling thread, false if there was nothing to do
+  bool RunPendingJob();
+
+  // body(chunk_begin, chunk_end) is called for disjoint chunks covering [begin, end)
+  template <class Body>
+  void ParallelFor(int64_t begin, int64_t end, Body &&body, Schedule schedule = kStatic, int64_t chunk = 0);
+
+  // body(chunk_begin, chunk_end, accumulator) returns the new accumulator; per-thread results
+  // are combined in thread order, so kStatic reductions are deterministic
+  template <class T, class Body, class Combine>
+  T ParallelReduce(int64_t begin, int64_t end, T identity, Body &&body, Combine &&combine,
+                   Schedule schedule = kStatic, int64_t chunk = 0);
+
+ private:
+  struct Worker {
+    std::deque<std::function<void()>> jobs;
+    std::mutex mutex;
+  };
+
+  bool TryPop(int index, std::function<void()> &job);
+  void WorkerLoop(int index);
+
+  // Runs runner(participant) on `participants` threads including the caller
+  template <class Runner>
+  void RunParticipants(int participants, Runner &runner);
+
+  std::vector<std::unique_ptr<Worker>> queues_;
+  std::deque<std::function<void()>> injected_;
+  std::mutex injected_mutex_;
+  std::atomic<int64_t> pending_{0};
+  std::mutex sleep_mutex_;
+  std::condition_variable wake_;
+  bool stop_ = false;
+  std::vector<std::thread> workers_;
+  std::atomic<int> concurrency_{1};
+};
+
+// Set of jobs that can be waited for together; Wait() helps executing queued jobs
+class TaskGroup {
+ public:
+  explicit TaskGroup(ThreadPool &pool = ThreadPool::Global()) : pool_(pool) {}
+  ~TaskGroup();
+  TaskGroup(const TaskGroup &) = delete;
+  TaskGroup &operator=(const TaskGroup &) = delete;
+  TaskGroup(TaskGroup &&) = delete;
+  TaskGroup &operator=(TaskGroup &&) = delete;
+
+  template <class Func>
+  void Run(Func &&func) {
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    pool_.Submit([this, f = std::forward<Func>(func)]() mutable {
+      try {
+        f();
+      } catch (...) {
+        std::lock_guard lock(error_mutex_);
+        if (!error_) {
+          error_ = std::current_exception();
+        }
+      }
+      pending_.fetch_sub(1, std::memory_order_acq_rel);
+    });
+  }
+
+  // Blocks until all jobs of the group finished, rethrows the first exception
+  void Wait();
+
+ private:
+  ThreadPool &pool_;
+  std::atomic<int64_t> pending_{0};
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+};
+
+template <class Runner>
+void ThreadPool::RunParticipants(int participants, Runner &runner) {
+  TaskGroup group(*this);
+  for (int id = 1; id < participants; id++) {
+    group.Run([&runner, id] { runner(id); });
+  }
+  runner(0);
+  group.Wait();
+}
+
+template <class Body>
+void ThreadPool::ParallelFor(int64_t begin, int64_t end, Body &&body, Schedule schedule, int64_t chunk) {
+  ParallelReduce(
+      begin, end, 0,
+      [&body](int64_t chunk_begin, int64_t chunk_end, int acc) {
+        body(chunk_begin, chunk_end);
+        return acc;
+      },
+      [](int a, int) { return a; }, schedule, chunk);
+}
+
+template <class T, class Body, class Combine>
+T ThreadPool::ParallelReduce(int64_t begin, int64_t end, T identity, Body &&body, Combine &&combine,
+                             Schedule schedule, int64_t chunk) {
+  const int64_t count = end - begin;
+  if (count <= 0) {
+    return identity;
+  }
+  const int participants = static_cast<int>(std::min<int64_t>(Concurrency(), count));
+  if (participants == 1) {
+    return body(begin, end, std::move(identity));
+  }
+
+  std::vector<T> partials(participants, identity);
+  std::atomic<int64_t> next{begin};
+  const int64_t min_chunk =
+      chunk > 0 ? chunk : (schedule == kDynamic ? std::max<int64_t>(1, count / (int64_t{8} * participants)) : 1);
+
+  auto runner = [&](int id) {
+    T acc = std::move(partials[id]);
+    switch (schedule) {
+      case kStatic:
+        if (chunk <= 0) {
+          const int64_t block = count / participants;
+          const int64_t extra = count % participants;
+          const int64_t first = begin + (id * block) + std::min<int64_t>(id, extra);
+          acc = body(first, first + block + (id < extra ? 1 : 0), std::move(acc));
+        } else {
+          for (int64_t first = begin + (id * chunk); first < end; first += participants * chunk) {
+            acc = body(first, std::min(first + chunk, end), std::move(acc));
+          }
+        }
+        break;
+      case kDynamic:
+        for (int64_t first = next.fetch_add(min_chunk); first < end; first = next.fetch_add(min_chunk)) {
+          acc = body(first, std::min(first + min_chunk, end), std::move(acc));
+        }
+        break;
+      case kGuided:
+        for (int64_t first = next.load(); first < end;) {
+          const int64_t size = std::max(min_chunk, (end - first) / (2 * static_cast<int64_t>(participants)));
+          if (next.compare_exchange_weak(first, first + size)) {
+            acc = body(first, std::min(first + size, end), std::move(acc));
+            first = next.load();
+          }
+        }
+        break;
+    }
+    partials[id] = std::move(acc);
+  };
+  RunParticipants(participants, runner);
+
+  T result = std::move(identity);
+  for (auto &partial : partials) {
+    result = combine(std::move(result), std::move(partial));
+  }
+  return result;
+}
+
+}  // namespace ppc::core
@@ -0,0 +1,149 @@
+#include "core/thread_pool/include/thread_pool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "core/util/include/util.hpp"
+
+namespace {
+
+thread_local const ppc::core::ThreadPool *current_pool = nullptr;
+thread_local int current_worker = -1;
+
+}  // namespace
+
+ppc::core::ThreadPool::ThreadPool(int num_threads) {
+  const int num_workers = std::max(num_threads, 1) - 1;
+  for (int i = 0; i < num_workers; i++) {
+    queues_.push_back(std::make_unique<Worker>());
+  }
+  workers_.reserve(num_workers);
+  for (int i = 0; i < num_workers; i++) {
+    workers_.emplace_back([this, i] { WorkerLoop(i); });
+  }
+  concurrency_ = num_workers + 1;
+}
+
+ppc::core::ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard lock(sleep_mutex_);
+    stop_ = true;
+  }
+  wake_.notify_all();
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+ppc::core::ThreadPool &ppc::core::ThreadPool::Global() {
+  static ThreadPool pool(ppc::util::GetPPCNumThreads());
+  return pool;
+}
+
+void ppc::core::ThreadPool::Submit(std::function<void()> job) {
+  if (current_pool == this && current_worker >= 0) {
+    // Jobs spawned by a worker go to its own queue and are stolen from the other end
+    auto &queue = *queues_[current_worker];
+    std::lock_guard lock(queue.mutex);
+    queue.jobs.push_back(std::move(job));
+  } else {
+    std::lock_guard lock(injected_mutex_);
+    injected_.push_back(std::move(job));
+  }
+  pending_.fetch_add(1, std::memory_order_release);
+  {
+    std::lock_guard lock(sleep_mutex_);
+  }
+  wake_.notify_one();
+}
+
+bool ppc::core::ThreadPool::TryPop(int index, std::function<void()> &job) {
+  if (pending_.load(std::memory_order_acquire) == 0) {
+    return false;
+  }
+  if (index >= 0) {
+    auto &own = *queues_[index];
+    std::lock_guard lock(own.mutex);
+    if (!own.jobs.empty()) {
+      job = std::move(own.jobs.back());
+      own.jobs.pop_back();
+      pending_.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  {
+    std::lock_guard lock(injected_mutex_);
+    if (!injected_.empty()) {
+      job = std::move(injected_.front());
+      injected_.pop_front();
+      pending_.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  const auto num_queues = queues_.size();
+  const std::size_t start = index >= 0 ? static_cast<std::size_t>(index) + 1 : 0;
+  for (std::size_t i = 0; i < num_queues; i++) {
+    auto &victim = *queues_[(start + i) % num_queues];
+    std::lock_guard lock(victim.mutex);
+    if (!victim.jobs.empty()) {
+      job = std::move(victim.jobs.front());
+      victim.jobs.pop_front();
+      pending_.fetch_sub(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool ppc::core::ThreadPool::RunPendingJob() {
+  std::function<void()> job;
+  if (!TryPop(current_pool == this ? current_worker : -1, job)) {
+    return false;
+  }
+  job();
+  return true;
+}
+
+void ppc::core::ThreadPool::WorkerLoop(int index) {
+  current_pool = this;
+  current_worker = index;
+  std::function<void()> job;
+  while (true) {
+    if (TryPop(index, job)) {
+      job();
+      job = nullptr;
+      continue;
+    }
+    std::unique_lock lock(sleep_mutex_);
+    wake_.wait(lock, [this] { return stop_ || pending_.load(std::memory_order_acquire) > 0; });
+    if (stop_) {
+      return;
+    }
+  }
+}
+
+ppc::core::TaskGroup::~TaskGroup() {
+  // Jobs reference the group, so it must not go away before they finish
+  while (pending_.load(std::memory_order_acquire) > 0) {
+    if (!pool_.RunPendingJob()) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+void ppc::core::TaskGroup::Wait() {
+  while (pending_.load(std::memory_order_acquire) > 0) {
+    if (!pool_.RunPendingJob()) {
+      std::this_thread::yield();
+    }
+  }
+  std::lock_guard lock(error_mutex_);
+  if (error_) {
+    std::rethrow_exception(std::exchange(error_, nullptr));
+  }
+}
@@ -34,3 +34,27 @@ TEST(util_tests, check_set_env) {
   GTEST_SKIP();
 #endif
 }
+
+TEST(util_tests, check_set_num_threads) {
+  int save_var = ppc::util::GetPPCNumThreads();
+
+  ppc::util::SetPPCNumThreads(3);
+  EXPECT_EQ(ppc::util::GetPPCNumThreads(), 3);
+
+  ppc::util::SetPPCNumThreads(save_var);
+  EXPECT_EQ(ppc::util::GetPPCNumThreads(), save_var);
+}
+
+TEST(util_tests, set_num_threads_calls_the_hook) {
+  const int save_var = ppc::util::GetPPCNumThreads();
+  int hooked = 0;
+  ppc::util::SetPPCNumThreadsHook([&hooked](int num_threads) { hooked = num_threads; });
+
+  ppc::util::SetPPCNumThreads(3);
+  EXPECT_EQ(hooked, 3);
+
+  ppc::util::SetPPCNumThreadsHook({});
+  ppc::util::SetPPCNumThreads(save_var);
+  EXPECT_EQ(hooked, 3);
+  EXPECT_EQ(ppc::util::GetPPCNumThreads(), save_var);
+}
@@ -1,9 +1,16 @@
 #pragma once
+#include <functional>
 #include <string>
 
 namespace ppc::util {
 
 std::string GetAbsolutePath(const std::string &relative_path);
 int GetPPCNumThreads();
+// Sets OMP_NUM_THREADS (read by GetPPCNumThreads) and, in OpenMP builds, the OpenMP default,
+// then calls the hook set by SetPPCNumThreadsHook
+void SetPPCNumThreads(int num_threads);
+// Hook for a runtime whose thread limit is fixed elsewhere, such as the TBB global_control of the
+// TBB test runner, to follow SetPPCNumThreads. An empty hook removes it
+void SetPPCNumThreadsHook(std::function<void(int)> hook);
 
 }  // namespace ppc::util
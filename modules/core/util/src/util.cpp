@@ -9,7 +9,22 @@
 #endif
 
 #include <filesystem>
+#include <functional>
 #include <string>
+#include <utility>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+std::function<void(int)> &NumThreadsHook() {
+  static std::function<void(int)> hook;
+  return hook;
+}
+
+}  // namespace
 
 std::string ppc::util::GetAbsolutePath(const std::string &relative_path) {
   const std::filesystem::path path = std::string(PPC_PATH_TO_PROJECT) + "/tasks/" + relative_path;
@@ -30,3 +45,20 @@ int ppc::util::GetPPCNumThreads() {
   int num_threads = (omp_env != nullptr) ? std::atoi(omp_env) : 1;
   return num_threads;
 }
+
+void ppc::util::SetPPCNumThreads(int num_threads) {
+  const std::string value = std::to_string(num_threads);
+#ifdef _WIN32
+  _putenv_s("OMP_NUM_THREADS", value.c_str());
+#else
+  setenv("OMP_NUM_THREADS", value.c_str(), 1);  // NOLINT(misc-include-cleaner)
+#endif
+#ifdef _OPENMP
+  omp_set_num_threads(num_threads);
+#endif
+  if (NumThreadsHook()) {
+    NumThreadsHook()(num_threads);
+  }
+}
+
+void ppc::util::SetPPCNumThreadsHook(std::function<void(int)> hook) { NumThreadsHook() = std::move(hook); }
@@ -3,7 +3,7 @@
 
 #include <algorithm>
 #include <memory>
-#include <vector>
+#include <span>
 
 #include "core/task/include/task.hpp"
 
@@ -14,12 +14,8 @@ class MaxOfVectorElements : public ppc::core::Task {
  public:
   explicit MaxOfVectorElements(ppc::core::TaskDataPtr task_data) : Task(task_data) {}
   bool PreProcessingImpl() override {
-    // Init vectors
-    input_ = std::vector<InOutType>(task_data->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(task_data->inputs[0]);
-    for (unsigned i = 0; i < task_data->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // View caller's buffer without copying
+    input_ = task_data->GetInput<InOutType>(0);
     // Init value for output
     max_ = 0.0;
     max_index_ = 0;
@@ -50,7 +46,7 @@ class MaxOfVectorElements : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  std::span<const InOutType> input_;
   InOutType max_;
   IndexType max_index_;
 };
@@ -1,9 +1,11 @@
 #ifndef MODULES_REFERENCE_MOST_DIFFERENT_NEIGHBOR_ELEMENTS_REF_TASK_HPP_
 #define MODULES_REFERENCE_MOST_DIFFERENT_NEIGHBOR_ELEMENTS_REF_TASK_HPP_
 
-#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
 #include <memory>
-#include <vector>
+#include <span>
 
 #include "core/task/include/task.hpp"
 
@@ -14,12 +16,8 @@ class MostDifferentNeighborElements : public ppc::core::Task {
  public:
   explicit MostDifferentNeighborElements(ppc::core::TaskDataPtr task_data) : Task(task_data) {}
   bool PreProcessingImpl() override {
-    // Init vectors
-    input_ = std::vector<InOutType>(task_data->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(task_data->inputs[0]);
-    for (unsigned i = 0; i < task_data->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // View caller's buffer without copying
+    input_ = task_data->GetInput<InOutType>(0);
     // Init value for output
     l_elem_ = r_elem_ = 0;
     l_elem_index_ = r_elem_index_ = 0;
@@ -32,16 +30,17 @@ class MostDifferentNeighborElements : public ppc::core::Task {
   }
 
   bool RunImpl() override {
-    auto rotate_in = input_;
-    int rot_left = 1;
-    rotate(rotate_in.begin(), rotate_in.begin() + rot_left, rotate_in.end());
-
-    auto temp_res = std::vector<InOutType>(input_.size());
-    std::transform(input_.begin(), input_.end(), rotate_in.begin(), temp_res.begin(),
-                   [](InOutType x, InOutType y) { return std::abs(x - y); });
-
-    auto result = std::max_element(temp_res.begin(), temp_res.end() - 1);
-    l_elem_index_ = static_cast<IndexType>(std::distance(temp_res.begin(), result));
+    // Compare neighbours directly in the caller's buffer, first pair wins on ties
+    auto best_diff = std::abs(input_[0] - input_[1]);
+    size_t best_index = 0;
+    for (size_t i = 1; i + 1 < input_.size(); i++) {
+      auto diff = std::abs(input_[i] - input_[i + 1]);
+      if (diff > best_diff) {
+        best_diff = diff;
+        best_index = i;
+      }
+    }
+    l_elem_index_ = static_cast<IndexType>(best_index);
     l_elem_ = input_[l_elem_index_];
 
     r_elem_index_ = l_elem_index_ + 1;
@@ -58,7 +57,7 @@ class MostDifferentNeighborElements : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  std::span<const InOutType> input_;
   InOutType l_elem_, r_elem_;
   IndexType l_elem_index_, r_elem_index_;
 };
@@ -5,6 +5,7 @@
 #include <memory>
 #include <vector>
 
+#include "core/task/include/memory_profile.hpp"
 #include "core/task/include/task.hpp"
 #include "ref/num_of_alternations_signs/include/ref_task.hpp"
 
@@ -145,3 +146,32 @@ TEST(num_of_alternations_signs, check_float) {
   test_task.PostProcessing();
   ASSERT_EQ(out[0], 2ULL);
 }
+
+TEST(num_of_alternations_signs, check_input_is_not_copied) {
+  // Create data
+  std::vector<double> in(1 << 16, 1);
+  for (size_t i = 0; i < in.size(); i++) {
+    in[i] = (i % 3 == 0) ? -static_cast<double>(i) : static_cast<double>(i);
+  }
+  std::vector<uint64_t> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Copying the input in PreProcessing, as this task did before reading it through a span,
+  // allocates at least its size
+  ppc::reference::NumOfAlternationsSigns<double, uint64_t> test_task(task_data);
+  ppc::core::MemoryProfiler::SetEnabled(true);
+  ASSERT_EQ(test_task.Validation(), true);
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+  ppc::core::MemoryProfiler::SetEnabled(false);
+  if (ppc::core::MemoryProfiler::CountsAllocations()) {
+    EXPECT_LT(test_task.GetMemoryProfile().AllocatedBytes(), in.size() * sizeof(double));
+  }
+}
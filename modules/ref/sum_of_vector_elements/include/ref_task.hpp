@@ -2,7 +2,7 @@
 
 #include <memory>
 #include <numeric>
-#include <vector>
+#include <span>
 
 #include "core/task/include/task.hpp"
 
@@ -13,12 +13,8 @@ class SumOfVectorElements : public ppc::core::Task {
  public:
   explicit SumOfVectorElements(ppc::core::TaskDataPtr task_data) : Task(task_data) {}
   bool PreProcessingImpl() override {
-    // Init vectors
-    input_ = std::vector<InOutType>(task_data->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(task_data->inputs[0]);
-    for (unsigned i = 0; i < task_data->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // View caller's buffer without copying
+    input_ = task_data->GetInput<InOutType>(0);
     // Init value for output
     sum_ = 0;
     return true;
@@ -40,7 +36,7 @@ class SumOfVectorElements : public ppc::core::Task {
   }
 
  private:
-  std::vector<InOutType> input_;
+  std::span<const InOutType> input_;
   InOutType sum_;
 };
 
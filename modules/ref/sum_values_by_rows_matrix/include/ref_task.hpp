@@ -4,7 +4,7 @@
 #include <cstddef>
 #include <memory>
 #include <numeric>
-#include <vector>
+#include <span>
 
 #include "core/task/include/task.hpp"
 
@@ -15,17 +15,13 @@ class SumValuesByRowsMatrix : public ppc::core::Task {
  public:
   explicit SumValuesByRowsMatrix(ppc::core::TaskDataPtr task_data) : Task(task_data) {}
   bool PreProcessingImpl() override {
-    // Init vectors
-    input_ = std::vector<InOutType>(task_data->inputs_count[0]);
-    auto tmp_ptr = reinterpret_cast<InOutType*>(task_data->inputs[0]);
-    for (unsigned i = 0; i < task_data->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    // View caller's buffer without copying
+    input_ = task_data->GetInput<InOutType>(0);
     rows_ = reinterpret_cast<IndexType*>(task_data->inputs[1])[0];
     cols_ = reinterpret_cast<IndexType*>(task_data->inputs[1])[1];
 
-    // Init value for output
-    sum_ = std::vector<InOutType>(cols_, 0.F);
+    // Write row sums straight into the caller's output
+    sum_ = task_data->GetOutput<InOutType>(0);
     return true;
   }
 
@@ -43,16 +39,14 @@ class SumValuesByRowsMatrix : public ppc::core::Task {
   }
 
   bool PostProcessingImpl() override {
-    for (IndexType i = 0; i < rows_; i++) {
-      reinterpret_cast<InOutType*>(task_data->outputs[0])[i] = sum_[i];
-    }
+    // Row sums are already in the output buffer
     return true;
   }
 
  private:
-  std::vector<InOutType> input_;
+  std::span<const InOutType> input_;
   IndexType rows_, cols_;
-  std::vector<InOutType> sum_;
+  std::span<InOutType> sum_;
 };
 
 }  // namespace ppc::reference
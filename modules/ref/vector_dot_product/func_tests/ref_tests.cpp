@@ -5,6 +5,7 @@
 #include <memory>
 #include <vector>
 
+#include "core/task/include/memory_profile.hpp"
 #include "core/task/include/task.hpp"
 #include "ref/vector_dot_product/include/ref_task.hpp"
 
@@ -187,3 +188,32 @@ TEST(vector_dot_product, check_float) {
   test_task.PostProcessing();
   EXPECT_NEAR(out[0], in1.size() * (-1.3F) * 1.2F, 1e-3F);
 }
+
+TEST(vector_dot_product, check_input_is_not_copied) {
+  // Create data
+  std::vector<double> in1(1 << 16, 1);
+  std::vector<double> in2(1 << 16, 1);
+  std::vector<double> out(1, 0);
+
+  // Create task_data
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(in1.data()));
+  task_data->inputs_count.emplace_back(in1.size());
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t*>(in2.data()));
+  task_data->inputs_count.emplace_back(in2.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+
+  // Copying the input in PreProcessing, as this task did before reading it through a span,
+  // allocates at least its size
+  ppc::reference::VectorDotProduct<double> test_task(task_data);
+  ppc::core::MemoryProfiler::SetEnabled(true);
+  ASSERT_EQ(test_task.Validation(), true);
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+  ppc::core::MemoryProfiler::SetEnabled(false);
+  if (ppc::core::MemoryProfiler::CountsAllocations()) {
+    EXPECT_LT(test_task.GetMemoryProfile().AllocatedBytes(), in1.size() * sizeof(double));
+  }
+}
@@ -1,10 +1,11 @@
 #ifndef MODULES_REFERENCE_VECTOR_DOT_PRODUCT_REF_TASK_HPP_
 #define MODULES_REFERENCE_VECTOR_DOT_PRODUCT_REF_TASK_HPP_
 
+#include <array>
 #include <cstddef>
 #include <memory>
 #include <numeric>
-#include <vector>
+#include <span>
 
 #include "core/task/include/task.hpp"
 
@@ -15,14 +16,9 @@ class VectorDotProduct : public ppc::core::Task {
  public:
   explicit VectorDotProduct(ppc::core::TaskDataPtr task_data) : Task(task_data) {}
   bool PreProcessingImpl() override {
-    // Init vectors
-    input_ = std::vector<std::vector<InOutType> >(2);
+    // View caller's buffers without copying
     for (size_t i = 0; i < input_.size(); i++) {
-      input_[i] = std::vector<InOutType>(task_data->inputs_count[i]);
-      auto tmp_ptr = reinterpret_cast<InOutType*>(task_data->inputs[i]);
-      for (unsigned j = 0; j < task_data->inputs_count[i]; j++) {
-        input_[i][j] = tmp_ptr[j];
-      }
+      input_[i] = task_data->GetInput<InOutType>(i);
     }
 
     // Init value for output
@@ -46,7 +42,7 @@ class VectorDotProduct : public ppc::core::Task {
   }
 
  private:
-  std::vector<std::vector<InOutType> > input_;
+  std::array<std::span<const InOutType>, 2> input_;
   InOutType dor_product_;
 };
 
@@ -1,8 +1,16 @@
 from pathlib import Path
 from collections import defaultdict
 import argparse
+import csv
+import json
 import yaml
 
+parser = argparse.ArgumentParser(description='Generate HTML scoreboard.')
+parser.add_argument('-o', '--output', type=str, required=True, help='Output file path')
+parser.add_argument('-p', '--perf-results', type=str, required=False,
+                    help='Perf result records (.jsonl/.csv) written by perf tests via PPC_PERF_RESULTS')
+args = parser.parse_args()
+
 task_types = ['all', 'mpi', 'omp', 'seq', 'stl', 'tbb']
 
 tasks_dir = Path('tasks')
@@ -29,6 +37,18 @@ with open(plagiarism_config_path, 'r') as file:
     plagiarism_cfg = yaml.safe_load(file)
 assert plagiarism_cfg, "Plagiarism configuration is empty"
 
+perf_stats = defaultdict(dict)
+if args.perf_results:
+    perf_path = Path(args.perf_results)
+    with open(perf_path, 'r', newline='') as file:
+        if perf_path.suffix == '.csv':
+            records = list(csv.DictReader(file))
+        else:
+            records = [json.loads(line) for line in file if line.strip()]
+    for record in records:
+        if record['type_of_running'] == 'task_run' and record.get('status', 'ok') == 'ok':
+            perf_stats[record['task_id']][record['technology']] = record
+
 columns = ''.join(['<th colspan=5 style="text-align: center;">' + task_type + '</th>' for task_type in task_types])
 html_content = f"""
 <!DOCTYPE html>
@@ -78,8 +98,18 @@ for dir in sorted(directories.keys()):
             task_count += max_sol_points
         else:
             html_content += '<td style="text-align: center;">0</td>'
-        html_content += '<td style="text-align: center;background-color: lavender;">0</td>'
-        html_content += '<td style="text-align: center;background-color: lavender;">0</td>'
+        acceleration, efficiency = '0', '0'
+        task_perf = perf_stats.get(dir, {})
+        if task_type in task_perf and 'seq' in task_perf:
+            par_time = float(task_perf[task_type]['time_sec'])
+            seq_time = float(task_perf['seq']['time_sec'])
+            num_procs = int(task_perf[task_type]['num_threads'])
+            if par_time > 0 and num_procs > 0:
+                speedup = seq_time / par_time
+                acceleration = f'{speedup:.2f}'
+                efficiency = f'{speedup / num_procs * 100:.2f}%'
+        html_content += f'<td style="text-align: center;background-color: lavender;">{acceleration}</td>'
+        html_content += f'<td style="text-align: center;background-color: lavender;">{efficiency}</td>'
         html_content += '<td style="text-align: center;">0</td>'
         is_cheated = \
             dir in plagiarism_cfg["plagiarism"][task_type] or \
@@ -101,10 +131,6 @@ html_content += """
 </html>
 """
 
-parser = argparse.ArgumentParser(description='Generate HTML scoreboard.')
-parser.add_argument('-o', '--output', type=str, required=True, help='Output file path')
-args = parser.parse_args()
-
 output_file = Path(args.output) / "index.html"
 with open(output_file, 'w') as file:
     file.write(html_content)
@@ -1,11 +1,15 @@
 import argparse
+import csv
+import json
 import os
 import re
 import xlsxwriter
 import multiprocessing
 
 parser = argparse.ArgumentParser()
-parser.add_argument('-i', '--input', help='Input file path (logs of perf tests, .txt)', required=True)
+parser.add_argument('-i', '--input', required=True,
+                    help='Input file path (perf result records .jsonl/.csv written via PPC_PERF_RESULTS, '
+                         'or logs of perf tests .txt)')
 parser.add_argument('-o', '--output', help='Output file path (path to .xlsx table)', required=True)
 args = parser.parse_args()
 logs_path = os.path.abspath(args.input)
@@ -16,32 +20,63 @@ list_of_type_of_tasks = ["all", "mpi", "omp", "seq", "stl", "tbb"]
 result_tables = {"pipeline": {}, "task_run": {}}
 set_of_task_name = []
 
-logs_file = open(logs_path, "r")
-logs_lines = logs_file.readlines()
-for line in logs_lines:
-    pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
-    result = re.findall(pattern, line)
-    if len(result):
-        task_name = result[0][1]
-        perf_type = result[0][2]
-        set_of_task_name.append(task_name)
-        result_tables[perf_type][task_name] = {}
-
-        for ttype in list_of_type_of_tasks:
-            result_tables[perf_type][task_name][ttype] = -1.0
-
-for line in logs_lines:
-    pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
-    result = re.findall(pattern, line)
-    if len(result):
-        task_type = result[0][0]
-        task_name = result[0][1]
-        perf_type = result[0][2]
-        perf_time = float(result[0][3])
-        if perf_time < 0.05:
-            msg = f"Performance time = {perf_time} < 0.05 second : for {task_type} - {task_name} - {perf_type} \n"
+
+def read_records(path):
+    if path.endswith(".csv"):
+        with open(path, newline="") as records_file:
+            return list(csv.DictReader(records_file))
+    with open(path, "r") as records_file:
+        return [json.loads(line) for line in records_file if line.strip()]
+
+
+def read_logs(path):
+    records = []
+    with open(path, "r") as logs_file:
+        for line in logs_file.readlines():
+            pattern = r'tasks[\/|\\](\w*)[\/|\\](\w*):(\w*):(-*\d*\.\d*)'
+            result = re.findall(pattern, line)
+            if len(result):
+                records.append({"technology": result[0][0], "task_id": result[0][1],
+                                "type_of_running": result[0][2], "time_sec": result[0][3]})
+    return records
+
+
+structured_records = logs_path.endswith((".json", ".jsonl", ".csv"))
+if structured_records:
+    records = read_records(logs_path)
+else:
+    records = read_logs(logs_path)
+
+for record in records:
+    task_name = record["task_id"]
+    perf_type = record["type_of_running"]
+    if perf_type not in result_tables:
+        continue
+    set_of_task_name.append(task_name)
+    result_tables[perf_type][task_name] = {}
+
+    for ttype in list_of_type_of_tasks:
+        result_tables[perf_type][task_name][ttype] = -1.0
+
+for record in records:
+    task_type = record["technology"]
+    task_name = record["task_id"]
+    perf_type = record["type_of_running"]
+    if perf_type not in result_tables:
+        continue
+    status = record.get("status", "ok")
+    if status != "ok":
+        # a timed-out or failed task gets a marked cell, the rest of the table is still built
+        print(f"Warning! {task_type} - {task_name} - {perf_type} finished with status '{status}'")
+        result_tables[perf_type][task_name][task_type] = status
+        continue
+    perf_time = float(record["time_sec"])
+    if perf_time < 0.05:
+        msg = f"Performance time = {perf_time} < 0.05 second : for {task_type} - {task_name} - {perf_type} \n"
+        if not structured_records:
             raise Exception(msg)
-        result_tables[perf_type][task_name][task_type] = perf_time
+        print("Warning! " + msg, end="")
+    result_tables[perf_type][task_name][task_type] = perf_time
 
 
 for table_name in result_tables:
@@ -86,6 +121,14 @@ for table_name in result_tables:
                 continue
             par_time = result_tables[table_name][task_name][type_of_task]
             seq_time = result_tables[table_name][task_name]["seq"]
+            if isinstance(par_time, str) or isinstance(seq_time, str):
+                worksheet.write(it_j, it_i, par_time)
+                it_i += 1
+                worksheet.write(it_j, it_i, "-")
+                it_i += 1
+                worksheet.write(it_j, it_i, "-", right_border)
+                it_i += 1
+                continue
             if par_time == 0:
                 speed_up = -1
             else:
@@ -2,24 +2,21 @@
 
 #include <cmath>
 #include <cstddef>
-#include <functional>
-#include <thread>
+#include <cstdint>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 #include "core/util/include/util.hpp"
 #include "oneapi/tbb/task_arena.h"
 #include "oneapi/tbb/task_group.h"
 
 namespace {
-void MatMul(const std::vector<int> &in_vec, int rc_size, std::vector<int> &out_vec) {
-  for (int i = 0; i < rc_size; ++i) {
-    for (int j = 0; j < rc_size; ++j) {
-      out_vec[(i * rc_size) + j] = 0;
-      for (int k = 0; k < rc_size; ++k) {
-        out_vec[(i * rc_size) + j] += in_vec[(i * rc_size) + k] * in_vec[(k * rc_size) + j];
-      }
-    }
-  }
+void MatMul(const std::vector<int> &in_vec, int rc_size, std::vector<int> &out_vec, int row_begin, int row_end) {
+  const auto n = static_cast<std::size_t>(rc_size);
+  const auto first_row = static_cast<std::size_t>(row_begin);
+  ppc::core::Gemm<int>(row_end - row_begin, n, n, 1, in_vec.data() + (first_row * n), n, in_vec.data(), n, 0,
+                       out_vec.data() + (first_row * n), n);
 }
 }  // namespace
 
@@ -46,25 +43,22 @@ bool nesterov_a_test_task_all::TestTaskALL::RunImpl() {
 #pragma omp parallel default(none)
     {
 #pragma omp critical
-      { MatMul(input_, rc_size_, output_); }
+      { MatMul(input_, rc_size_, output_, 0, rc_size_); }
     }
   } else {
     oneapi::tbb::task_arena arena(1);
     arena.execute([&] {
       tbb::task_group tg;
       for (int i = 0; i < ppc::util::GetPPCNumThreads(); ++i) {
-        tg.run([&] { MatMul(input_, rc_size_, output_); });
+        tg.run([&] { MatMul(input_, rc_size_, output_, 0, rc_size_); });
       }
       tg.wait();
     });
   }
 
-  const int num_threads = ppc::util::GetPPCNumThreads();
-  std::vector<std::thread> threads(num_threads);
-  for (int i = 0; i < num_threads; i++) {
-    threads[i] = std::thread(MatMul, std::cref(input_), rc_size_, std::ref(output_));
-    threads[i].join();
-  }
+  ppc::core::ThreadPool::Global().ParallelFor(0, rc_size_, [&](int64_t row_begin, int64_t row_end) {
+    MatMul(input_, rc_size_, output_, static_cast<int>(row_begin), static_cast<int>(row_end));
+  });
 
   world_.barrier();
   return true;
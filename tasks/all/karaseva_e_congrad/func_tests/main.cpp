@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "all/karaseva_e_congrad/include/ops_all.hpp"
+#include "core/linalg/include/krylov_kernels.hpp"
+#include "core/linalg/include/linear_operator.hpp"
+#include "core/linalg/include/preconditioner.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+// Random symmetric matrix with entries in [-1, 1] plus matrix_size on the diagonal
+std::vector<double> GenerateSPDMatrix(size_t matrix_size, uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> a_matrix(matrix_size * matrix_size);
+  for (size_t i = 0; i < matrix_size; ++i) {
+    for (size_t j = i; j < matrix_size; ++j) {
+      a_matrix[(i * matrix_size) + j] = a_matrix[(j * matrix_size) + i] = dist(gen);
+    }
+    a_matrix[(i * matrix_size) + i] += static_cast<double>(matrix_size);
+  }
+  return a_matrix;
+}
+
+struct Solution {
+  bool valid;
+  size_t passes;
+  size_t collectives;
+};
+
+// Solves A x = b on all ranks with A added as input 0 of task_data_all on rank 0 by the caller
+Solution Solve(const std::shared_ptr<ppc::core::TaskData>& task_data_all, std::vector<double>& b,
+               std::vector<double>& x, ppc::core::PreconditionerKind* kind = nullptr,
+               ppc::core::CgVariant variant = ppc::core::kClassicCg) {
+  boost::mpi::communicator world;
+  if (world.rank() == 0) {
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+    task_data_all->inputs_count.emplace_back(b.size());
+    if (kind != nullptr) {
+      task_data_all->AddInput(kind, 1);
+    }
+    task_data_all->outputs.emplace_back(reinterpret_cast<uint8_t*>(x.data()));
+    task_data_all->outputs_count.emplace_back(x.size());
+  }
+
+  karaseva_e_congrad_all::TestTaskALL test_task(task_data_all, variant);
+  if (!test_task.Validation()) {
+    return {.valid = false, .passes = 0, .collectives = 0};
+  }
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+  return {.valid = true, .passes = test_task.Iterations(), .collectives = test_task.Collectives()};
+}
+
+std::shared_ptr<ppc::core::TaskData> DenseInput(std::vector<double>& a) {
+  auto task_data_all = std::make_shared<ppc::core::TaskData>();
+  if (boost::mpi::communicator().rank() == 0) {
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t*>(a.data()));
+    task_data_all->inputs_count.emplace_back(a.size());
+  }
+  return task_data_all;
+}
+
+std::shared_ptr<ppc::core::TaskData> CsrInput(const ppc::core::CsrMatrix& a) {
+  auto task_data_all = std::make_shared<ppc::core::TaskData>();
+  if (boost::mpi::communicator().rank() == 0) {
+    task_data_all->AddInput(&a, 1);
+  }
+  return task_data_all;
+}
+
+void ExpectSolvesOnes(const ppc::core::CsrMatrix& a, const std::vector<double>& x) {
+  if (boost::mpi::communicator().rank() != 0) {
+    return;
+  }
+  std::vector<double> ax(a.Size());
+  ppc::core::MatrixOperator::Csr(a).ApplyRows(0, a.Size(), x.data(), ax.data());
+  for (size_t i = 0; i < a.Size(); ++i) {
+    EXPECT_NEAR(ax[i], 1.0, 1e-7) << "row " << i;
+  }
+}
+
+void RunDense(size_t n, ppc::core::CgVariant variant) {
+  auto a = GenerateSPDMatrix(n, static_cast<uint32_t>(n));
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> x_true(n);
+  for (auto& value : x_true) {
+    value = dist(gen);
+  }
+  std::vector<double> b(n, 0.0);
+  for (size_t i = 0; i < n; ++i) {
+    for (size_t j = 0; j < n; ++j) {
+      b[i] += a[(i * n) + j] * x_true[j];
+    }
+  }
+  std::vector<double> x(n, 0.0);
+
+  ASSERT_TRUE(Solve(DenseInput(a), b, x, nullptr, variant).valid);
+  if (boost::mpi::communicator().rank() == 0) {
+    for (size_t i = 0; i < n; ++i) {
+      EXPECT_NEAR(x[i], x_true[i], 1e-9) << "n = " << n << ", row " << i;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(karaseva_e_congrad_all, test_dense_1) { RunDense(1, ppc::core::kClassicCg); }
+
+TEST(karaseva_e_congrad_all, test_dense_37) { RunDense(37, ppc::core::kClassicCg); }
+
+TEST(karaseva_e_congrad_all, test_dense_200) { RunDense(200, ppc::core::kClassicCg); }
+
+TEST(karaseva_e_congrad_all, test_dense_pipelined_1) { RunDense(1, ppc::core::kPipelinedCg); }
+
+TEST(karaseva_e_congrad_all, test_dense_pipelined_37) { RunDense(37, ppc::core::kPipelinedCg); }
+
+TEST(karaseva_e_congrad_all, test_dense_pipelined_200) { RunDense(200, ppc::core::kPipelinedCg); }
+
+TEST(karaseva_e_congrad_all, test_csr_poisson) {
+  auto a = ppc::core::CsrMatrix::Laplacian2D(23, 17);
+  for (auto kind : {ppc::core::kNoPreconditioner, ppc::core::kJacobiPreconditioner}) {
+    for (auto variant : {ppc::core::kClassicCg, ppc::core::kPipelinedCg}) {
+      std::vector<double> b(a.Size(), 1.0);
+      std::vector<double> x(a.Size(), 0.0);
+      ASSERT_TRUE(Solve(CsrInput(a), b, x, &kind, variant).valid);
+      ExpectSolvesOnes(a, x);
+    }
+  }
+}
+
+TEST(karaseva_e_congrad_all, test_pipelined_needs_fewer_collectives) {
+  auto a = ppc::core::CsrMatrix::Laplacian2D(20, 20);
+  for (auto kind : {ppc::core::kNoPreconditioner, ppc::core::kJacobiPreconditioner}) {
+    std::vector<double> b(a.Size(), 1.0);
+    std::vector<double> x(a.Size(), 0.0);
+    const auto classic = Solve(CsrInput(a), b, x, &kind);
+    const auto pipelined = Solve(CsrInput(a), b, x, &kind, ppc::core::kPipelinedCg);
+    ExpectSolvesOnes(a, x);
+
+    // Classic: a gather and two or three allreduces per iteration; pipelined: a gather and one allreduce
+    EXPECT_GE(classic.collectives + 2, 3 * classic.passes) << "kind " << kind;
+    EXPECT_LE(pipelined.collectives, 2 * pipelined.passes) << "kind " << kind;
+  }
+}
+
+TEST(karaseva_e_congrad_all, test_zero_rhs) {
+  constexpr size_t kN = 10;
+  auto a = GenerateSPDMatrix(kN, 2);
+  for (auto variant : {ppc::core::kClassicCg, ppc::core::kPipelinedCg}) {
+    std::vector<double> b(kN, 0.0);
+    std::vector<double> x(kN, 1.0);
+    ASSERT_TRUE(Solve(DenseInput(a), b, x, nullptr, variant).valid);
+    if (boost::mpi::communicator().rank() == 0) {
+      EXPECT_EQ(x, std::vector<double>(kN, 0.0));
+    }
+  }
+}
+
+TEST(karaseva_e_congrad_all, test_validation_rejects_ilu0) {
+  auto a = ppc::core::CsrMatrix::Laplacian2D(4, 4);
+  auto kind = ppc::core::kIlu0Preconditioner;
+  std::vector<double> b(a.Size(), 1.0);
+  std::vector<double> x(a.Size(), 0.0);
+  EXPECT_FALSE(Solve(CsrInput(a), b, x, &kind).valid);
+}
+
+TEST(karaseva_e_congrad_all, test_validation_invalid_output) {
+  constexpr size_t kN = 4;
+  auto a = GenerateSPDMatrix(kN, 3);
+  std::vector<double> b(kN, 1.0);
+  std::vector<double> x(kN + 1, 0.0);
+  EXPECT_FALSE(Solve(DenseInput(a), b, x).valid);
+}
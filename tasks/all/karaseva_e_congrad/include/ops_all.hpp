@@ -0,0 +1,84 @@
+#pragma once
+
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "core/linalg/include/krylov_kernels.hpp"
+#include "core/linalg/include/linear_operator.hpp"
+#include "core/task/include/task.hpp"
+#include "core/thread_pool/include/omp_chunk_runner.hpp"
+
+namespace karaseva_e_congrad_all {
+
+// CG with the rows of A, b and x split into contiguous blocks over the MPI ranks; the rows of a rank
+// are spread over its OpenMP threads by ppc::core::KrylovKernels. Rank 0 holds the inputs: A as
+// n * n doubles in row-major order or a typed ppc::core::CsrMatrix, b with n elements and optionally
+// a ppc::core::PreconditionerKind, none or Jacobi. The solution is gathered back to rank 0.
+// Every product with A first gathers the whole vector on every rank. Classic CG then needs an
+// allreduce for p^T * A * p, one for r^T * r and, with Jacobi, one for r^T * z. Pipelined CG needs one
+// nonblocking allreduce of all three dots, which stays in flight during the next product with A
+class TestTaskALL : public ppc::core::Task {
+ public:
+  explicit TestTaskALL(ppc::core::TaskDataPtr task_data, ppc::core::CgVariant variant = ppc::core::kClassicCg)
+      : Task(std::move(task_data)), variant_(variant) {}
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  // Passes over A made by the last run
+  [[nodiscard]] size_t Iterations() const { return iterations_; }
+  // MPI collectives and thread-level kernel passes of the last run on this rank
+  [[nodiscard]] size_t Collectives() const { return collectives_; }
+  [[nodiscard]] size_t SyncPoints() const { return kernels_.SyncPoints(); }
+
+ private:
+  // Rows [first_row, first_row + rows) of A with global column indices, dense or CSR. ApplyRows
+  // takes x at the entry of first_row in the full vector, so that KrylovKernels::ApplyDot pairs
+  // the local rows of y with the matching entries of x
+  struct RowBlock {
+    std::size_t rows = 0;
+    std::size_t cols = 0;
+    std::size_t first_row = 0;
+    std::vector<double> dense;  // rows x cols, empty for a CSR block
+    std::vector<int> row_ptr;
+    std::vector<int> col_idx;
+    std::vector<double> values;
+
+    [[nodiscard]] std::size_t Size() const { return rows; }
+    [[nodiscard]] std::size_t RowChunk() const {
+      return row_ptr.empty() ? ppc::core::MatrixOperator::kDenseRowChunk : ppc::core::MatrixOperator::kSparseRowChunk;
+    }
+    void ApplyRows(std::size_t begin, std::size_t end, const double* x, double* y) const;
+    [[nodiscard]] double DiagonalAt(std::size_t row) const;
+  };
+
+  void Distribute();
+  void RunClassic();
+  void RunPipelined();
+  double AllreduceSum(double local);
+  // Gathers the local parts of a vector from all ranks into global_
+  void Allgather(const double* local);
+
+  boost::mpi::communicator world_;
+  ppc::core::CgVariant variant_;
+  bool sparse_ = false;
+  bool jacobi_ = false;
+  size_t n_{};
+  std::vector<int> counts_;  // rows of every rank
+  std::vector<int> displs_;  // first row of every rank
+
+  RowBlock a_;
+  std::vector<double> b_;  // Local rows of the right-hand side
+  std::vector<double> x_;  // Local rows of the solution
+  std::vector<double> inverse_diagonal_;  // Local rows of 1 / diag(A), Jacobi only
+  std::vector<double> global_;  // Full vector for the product with A
+  size_t iterations_{};
+  size_t collectives_{};
+
+  ppc::core::KrylovKernels kernels_{ppc::core::RunOmp};
+};
+
+}  // namespace karaseva_e_congrad_all
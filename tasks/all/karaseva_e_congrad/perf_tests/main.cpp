@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all/karaseva_e_congrad/include/ops_all.hpp"
+#include "core/linalg/include/krylov_kernels.hpp"
+#include "core/linalg/include/linear_operator.hpp"
+#include "core/linalg/include/preconditioner.hpp"
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+// Poisson problem on a kGrid x kGrid grid with a Jacobi preconditioner
+constexpr size_t kGrid = 128;
+
+// System of one task; it must outlive the task
+struct PoissonData {
+  ppc::core::CsrMatrix a = ppc::core::CsrMatrix::Laplacian2D(kGrid, kGrid);
+  std::vector<double> b = std::vector<double>(kGrid * kGrid, 1.0);
+  std::vector<double> x = std::vector<double>(kGrid * kGrid, 0.0);
+  ppc::core::PreconditionerKind kind = ppc::core::kJacobiPreconditioner;
+};
+
+std::shared_ptr<karaseva_e_congrad_all::TestTaskALL> MakeTask(PoissonData& data, ppc::core::CgVariant variant) {
+  auto task_data_all = std::make_shared<ppc::core::TaskData>();
+  if (boost::mpi::communicator().rank() == 0) {
+    task_data_all->AddInput(&data.a, 1);
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t*>(data.b.data()));
+    task_data_all->inputs_count.emplace_back(data.b.size());
+    task_data_all->AddInput(&data.kind, 1);
+    task_data_all->outputs.emplace_back(reinterpret_cast<uint8_t*>(data.x.data()));
+    task_data_all->outputs_count.emplace_back(data.x.size());
+  }
+  return std::make_shared<karaseva_e_congrad_all::TestTaskALL>(task_data_all, variant);
+}
+
+std::shared_ptr<ppc::core::PerfAttr> MakePerfAttr() {
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [t0] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+  return perf_attr;
+}
+
+void ExpectSolved(const PoissonData& data) {
+  if (boost::mpi::communicator().rank() != 0) {
+    return;
+  }
+  std::vector<double> ax(data.a.Size());
+  ppc::core::MatrixOperator::Csr(data.a).ApplyRows(0, data.a.Size(), data.x.data(), ax.data());
+  for (size_t i = 0; i < ax.size(); ++i) {
+    ASSERT_NEAR(ax[i], data.b[i], 1e-7) << "row " << i;
+  }
+}
+
+// MPI collectives and thread barriers per pass over A, labelled with the rank count
+void PrintSyncPoints(const std::string& run, const karaseva_e_congrad_all::TestTaskALL& task) {
+  const boost::mpi::communicator world;
+  if (world.rank() != 0) {
+    return;
+  }
+  const auto passes = static_cast<double>(task.Iterations());
+  std::cout << "karaseva_e_congrad_all_np" << world.size() << ":" << run << ":sync: passes=" << task.Iterations()
+            << " collectives_per_iteration=" << static_cast<double>(task.Collectives()) / passes
+            << " points_per_iteration=" << static_cast<double>(task.SyncPoints()) / passes << '\n';
+}
+
+void RunPerf(const std::string& run, ppc::core::CgVariant variant, bool pipeline) {
+  PoissonData data;
+  auto test_task_all = MakeTask(data, variant);
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_all);
+  if (pipeline) {
+    perf_analyzer->PipelineRun(MakePerfAttr(), perf_results);
+  } else {
+    perf_analyzer->TaskRun(MakePerfAttr(), perf_results);
+  }
+  if (boost::mpi::communicator().rank() == 0) {
+    ppc::core::Perf::PrintPerfStatistic(perf_results);
+  }
+  PrintSyncPoints(run, *test_task_all);
+
+  ExpectSolved(data);
+  if (variant == ppc::core::kPipelinedCg) {
+    // One gather for the product with A and one allreduce of the dots
+    EXPECT_LE(test_task_all->Collectives(), 2 * test_task_all->Iterations());
+  }
+}
+
+}  // namespace
+
+TEST(karaseva_e_congrad_all, test_pipeline_run) { RunPerf("pipeline", ppc::core::kPipelinedCg, true); }
+
+TEST(karaseva_e_congrad_all, test_task_run) { RunPerf("task_run", ppc::core::kPipelinedCg, false); }
+
+TEST(karaseva_e_congrad_all, test_task_run_classic) { RunPerf("task_run_classic", ppc::core::kClassicCg, false); }
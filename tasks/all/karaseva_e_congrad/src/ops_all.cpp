@@ -0,0 +1,324 @@
+#include "all/karaseva_e_congrad/include/ops_all.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <boost/mpi/collectives/all_gatherv.hpp>
+#include <boost/mpi/collectives/all_reduce.hpp>
+#include <boost/mpi/collectives/broadcast.hpp>
+#include <boost/mpi/collectives/gatherv.hpp>
+#include <boost/mpi/collectives/scatterv.hpp>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "core/linalg/include/krylov_kernels.hpp"
+#include "core/linalg/include/linear_operator.hpp"
+#include "core/linalg/include/preconditioner.hpp"
+
+namespace {
+
+// Buffer for a collective: boost::mpi takes the datatype from the first element even when a rank
+// has nothing to send or receive, so the pointer must not be null
+template <class T>
+T* Buffer(std::vector<T>& values) {
+  if (values.empty()) {
+    values.reserve(1);
+  }
+  return values.data();
+}
+
+template <class T>
+void ScatterRows(const boost::mpi::communicator& world, const T* in, const std::vector<int>& sizes,
+                 const std::vector<int>& displs, std::vector<T>& out) {
+  out.resize(sizes[world.rank()]);
+  if (world.rank() == 0) {
+    boost::mpi::scatterv(world, in, sizes, displs, Buffer(out), sizes[0], 0);
+  } else {
+    boost::mpi::scatterv(world, Buffer(out), sizes[world.rank()], 0);
+  }
+}
+
+}  // namespace
+
+void karaseva_e_congrad_all::TestTaskALL::RowBlock::ApplyRows(std::size_t begin, std::size_t end, const double* x,
+                                                              double* y) const {
+  const double* full = x - first_row;
+  if (row_ptr.empty()) {
+    for (std::size_t i = begin; i < end; ++i) {
+      y[i] = ppc::core::detail::Dot(cols, dense.data() + (i * cols), full);
+    }
+    return;
+  }
+  for (std::size_t i = begin; i < end; ++i) {
+    double sum = 0.0;
+    for (auto k = row_ptr[i]; k < row_ptr[i + 1]; ++k) {
+      sum += values[k] * full[col_idx[k]];
+    }
+    y[i] = sum;
+  }
+}
+
+double karaseva_e_congrad_all::TestTaskALL::RowBlock::DiagonalAt(std::size_t row) const {
+  const std::size_t col = first_row + row;
+  if (row_ptr.empty()) {
+    return dense[(row * cols) + col];
+  }
+  const auto* row_begin = col_idx.data() + row_ptr[row];
+  const auto* row_end = col_idx.data() + row_ptr[row + 1];
+  const auto* entry = std::lower_bound(row_begin, row_end, static_cast<int>(col));
+  return entry != row_end && *entry == static_cast<int>(col) ? values[entry - col_idx.data()] : 0.0;
+}
+
+bool karaseva_e_congrad_all::TestTaskALL::ValidationImpl() {
+  bool valid = true;
+  if (world_.rank() == 0) {
+    // A must be a dense or CSR n x n matrix, a stencil cannot be sent to the other ranks
+    const auto a = ppc::core::MatrixOperator::FromInput(*task_data, 0, task_data->inputs_count[1]);
+    const bool distributable =
+        a.GetKind() == ppc::core::MatrixOperator::kDense || a.GetKind() == ppc::core::MatrixOperator::kCsr;
+    // ILU(0) would need triangular solves across the ranks
+    const auto kind = ppc::core::Preconditioner::KindFromInput(*task_data, 2);
+    const bool valid_input =
+        distributable && kind != ppc::core::kIlu0Preconditioner && ppc::core::Preconditioner::Supports(kind, a);
+    valid = valid_input && task_data->outputs_count[0] == task_data->inputs_count[1];
+  }
+  // Ranks must agree, the later stages are collective
+  boost::mpi::broadcast(world_, valid, 0);
+  return valid;
+}
+
+bool karaseva_e_congrad_all::TestTaskALL::PreProcessingImpl() {
+  if (world_.rank() == 0) {
+    n_ = task_data->inputs_count[1];
+    sparse_ = task_data->HasInput<ppc::core::CsrMatrix>(0);
+    jacobi_ = ppc::core::Preconditioner::KindFromInput(*task_data, 2) == ppc::core::kJacobiPreconditioner;
+  }
+  boost::mpi::broadcast(world_, n_, 0);
+  boost::mpi::broadcast(world_, sparse_, 0);
+  boost::mpi::broadcast(world_, jacobi_, 0);
+
+  const int ranks = world_.size();
+  counts_.assign(ranks, 0);
+  displs_.assign(ranks, 0);
+  for (int rank = 0; rank < ranks; ++rank) {
+    counts_[rank] = static_cast<int>((n_ / ranks) + (static_cast<size_t>(rank) < n_ % ranks ? 1 : 0));
+    displs_[rank] = rank == 0 ? 0 : displs_[rank - 1] + counts_[rank - 1];
+  }
+
+  Distribute();
+
+  inverse_diagonal_.clear();
+  if (jacobi_) {
+    inverse_diagonal_.resize(a_.rows);
+    for (size_t i = 0; i < a_.rows; ++i) {
+      inverse_diagonal_[i] = 1.0 / a_.DiagonalAt(i);
+    }
+  }
+  x_.assign(a_.rows, 0.0);
+  global_.assign(n_, 0.0);
+  return true;
+}
+
+void karaseva_e_congrad_all::TestTaskALL::Distribute() {
+  const int rank = world_.rank();
+  a_ = RowBlock{};
+  a_.rows = counts_[rank];
+  a_.cols = n_;
+  a_.first_row = displs_[rank];
+
+  const ppc::core::CsrMatrix* csr = nullptr;
+  if (rank == 0 && sparse_) {
+    csr = &task_data->GetInput<ppc::core::CsrMatrix>(0).front();
+  }
+  if (sparse_) {
+    // Every rank gets its rows of row_ptr plus the end of its last row, then the entries in between
+    std::vector<int> ptr_sizes(counts_.size());
+    std::vector<int> entry_sizes(counts_.size());
+    std::vector<int> entry_displs(counts_.size());
+    if (rank == 0) {
+      for (size_t r = 0; r < counts_.size(); ++r) {
+        ptr_sizes[r] = counts_[r] + 1;
+        entry_displs[r] = csr->row_ptr[displs_[r]];
+        entry_sizes[r] = csr->row_ptr[displs_[r] + counts_[r]] - entry_displs[r];
+      }
+    }
+    boost::mpi::broadcast(world_, ptr_sizes.data(), static_cast<int>(ptr_sizes.size()), 0);
+    boost::mpi::broadcast(world_, entry_sizes.data(), static_cast<int>(entry_sizes.size()), 0);
+    ScatterRows(world_, rank == 0 ? csr->row_ptr.data() : nullptr, ptr_sizes, displs_, a_.row_ptr);
+    ScatterRows(world_, rank == 0 ? csr->col_idx.data() : nullptr, entry_sizes, entry_displs, a_.col_idx);
+    ScatterRows(world_, rank == 0 ? csr->values.data() : nullptr, entry_sizes, entry_displs, a_.values);
+    const int first_entry = a_.row_ptr.front();
+    for (auto& offset : a_.row_ptr) {
+      offset -= first_entry;
+    }
+  } else {
+    std::vector<int> sizes(counts_.size());
+    std::vector<int> offsets(counts_.size());
+    for (size_t r = 0; r < counts_.size(); ++r) {
+      sizes[r] = counts_[r] * static_cast<int>(n_);
+      offsets[r] = displs_[r] * static_cast<int>(n_);
+    }
+    const auto* a_ptr = rank == 0 ? reinterpret_cast<const double*>(task_data->inputs[0]) : nullptr;
+    ScatterRows(world_, a_ptr, sizes, offsets, a_.dense);
+  }
+
+  const auto* b_ptr = rank == 0 ? reinterpret_cast<const double*>(task_data->inputs[1]) : nullptr;
+  ScatterRows(world_, b_ptr, counts_, displs_, b_);
+}
+
+double karaseva_e_congrad_all::TestTaskALL::AllreduceSum(double local) {
+  ++collectives_;
+  return boost::mpi::all_reduce(world_, local, std::plus<>());
+}
+
+void karaseva_e_congrad_all::TestTaskALL::Allgather(const double* local) {
+  ++collectives_;
+  // A rank without rows still hands a valid pointer to boost::mpi
+  boost::mpi::all_gatherv(world_, a_.rows > 0 ? local : global_.data(), global_.data(), counts_);
+}
+
+bool karaseva_e_congrad_all::TestTaskALL::RunImpl() {
+  x_.assign(a_.rows, 0.0);
+  iterations_ = 0;
+  collectives_ = 0;
+  kernels_.ResetCounters();
+  if (variant_ == ppc::core::kPipelinedCg) {
+    RunPipelined();
+  } else {
+    RunClassic();
+  }
+  return true;
+}
+
+void karaseva_e_congrad_all::TestTaskALL::RunClassic() {
+  const size_t rows = a_.rows;
+  const double* own = global_.data() + a_.first_row;  // Entries of the local rows in the full vector
+
+  // Initial residual r = b - A*x is b because x starts at zero
+  std::vector<double> r = b_;
+  std::vector<double> ap(rows);
+  std::vector<double> z(jacobi_ ? rows : 0);
+  double rz_old = AllreduceSum(jacobi_ ? kernels_.ScaleDot(rows, inverse_diagonal_.data(), r.data(), z.data())
+                                       : kernels_.Dot(rows, r.data(), r.data()));
+  std::vector<double> p = jacobi_ ? z : r;
+
+  const double tolerance = 1e-10;
+  const size_t max_iterations = n_;  // Maximum iterations to prevent infinite loops
+
+  for (size_t k = 0; k < max_iterations; ++k) {
+    // ap = A * p together with p^T * ap
+    Allgather(p.data());
+    const double p_ap = AllreduceSum(kernels_.ApplyDot(a_, own, ap.data()));
+    ++iterations_;
+    if (std::fabs(p_ap) < 1e-15) {
+      break;  // Avoid division by zero
+    }
+    const double alpha = rz_old / p_ap;
+
+    // x += alpha * p and r -= alpha * ap, with the new residual norm from the same sweep
+    const double rs_new = AllreduceSum(kernels_.CgUpdate(rows, alpha, p.data(), ap.data(), x_.data(), r.data()));
+    if (rs_new < tolerance * tolerance) {  // Compare squared norm to avoid sqrt
+      break;
+    }
+
+    // p = z + beta * p
+    const double rz_new =
+        jacobi_ ? AllreduceSum(kernels_.ScaleDot(rows, inverse_diagonal_.data(), r.data(), z.data())) : rs_new;
+    const double beta = rz_new / rz_old;
+    kernels_.Xpby(rows, jacobi_ ? z.data() : r.data(), beta, p.data());
+
+    rz_old = rz_new;
+  }
+}
+
+void karaseva_e_congrad_all::TestTaskALL::RunPipelined() {
+  const size_t rows = a_.rows;
+  const double* own = global_.data() + a_.first_row;  // Entries of the local rows in the full vector
+
+  // Local rows of the vectors of pipelined CG; u, m and q only exist with Jacobi, which the update
+  // sweep applies to w on the fly
+  std::vector<double> r = b_;
+  std::vector<double> w(rows);
+  std::vector<double> n(rows);
+  std::vector<double> p(rows, 0.0);
+  std::vector<double> s(rows, 0.0);
+  std::vector<double> z(rows, 0.0);
+  std::vector<double> u(jacobi_ ? rows : 0);
+  std::vector<double> m(jacobi_ ? rows : 0);
+  std::vector<double> q(jacobi_ ? rows : 0, 0.0);
+  ppc::core::PipelinedCgVectors v{
+      .x = x_.data(), .r = r.data(), .w = w.data(), .n = n.data(), .p = p.data(), .s = s.data(), .z = z.data()};
+  if (jacobi_) {
+    v.u = u.data();
+    v.m = m.data();
+    v.q = q.data();
+    v.inverse_diagonal = inverse_diagonal_.data();
+  }
+
+  // u = M^-1 * r, w = A * u and m = M^-1 * w for x = 0
+  if (jacobi_) {
+    kernels_.Scale(rows, inverse_diagonal_.data(), r.data(), u.data());
+  }
+  Allgather(jacobi_ ? u.data() : r.data());
+  kernels_.Apply(a_, own, w.data());
+  ++iterations_;
+  if (jacobi_) {
+    kernels_.Scale(rows, inverse_diagonal_.data(), w.data(), m.data());
+  }
+
+  // r^T * u, w^T * u and r^T * r summed over the ranks without blocking
+  std::array<double, 3> local_dots{};
+  std::array<double, 3> dots{};
+  MPI_Request request = MPI_REQUEST_NULL;
+  auto start_reduction = [&](const ppc::core::CgDots& rank_dots) {
+    local_dots = {rank_dots.ru, rank_dots.wu, rank_dots.rr};
+    MPI_Iallreduce(local_dots.data(), dots.data(), 3, MPI_DOUBLE, MPI_SUM, world_, &request);
+    ++collectives_;
+  };
+  start_reduction(kernels_.PipelinedCgDots(rows, v));
+
+  const double tolerance = 1e-10;
+  const size_t max_iterations = n_;  // Maximum iterations to prevent infinite loops
+  double alpha = 0.0;
+  double ru_old = 0.0;
+
+  for (size_t k = 0; k < max_iterations; ++k) {
+    // n = A * m runs while the dots are summed
+    Allgather(jacobi_ ? m.data() : w.data());
+    kernels_.Apply(a_, own, n.data());
+    ++iterations_;
+    MPI_Wait(&request, MPI_STATUS_IGNORE);
+    const auto [ru, wu, rr] = dots;
+
+    // Same stopping rule as the classic loop: the squared norm of the updated residual
+    if (rr < tolerance * tolerance) {
+      break;
+    }
+
+    // p^T * A * p from the recurrences: w^T * u - beta * r^T * u / alpha
+    const double beta = k == 0 ? 0.0 : ru / ru_old;
+    const double p_ap = k == 0 ? wu : wu - (beta * ru / alpha);
+    if (std::fabs(p_ap) < 1e-15) {
+      break;  // Avoid division by zero
+    }
+    alpha = ru / p_ap;
+    ru_old = ru;
+
+    // All vector updates and the next dots in one sweep
+    start_reduction(kernels_.PipelinedCgUpdate(rows, alpha, beta, v));
+  }
+  MPI_Wait(&request, MPI_STATUS_IGNORE);
+}
+
+bool karaseva_e_congrad_all::TestTaskALL::PostProcessingImpl() {
+  if (world_.rank() == 0) {
+    boost::mpi::gatherv(world_, Buffer(x_), static_cast<int>(x_.size()),
+                        reinterpret_cast<double*>(task_data->outputs[0]), counts_, displs_, 0);
+  } else {
+    boost::mpi::gatherv(world_, Buffer(x_), static_cast<int>(x_.size()), 0);
+  }
+  return true;
+}
@@ -5,13 +5,12 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <thread>
 #include <vector>
 
 #include "boost/mpi/collectives/broadcast.hpp"
 #include "boost/mpi/collectives/gatherv.hpp"
 #include "boost/mpi/collectives/scatterv.hpp"
-#include "core/util/include/util.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 
 bool rams_s_vertical_gauss_3x3_all::TaskAll::PreProcessingImpl() {
   if (world_.rank() == 0) {
@@ -79,33 +78,24 @@ bool rams_s_vertical_gauss_3x3_all::TaskAll::RunImpl() {
 
   /////
 
-  const std::size_t num_threads = std::min(ppc::util::GetPPCNumThreads(), local_width);
-  std::vector<std::thread> threads(num_threads);
-  for (std::size_t thread_i = 0; thread_i < num_threads; thread_i++) {
-    threads[thread_i] = std::thread([&, thread_i] {
-      std::size_t amount = (local_width / num_threads) + (thread_i < local_width % num_threads ? 1 : 0);
-      std::size_t left = ((local_width / num_threads) * thread_i) + std::min(local_width % num_threads, thread_i);
-      std::size_t right = std::min(left + amount, std::size_t(local_width) - 1);
-      for (std::size_t x = std::max(left, std::size_t(1)); x < right; x++) {
-        for (std::size_t y = 1; y < height_ - 1; y++) {
-          for (std::size_t i = 0; i < 3; i++) {
-            local_output[((y * local_width + x) * 3) + i] = std::clamp(static_cast<int>(std::round(
+  // Inner columns split into equal blocks on the shared pool
+  ppc::core::ThreadPool::Global().ParallelFor(1, local_width - 1, [&](int64_t left, int64_t right) {
+    for (auto x = static_cast<std::size_t>(left); x < static_cast<std::size_t>(right); x++) {
+      for (std::size_t y = 1; y < height_ - 1; y++) {
+        for (std::size_t i = 0; i < 3; i++) {
+          local_output[((y * local_width + x) * 3) + i] = std::clamp(static_cast<int>(std::round(
 #define INNER(Y_SHIFT, X_SHIFT) \
   local_input[((((y + (Y_SHIFT)) * local_width) + x + (X_SHIFT)) * 3) + i] * kernel_[4 + (3 * (Y_SHIFT)) + (X_SHIFT)]
 #define OUTER(Y) (INNER(Y, -1) + INNER(Y, 0) + INNER(Y, 1))
-                                                                           (OUTER(-1) + OUTER(0) + OUTER(1))
+                                                                         (OUTER(-1) + OUTER(0) + OUTER(1))
 #undef OUTER
 #undef INNER
-                                                                               )),
-                                                                       0, 255);
-          }
+                                                                             )),
+                                                                     0, 255);
         }
       }
-    });
-  }
-  for (std::size_t thread_i = 0; thread_i < num_threads; thread_i++) {
-    threads[thread_i].join();
-  }
+    }
+  });
 
   /////
 
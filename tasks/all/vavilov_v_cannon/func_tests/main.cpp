@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "all/vavilov_v_cannon/include/ops_all.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+std::vector<double> GenerateRandomMatrix(int n, uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-10.0, 10.0);
+  std::vector<double> matrix(n * n);
+  for (auto &value : matrix) {
+    value = dist(gen);
+  }
+  return matrix;
+}
+
+std::vector<double> MultMat(const std::vector<double> &a, const std::vector<double> &b, int n) {
+  std::vector<double> c(n * n, 0.0);
+  for (int i = 0; i < n; i++) {
+    for (int k = 0; k < n; k++) {
+      for (int j = 0; j < n; j++) {
+        c[(i * n) + j] += a[(i * n) + k] * b[(k * n) + j];
+      }
+    }
+  }
+  return c;
+}
+
+void RunAndCheck(int n) {
+  boost::mpi::communicator world;
+  auto a = GenerateRandomMatrix(n, 1);
+  auto b = GenerateRandomMatrix(n, 2);
+  std::vector<double> c(n * n, 0.0);
+
+  auto task_data_all = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.data()));
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t *>(b.data()));
+    task_data_all->inputs_count.emplace_back(a.size());
+    task_data_all->inputs_count.emplace_back(b.size());
+    task_data_all->outputs.emplace_back(reinterpret_cast<uint8_t *>(c.data()));
+    task_data_all->outputs_count.emplace_back(c.size());
+  }
+
+  vavilov_v_cannon_all::CannonALL task_all(task_data_all);
+  ASSERT_TRUE(task_all.Validation());
+  task_all.PreProcessing();
+  task_all.Run();
+  task_all.PostProcessing();
+
+  if (world.rank() == 0) {
+    auto expected = MultMat(a, b, n);
+    for (std::size_t i = 0; i < expected.size(); i++) {
+      ASSERT_NEAR(c[i], expected[i], 1e-9) << "n = " << n << ", element " << i;
+    }
+  }
+}
+
+}  // namespace
+
+TEST(vavilov_v_cannon_all, test_1x1) { RunAndCheck(1); }
+
+TEST(vavilov_v_cannon_all, test_16x16) { RunAndCheck(16); }
+
+TEST(vavilov_v_cannon_all, test_37x37) { RunAndCheck(37); }
+
+TEST(vavilov_v_cannon_all, test_100x100) { RunAndCheck(100); }
+
+TEST(vavilov_v_cannon_all, test_runs_twice) {
+  RunAndCheck(24);
+  RunAndCheck(9);
+}
+
+TEST(vavilov_v_cannon_all, test_grid_size) {
+  EXPECT_EQ(vavilov_v_cannon_all::CannonALL::GridSize(100, 1), 1);
+  EXPECT_EQ(vavilov_v_cannon_all::CannonALL::GridSize(100, 4), 2);
+  EXPECT_EQ(vavilov_v_cannon_all::CannonALL::GridSize(100, 6), 2);
+  EXPECT_EQ(vavilov_v_cannon_all::CannonALL::GridSize(100, 16), 4);
+  EXPECT_EQ(vavilov_v_cannon_all::CannonALL::GridSize(2, 16), 2);
+  // 9 rows in blocks of 3 leave a 4 x 4 grid one block row short
+  EXPECT_EQ(vavilov_v_cannon_all::CannonALL::GridSize(9, 16), 3);
+}
+
+TEST(vavilov_v_cannon_all, test_error_validation) {
+  boost::mpi::communicator world;
+  std::vector<double> a(16, 1.0);
+  std::vector<double> b(9, 1.0);
+  std::vector<double> c(16, 0.0);
+
+  auto task_data_all = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.data()));
+    task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t *>(b.data()));
+    task_data_all->inputs_count.emplace_back(a.size());
+    task_data_all->inputs_count.emplace_back(b.size());
+    task_data_all->outputs.emplace_back(reinterpret_cast<uint8_t *>(c.data()));
+    task_data_all->outputs_count.emplace_back(c.size());
+  }
+
+  vavilov_v_cannon_all::CannonALL task_all(task_data_all);
+  EXPECT_FALSE(task_all.Validation());
+}
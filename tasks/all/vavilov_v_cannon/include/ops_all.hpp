@@ -0,0 +1,54 @@
+#pragma once
+
+#include <boost/mpi/cartesian_communicator.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "core/gemm/include/blocked_matrix.hpp"
+#include "core/task/include/task.hpp"
+
+namespace vavilov_v_cannon_all {
+
+// Cannon's algorithm on a q x q periodic grid of MPI ranks, q = floor(sqrt(ranks)) lowered until
+// N splits into exactly q block rows; other ranks stay idle. Rank 0 holds the matrices, deals the
+// pre-skewed blocks out and collects the blocks of C. Every shift is posted with isend/irecv into
+// a second pair of buffers before the local product, which runs on the rank's OpenMP threads.
+class CannonALL : public ppc::core::Task {
+ public:
+  explicit CannonALL(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  // Side of the process grid used for an n x n product on the given number of ranks
+  static int GridSize(int n, int num_ranks);
+
+ private:
+  void Distribute();
+  void LocalMultiply();
+  void Collect();
+
+  boost::mpi::communicator world_;
+  // null on ranks outside the grid
+  std::unique_ptr<boost::mpi::cartesian_communicator> grid_;
+
+  int n_ = 0;
+  int q_ = 1;
+  int block_size_ = 0;
+
+  // rank 0 only: whole matrices, tiled with one tile per grid rank
+  ppc::core::BlockedMatrix<double> A_;
+  ppc::core::BlockedMatrix<double> B_;
+  ppc::core::BlockedMatrix<double> C_;
+
+  // current blocks, the blocks in flight and the local block of C
+  std::vector<double> a_, b_;
+  std::vector<double> a_next_, b_next_;
+  std::vector<double> c_;
+};
+
+}  // namespace vavilov_v_cannon_all
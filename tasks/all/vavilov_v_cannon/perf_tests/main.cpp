@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "all/vavilov_v_cannon/include/ops_all.hpp"
+#include "core/perf/include/perf.hpp"
+#include "core/perf/include/scaling.hpp"
+#include "core/task/include/task.hpp"
+
+namespace {
+
+// Matrices of one task; they must outlive it
+struct CannonData {
+  std::vector<double> a;
+  std::vector<double> b;
+  std::vector<double> c;
+};
+
+std::shared_ptr<vavilov_v_cannon_all::CannonALL> MakeCannonTask(int n, CannonData &data) {
+  std::mt19937 gen(static_cast<uint32_t>(n));
+  std::uniform_real_distribution<double> dist(-10.0, 10.0);
+  data.a.resize(static_cast<std::size_t>(n) * n);
+  data.b.resize(data.a.size());
+  data.c.assign(data.a.size(), 0.0);
+  for (std::size_t i = 0; i < data.a.size(); i++) {
+    data.a[i] = dist(gen);
+    data.b[i] = dist(gen);
+  }
+
+  auto task_data_all = std::make_shared<ppc::core::TaskData>();
+  task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t *>(data.a.data()));
+  task_data_all->inputs.emplace_back(reinterpret_cast<uint8_t *>(data.b.data()));
+  task_data_all->inputs_count.emplace_back(data.a.size());
+  task_data_all->inputs_count.emplace_back(data.b.size());
+  task_data_all->outputs.emplace_back(reinterpret_cast<uint8_t *>(data.c.data()));
+  task_data_all->outputs_count.emplace_back(data.c.size());
+  return std::make_shared<vavilov_v_cannon_all::CannonALL>(task_data_all);
+}
+
+std::shared_ptr<ppc::core::PerfAttr> MakePerfAttr() {
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [t0] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+  return perf_attr;
+}
+
+// Thread counts per rank: powers of two while ranks x threads fits the machine
+ppc::core::ScalingAttr MakeScalingAttr(const boost::mpi::communicator &world) {
+  const int cores = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  const int max_threads = std::max(1, cores / world.size());
+  ppc::core::ScalingAttr scaling_attr;
+  for (int threads = 1; threads <= max_threads; threads *= 2) {
+    scaling_attr.thread_counts.push_back(threads);
+  }
+  scaling_attr.num_running = 3;
+  return scaling_attr;
+}
+
+// Curves are labelled with the rank count, so runs under different mpirun -np line up
+void PrintCurves(const boost::mpi::communicator &world, const std::vector<ppc::core::ScalingCurve> &curves) {
+  if (world.rank() == 0) {
+    ppc::core::ScalingStudy::Print("vavilov_v_cannon_all_np" + std::to_string(world.size()), curves);
+  }
+}
+
+}  // namespace
+
+TEST(vavilov_v_cannon_all, test_pipeline_run) {
+  constexpr int kN = 1024;
+  boost::mpi::communicator world;
+  CannonData data;
+  auto test_task_all = MakeCannonTask(kN, data);
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_all);
+  perf_analyzer->PipelineRun(MakePerfAttr(), perf_results);
+  if (world.rank() == 0) {
+    ppc::core::Perf::PrintPerfStatistic(perf_results);
+  }
+}
+
+TEST(vavilov_v_cannon_all, test_task_run) {
+  constexpr int kN = 1024;
+  boost::mpi::communicator world;
+  CannonData data;
+  auto test_task_all = MakeCannonTask(kN, data);
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_all);
+  perf_analyzer->TaskRun(MakePerfAttr(), perf_results);
+  if (world.rank() == 0) {
+    ppc::core::Perf::PrintPerfStatistic(perf_results);
+  }
+}
+
+TEST(vavilov_v_cannon_all, test_strong_scaling) {
+  boost::mpi::communicator world;
+  CannonData data;
+  auto scaling_attr = MakeScalingAttr(world);
+  // Input size is the matrix side
+  scaling_attr.input_sizes = {512, 1024};
+  ppc::core::ScalingStudy study([&](uint64_t size) { return MakeCannonTask(static_cast<int>(size), data); },
+                                scaling_attr);
+  auto curves = study.StrongScaling();
+  PrintCurves(world, curves);
+  for (const auto &curve : curves) {
+    ASSERT_FALSE(curve.points.empty());
+  }
+}
+
+TEST(vavilov_v_cannon_all, test_weak_scaling) {
+  boost::mpi::communicator world;
+  CannonData data;
+  auto scaling_attr = MakeScalingAttr(world);
+  // Input size is the multiply-add count per thread of a rank; the side grows with the cube root
+  // of ranks x threads
+  scaling_attr.input_sizes = {512ULL * 512 * 512};
+  ppc::core::ScalingStudy study(
+      [&](uint64_t work) {
+        const double total = static_cast<double>(work) * world.size();
+        return MakeCannonTask(static_cast<int>(std::cbrt(total)), data);
+      },
+      scaling_attr);
+  auto curves = study.WeakScaling();
+  PrintCurves(world, curves);
+  for (const auto &curve : curves) {
+    ASSERT_FALSE(curve.points.empty());
+  }
+}
@@ -0,0 +1,178 @@
+#include "all/vavilov_v_cannon/include/ops_all.hpp"
+
+#include <omp.h>
+
+#include <algorithm>
+#include <boost/mpi/cartesian_communicator.hpp>
+#include <boost/mpi/collectives/broadcast.hpp>
+#include <boost/mpi/nonblocking.hpp>
+#include <boost/mpi/request.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "core/gemm/include/blocked_matrix.hpp"
+#include "core/gemm/include/gemm.hpp"
+
+namespace {
+
+enum Tag : uint8_t { kTagA, kTagB, kTagC };
+
+}  // namespace
+
+int vavilov_v_cannon_all::CannonALL::GridSize(int n, int num_ranks) {
+  int q = std::max(1, std::min(n, static_cast<int>(std::sqrt(num_ranks))));
+  // Every grid rank needs a block: ceil(n / block) must come out as q
+  while (q > 1 && (n + ((n + q - 1) / q) - 1) / ((n + q - 1) / q) != q) {
+    q--;
+  }
+  return q;
+}
+
+bool vavilov_v_cannon_all::CannonALL::ValidationImpl() {
+  bool valid = true;
+  if (world_.rank() == 0) {
+    const auto n = static_cast<unsigned int>(std::sqrt(task_data->inputs_count[0]));
+    valid = task_data->inputs_count[0] > 0 && n * n == task_data->inputs_count[0] &&
+            task_data->inputs_count[1] == task_data->inputs_count[0] &&
+            task_data->outputs_count[0] == task_data->inputs_count[0];
+  }
+  // Ranks must agree, the later stages are collective
+  boost::mpi::broadcast(world_, valid, 0);
+  return valid;
+}
+
+bool vavilov_v_cannon_all::CannonALL::PreProcessingImpl() {
+  if (world_.rank() == 0) {
+    n_ = static_cast<int>(std::sqrt(task_data->inputs_count[0]));
+  }
+  boost::mpi::broadcast(world_, n_, 0);
+  q_ = GridSize(n_, world_.size());
+  block_size_ = (n_ + q_ - 1) / q_;
+
+  const bool in_grid = world_.rank() < q_ * q_;
+  auto active = world_.split(in_grid ? 0 : 1);
+  grid_.reset();
+  if (!in_grid) {
+    return true;
+  }
+  grid_ = std::make_unique<boost::mpi::cartesian_communicator>(
+      active, boost::mpi::cartesian_topology({{q_, true}, {q_, true}}));
+
+  const auto block_elems = static_cast<std::size_t>(block_size_) * block_size_;
+  a_.resize(block_elems);
+  b_.resize(block_elems);
+  a_next_.resize(block_elems);
+  b_next_.resize(block_elems);
+  c_.resize(block_elems);
+
+  if (world_.rank() == 0) {
+    A_ = ppc::core::BlockedMatrix<double>::FromRowMajor(reinterpret_cast<double *>(task_data->inputs[0]), n_, n_, n_,
+                                                        block_size_);
+    B_ = ppc::core::BlockedMatrix<double>::FromRowMajor(reinterpret_cast<double *>(task_data->inputs[1]), n_, n_, n_,
+                                                        block_size_);
+    C_.Resize(n_, n_, block_size_);
+  }
+  return true;
+}
+
+void vavilov_v_cannon_all::CannonALL::Distribute() {
+  const int count = block_size_ * block_size_;
+  std::vector<boost::mpi::request> requests;
+  if (grid_->rank() == 0) {
+    // Rank (i, j) starts with A block (i, i + j) and B block (i + j, j)
+    for (int rank = 0; rank < q_ * q_; rank++) {
+      const auto coords = grid_->coordinates(rank);
+      const int k = (coords[0] + coords[1]) % q_;
+      const double *a_tile = A_.Tile(coords[0], k);
+      const double *b_tile = B_.Tile(k, coords[1]);
+      if (rank == 0) {
+        std::copy(a_tile, a_tile + count, a_.begin());
+        std::copy(b_tile, b_tile + count, b_.begin());
+      } else {
+        requests.push_back(grid_->isend(rank, kTagA, a_tile, count));
+        requests.push_back(grid_->isend(rank, kTagB, b_tile, count));
+      }
+    }
+  } else {
+    requests.push_back(grid_->irecv(0, kTagA, a_.data(), count));
+    requests.push_back(grid_->irecv(0, kTagB, b_.data(), count));
+  }
+  boost::mpi::wait_all(requests.begin(), requests.end());
+}
+
+void vavilov_v_cannon_all::CannonALL::LocalMultiply() {
+  // Each thread takes a band of rows of the local block
+#pragma omp parallel
+  {
+    const int threads = omp_get_num_threads();
+    const int thread = omp_get_thread_num();
+    const int row_begin = block_size_ * thread / threads;
+    const int row_end = block_size_ * (thread + 1) / threads;
+    if (row_begin < row_end) {
+      const auto offset = static_cast<std::size_t>(row_begin) * block_size_;
+      ppc::core::Gemm<double>(row_end - row_begin, block_size_, block_size_, 1.0, a_.data() + offset, block_size_,
+                              b_.data(), block_size_, 1.0, c_.data() + offset, block_size_);
+    }
+  }
+}
+
+void vavilov_v_cannon_all::CannonALL::Collect() {
+  const int count = block_size_ * block_size_;
+  std::vector<boost::mpi::request> requests;
+  if (grid_->rank() == 0) {
+    for (int rank = 0; rank < q_ * q_; rank++) {
+      const auto coords = grid_->coordinates(rank);
+      double *tile = C_.Tile(coords[0], coords[1]);
+      if (rank == 0) {
+        std::ranges::copy(c_, tile);
+      } else {
+        requests.push_back(grid_->irecv(rank, kTagC, tile, count));
+      }
+    }
+  } else {
+    requests.push_back(grid_->isend(0, kTagC, c_.data(), count));
+  }
+  boost::mpi::wait_all(requests.begin(), requests.end());
+}
+
+bool vavilov_v_cannon_all::CannonALL::RunImpl() {
+  if (!grid_) {
+    return true;
+  }
+  Distribute();
+  std::ranges::fill(c_, 0.0);
+
+  // A blocks move one position left along the row, B blocks one position up along the column
+  const auto [a_source, a_dest] = grid_->shifted_ranks(1, -1);
+  const auto [b_source, b_dest] = grid_->shifted_ranks(0, -1);
+  const int count = block_size_ * block_size_;
+  std::vector<boost::mpi::request> requests;
+  for (int step = 0; step < q_; step++) {
+    requests.clear();
+    // The next blocks travel while the current ones are multiplied; sends only read a_ and b_
+    if (step + 1 < q_) {
+      requests.push_back(grid_->irecv(a_source, kTagA, a_next_.data(), count));
+      requests.push_back(grid_->irecv(b_source, kTagB, b_next_.data(), count));
+      requests.push_back(grid_->isend(a_dest, kTagA, a_.data(), count));
+      requests.push_back(grid_->isend(b_dest, kTagB, b_.data(), count));
+    }
+    LocalMultiply();
+    boost::mpi::wait_all(requests.begin(), requests.end());
+    std::swap(a_, a_next_);
+    std::swap(b_, b_next_);
+  }
+
+  Collect();
+  return true;
+}
+
+bool vavilov_v_cannon_all::CannonALL::PostProcessingImpl() {
+  if (world_.rank() == 0) {
+    C_.Store(reinterpret_cast<double *>(task_data->outputs[0]), n_);
+  }
+  return true;
+}
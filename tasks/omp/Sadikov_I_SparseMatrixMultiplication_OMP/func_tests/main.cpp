@@ -1,11 +1,16 @@
 #include <gtest/gtest.h>
+#include <omp.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <initializer_list>
 #include <memory>
 #include <random>
+#include <utility>
 #include <vector>
 
+#include "core/linalg/include/spgemm.hpp"
 #include "core/task/include/task.hpp"
 #include "omp/Sadikov_I_SparseMatrixMultiplication_OMP/include/SparseMatrix.hpp"
 #include "omp/Sadikov_I_SparseMatrixMultiplication_OMP/include/ops_omp.hpp"
@@ -24,6 +29,55 @@ std::vector<double> GetRandomMatrix(int size) {
   std::ranges::shuffle(data, gen);
   return data;
 }
+
+constexpr std::initializer_list<int> kStressThreads{1, 17, 19, 64, 128};
+
+// size x size matrix with column_entries distinct rows in every column
+sadikov_i_sparse_matrix_multiplication_task_omp::SparseMatrix GetSparseMatrix(int size, int column_entries,
+                                                                             uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> row(0, size - 1);
+  std::uniform_real_distribution<double> value(-1.0, 1.0);
+  std::vector<double> values;
+  std::vector<int> rows;
+  std::vector<int> elements_sum;
+  for (int j = 0; j < size; ++j) {
+    std::vector<int> column;
+    while (static_cast<int>(column.size()) < column_entries) {
+      const int candidate = row(gen);
+      if (std::ranges::find(column, candidate) == column.end()) {
+        column.push_back(candidate);
+      }
+    }
+    std::ranges::sort(column);
+    for (int i : column) {
+      rows.push_back(i);
+      values.push_back(value(gen));
+    }
+    elements_sum.push_back(static_cast<int>(rows.size()));
+  }
+  return sadikov_i_sparse_matrix_multiplication_task_omp::SparseMatrix(size, size, std::move(values), std::move(rows),
+                                                                       std::move(elements_sum));
+}
+
+// Team of exactly threads for the parallel regions of the scope, restored on exit
+class ThreadCount {
+ public:
+  explicit ThreadCount(int threads) : dynamic_(omp_get_dynamic()), threads_(omp_get_max_threads()) {
+    omp_set_dynamic(0);
+    omp_set_num_threads(threads);
+  }
+  ThreadCount(const ThreadCount &) = delete;
+  ThreadCount &operator=(const ThreadCount &) = delete;
+  ~ThreadCount() {
+    omp_set_num_threads(threads_);
+    omp_set_dynamic(dynamic_);
+  }
+
+ private:
+  int dynamic_;
+  int threads_;
+};
 }  // namespace
 
 TEST(sadikov_i_sparse_matrix_multiplication_task_omp, test_rect_matrixes) {
@@ -125,4 +179,191 @@ TEST(sadikov_i_sparse_matrix_multiplication_task_omp, test_random_matrix) {
   for (auto i = 0; i < static_cast<int>(out.size()); ++i) {
     EXPECT_NEAR(out[i], check_out[i], kEpsilon);
   }
-}
\ No newline at end of file
+}
+
+TEST(sadikov_i_sparse_matrix_multiplication_task_omp, test_negative_entries) {
+  constexpr auto kEpsilon = 0.000001;
+  constexpr auto kSize = 30;
+  auto fmatrix = GetRandomMatrix(kSize * kSize);
+  auto smatrix = GetRandomMatrix(kSize * kSize);
+  for (size_t i = 0; i < fmatrix.size(); i += 2) {
+    fmatrix[i] = -fmatrix[i];
+  }
+  std::vector<double> out(kSize * kSize, 0.0);
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(fmatrix.data()));
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(smatrix.data()));
+  for (auto i = 0; i < 4; ++i) {
+    task_data_seq->inputs_count.emplace_back(kSize);
+  }
+  task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_seq->outputs_count.emplace_back(out.size());
+  auto check_out = sadikov_i_sparse_matrix_multiplication_task_omp::BaseMatrixMultiplication(fmatrix, kSize, kSize,
+                                                                                             smatrix, kSize, kSize);
+  sadikov_i_sparse_matrix_multiplication_task_omp::CCSMatrixOMP test_task_sequential(task_data_seq);
+  ASSERT_EQ(test_task_sequential.Validation(), true);
+  test_task_sequential.PreProcessing();
+  test_task_sequential.Run();
+  test_task_sequential.PostProcessing();
+  for (auto i = 0; i < static_cast<int>(out.size()); ++i) {
+    EXPECT_NEAR(out[i], check_out[i], kEpsilon);
+  }
+}
+
+TEST(sadikov_i_sparse_matrix_multiplication_task_omp, test_product_shape) {
+  constexpr auto kEpsilon = 0.000001;
+  std::vector<double> fmatrix{1.0, 0.0, -2.0, 0.0, 3.0, 0.0, 4.0, 0.0, 0.0, -1.0};
+  std::vector<double> smatrix{2.0, 0.0, 0.0, 1.0, 0.0, 0.0, 5.0, 0.0, 1.0,  0.0,
+                              0.0, 0.0, 0.0, 3.0, 0.0, 0.0, 0.0, 0.0, -1.0, 2.0};
+  auto fsparse = sadikov_i_sparse_matrix_multiplication_task_omp::MatrixToSparse(2, 5, fmatrix);
+  auto ssparse = sadikov_i_sparse_matrix_multiplication_task_omp::MatrixToSparse(5, 4, smatrix);
+  auto product = fsparse * ssparse;
+  ASSERT_EQ(product.GetRowsCount(), 2);
+  ASSERT_EQ(product.GetColumnsCount(), 4);
+  auto out = sadikov_i_sparse_matrix_multiplication_task_omp::FromSparseMatrix(product);
+  auto check_out =
+      sadikov_i_sparse_matrix_multiplication_task_omp::BaseMatrixMultiplication(fmatrix, 2, 5, smatrix, 5, 4);
+  ASSERT_EQ(out.size(), check_out.size());
+  for (auto i = 0; i < static_cast<int>(out.size()); ++i) {
+    EXPECT_NEAR(out[i], check_out[i], kEpsilon);
+  }
+}
+
+TEST(sadikov_i_sparse_matrix_multiplication_task_omp, test_thread_count_stress) {
+  constexpr auto kEpsilon = 0.000001;
+  constexpr auto kSize = 150;
+  auto fmatrix = GetRandomMatrix(kSize * kSize);
+  auto smatrix = GetRandomMatrix(kSize * kSize);
+  auto check_out = sadikov_i_sparse_matrix_multiplication_task_omp::BaseMatrixMultiplication(fmatrix, kSize, kSize,
+                                                                                             smatrix, kSize, kSize);
+  for (int threads : kStressThreads) {
+    const ThreadCount thread_count(threads);
+    std::vector<double> out(kSize * kSize, 0.0);
+    auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+    task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(fmatrix.data()));
+    task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t *>(smatrix.data()));
+    for (auto i = 0; i < 4; ++i) {
+      task_data_seq->inputs_count.emplace_back(kSize);
+    }
+    task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+    task_data_seq->outputs_count.emplace_back(out.size());
+    sadikov_i_sparse_matrix_multiplication_task_omp::CCSMatrixOMP test_task_sequential(task_data_seq);
+    ASSERT_EQ(test_task_sequential.Validation(), true);
+    test_task_sequential.PreProcessing();
+    test_task_sequential.Run();
+    test_task_sequential.PostProcessing();
+    for (auto i = 0; i < static_cast<int>(out.size()); ++i) {
+      ASSERT_NEAR(out[i], check_out[i], kEpsilon) << threads << " threads";
+    }
+  }
+}
+
+TEST(sadikov_i_sparse_matrix_multiplication_task_omp, test_product_does_not_depend_on_thread_count) {
+  // enough columns for every thread of the largest team to get chunks of its own
+  constexpr auto kSize = 20000;
+  auto fmatrix = GetSparseMatrix(kSize, 5, 1);
+  auto smatrix = GetSparseMatrix(kSize, 5, 2);
+  sadikov_i_sparse_matrix_multiplication_task_omp::SparseMatrix reference;
+  for (int threads : kStressThreads) {
+    const ThreadCount thread_count(threads);
+    int team = 0;
+#pragma omp parallel
+    {
+#pragma omp single
+      team = omp_get_num_threads();
+    }
+    ASSERT_EQ(team, threads);
+    auto product = fmatrix * smatrix;
+    if (threads == 1) {
+      reference = std::move(product);
+      continue;
+    }
+    EXPECT_EQ(product.GetElementsSum(), reference.GetElementsSum()) << threads << " threads";
+    EXPECT_EQ(product.GetRows(), reference.GetRows()) << threads << " threads";
+    EXPECT_EQ(product.GetValues(), reference.GetValues()) << threads << " threads";
+  }
+}
+
+TEST(sadikov_i_sparse_matrix_multiplication_task_omp, test_sparse_inputs_and_output) {
+  constexpr auto kEpsilon = 0.000001;
+  auto fdense = GetRandomMatrix(30 * 20);
+  auto sdense = GetRandomMatrix(20 * 25);
+  const auto fmatrix = ppc::core::CcsMatrix::FromDense(fdense.data(), 30, 20);
+  const auto smatrix = ppc::core::CcsMatrix::FromDense(sdense.data(), 20, 25);
+  ppc::core::CcsMatrix product;
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->AddInput(&fmatrix, 1);
+  task_data_seq->AddInput(&smatrix, 1);
+  task_data_seq->AddOutput(&product, 1);
+  sadikov_i_sparse_matrix_multiplication_task_omp::CCSMatrixOMP test_task_sequential(task_data_seq);
+  ASSERT_EQ(test_task_sequential.Validation(), true);
+  test_task_sequential.PreProcessing();
+  test_task_sequential.Run();
+  test_task_sequential.PostProcessing();
+  ASSERT_TRUE(product.IsValid());
+  ASSERT_EQ(product.rows, 30U);
+  ASSERT_EQ(product.cols, 25U);
+  std::vector<double> out(30 * 25);
+  product.ToDense(out.data());
+  auto check_out =
+      sadikov_i_sparse_matrix_multiplication_task_omp::BaseMatrixMultiplication(fdense, 30, 20, sdense, 20, 25);
+  for (auto i = 0; i < static_cast<int>(out.size()); ++i) {
+    EXPECT_NEAR(out[i], check_out[i], kEpsilon);
+  }
+}
+
+TEST(sadikov_i_sparse_matrix_multiplication_task_omp, test_sparse_inputs_dense_output) {
+  constexpr auto kEpsilon = 0.000001;
+  constexpr auto kSize = 40;
+  auto fdense = GetRandomMatrix(kSize * kSize);
+  auto sdense = GetRandomMatrix(kSize * kSize);
+  const auto fmatrix = ppc::core::CcsMatrix::FromDense(fdense.data(), kSize, kSize);
+  const auto smatrix = ppc::core::CcsMatrix::FromDense(sdense.data(), kSize, kSize);
+  std::vector<double> out(kSize * kSize, 0.0);
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->AddInput(&fmatrix, 1);
+  task_data_seq->AddInput(&smatrix, 1);
+  task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_seq->outputs_count.emplace_back(out.size());
+  sadikov_i_sparse_matrix_multiplication_task_omp::CCSMatrixOMP test_task_sequential(task_data_seq);
+  ASSERT_EQ(test_task_sequential.Validation(), true);
+  test_task_sequential.PreProcessing();
+  test_task_sequential.Run();
+  test_task_sequential.PostProcessing();
+  auto check_out = sadikov_i_sparse_matrix_multiplication_task_omp::BaseMatrixMultiplication(fdense, kSize, kSize,
+                                                                                             sdense, kSize, kSize);
+  for (auto i = 0; i < static_cast<int>(out.size()); ++i) {
+    EXPECT_NEAR(out[i], check_out[i], kEpsilon);
+  }
+}
+
+TEST(sadikov_i_sparse_matrix_multiplication_task_omp, test_sparse_validation) {
+  const std::vector<double> dense{1.0, 0.0, 2.0, 0.0, 3.0, 0.0, 4.0, 0.0, 0.0, 0.0, 5.0, 6.0};
+  const auto fmatrix = ppc::core::CcsMatrix::FromDense(dense.data(), 4, 3);
+  auto out_of_range = fmatrix;
+  out_of_range.row_idx[0] = 4;
+  ppc::core::CcsMatrix product;
+  std::vector<double> out(4 * 4);
+  auto validate = [&](const ppc::core::CcsMatrix &f, const ppc::core::CcsMatrix &s, bool sparse_output) {
+    auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+    task_data_seq->AddInput(&f, 1);
+    task_data_seq->AddInput(&s, 1);
+    if (sparse_output) {
+      task_data_seq->AddOutput(&product, 1);
+    } else {
+      task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+      task_data_seq->outputs_count.emplace_back(out.size());
+    }
+    sadikov_i_sparse_matrix_multiplication_task_omp::CCSMatrixOMP test_task_sequential(task_data_seq);
+    return test_task_sequential.Validation();
+  };
+  // 4 x 3 times 4 x 3
+  EXPECT_FALSE(validate(fmatrix, fmatrix, true));
+  // 3 x 4 would fit, but the dense output has room for 4 x 4
+  const auto smatrix = ppc::core::CcsMatrix::FromDense(dense.data(), 3, 4);
+  EXPECT_TRUE(validate(fmatrix, smatrix, true));
+  EXPECT_TRUE(validate(fmatrix, smatrix, false));
+  out.resize(5);
+  EXPECT_FALSE(validate(fmatrix, smatrix, false));
+  EXPECT_FALSE(validate(out_of_range, smatrix, true));
+}
@@ -2,8 +2,12 @@
 
 #include <omp.h>
 
+#include <cstddef>
+#include <utility>
 #include <vector>
 
+#include "core/linalg/include/spgemm.hpp"
+
 namespace sadikov_i_sparse_matrix_multiplication_task_omp {
 class SparseMatrix {
   constexpr static double kMEpsilon = 0.000001;
@@ -12,30 +16,32 @@ class SparseMatrix {
   std::vector<double> m_values_;
   std::vector<int> m_rows_;
   std::vector<int> m_elementsSum_;
-  static SparseMatrix Transpose(const SparseMatrix& matrix);
-  static int GetElementsCount(int index, const std::vector<int>& elements_sum);
-  static double CalculateSum(SparseMatrix& fmatrix, SparseMatrix& smatrix, const std::vector<int>& felements_sum,
-                             const std::vector<int>& selements_sum, int i_index, int j_index);
 
  public:
   SparseMatrix() = default;
-  explicit SparseMatrix(int rows_count, int columns_count, const std::vector<double>& values,
-                        const std::vector<int>& rows, const std::vector<int>& element_sum) noexcept
+  explicit SparseMatrix(int rows_count, int columns_count, std::vector<double> values, std::vector<int> rows,
+                        std::vector<int> element_sum) noexcept
       : m_rowsCount_(rows_count),
         m_columnsCount_(columns_count),
-        m_values_(values),
-        m_rows_(rows),
-        m_elementsSum_(element_sum) {};
+        m_values_(std::move(values)),
+        m_rows_(std::move(rows)),
+        m_elementsSum_(std::move(element_sum)) {};
   [[nodiscard]] const std::vector<double>& GetValues() const noexcept { return m_values_; }
   [[nodiscard]] const std::vector<int>& GetRows() const noexcept { return m_rows_; }
   [[nodiscard]] const std::vector<int>& GetElementsSum() const noexcept { return m_elementsSum_; }
   [[nodiscard]] int GetColumnsCount() const noexcept { return m_columnsCount_; }
   [[nodiscard]] int GetRowsCount() const noexcept { return m_rowsCount_; }
+  // Gustavson product through ppc::core::SpGemm; entries with |c| <= kMEpsilon are left out. Every column is
+  // counted, placed by an exclusive scan and written by one thread, so the result is the same for any team size
   SparseMatrix operator*(SparseMatrix& smatrix) const noexcept(false);
 };
 
 SparseMatrix MatrixToSparse(int rows_count, int columns_count, const std::vector<double>& values);
 
+// Conversions for the native sparse inputs and outputs of the task
+SparseMatrix CcsToSparse(const ppc::core::CcsMatrix& matrix);
+ppc::core::CcsMatrix SparseToCcs(const SparseMatrix& matrix);
+
 std::vector<double> FromSparseMatrix(const SparseMatrix& matrix);
 
 std::vector<double> BaseMatrixMultiplication(const std::vector<double>& fmatrix, int fmatrix_rows_count,
@@ -8,11 +8,16 @@
 
 namespace sadikov_i_sparse_matrix_multiplication_task_omp {
 
+// Inputs are two dense row-major matrices with their sizes in inputs_count[0..3], or two ppc::core::CcsMatrix
+// objects added with AddInput(&matrix, 1). The product goes to a ppc::core::CcsMatrix output added the same way,
+// or to a dense rows x cols buffer, which sparse inputs only fill when asked to
 class CCSMatrixOMP : public ppc::core::Task {
   SparseMatrix m_fMatrix_;
   SparseMatrix m_sMatrix_;
   SparseMatrix m_answerMatrix_;
 
+  [[nodiscard]] bool SparseInputs() const;
+
  public:
   // restart tests
   explicit CCSMatrixOMP(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
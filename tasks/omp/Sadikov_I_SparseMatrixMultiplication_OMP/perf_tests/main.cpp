@@ -2,11 +2,14 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <iostream>
 #include <memory>
 #include <random>
 #include <vector>
 
+#include "core/linalg/include/spgemm.hpp"
 #include "core/perf/include/perf.hpp"
 #include "core/task/include/task.hpp"
 #include "omp/Sadikov_I_SparseMatrixMultiplication_OMP/include/SparseMatrix.hpp"
@@ -27,6 +30,47 @@ std::vector<double> GetRandomMatrix(int size) {
   std::ranges::shuffle(data, gen);
   return data;
 }
+
+// kLargeSize x kLargeSize matrices at 0.01% density, passed to the task as ppc::core::CcsMatrix: their dense
+// form would take 80 GB each
+constexpr int kLargeSize = 100000;
+constexpr int kLargeColumnEntries = 10;
+
+// kLargeColumnEntries distinct rows in every column, values in [-1, -0.5] u [0.5, 1]
+ppc::core::CcsMatrix GetLargeSparseMatrix(uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> row(0, kLargeSize - 1);
+  std::uniform_real_distribution<double> value(0.5, 1.0);
+  std::bernoulli_distribution negative(0.5);
+  ppc::core::CcsMatrix matrix{.rows = kLargeSize, .cols = kLargeSize, .col_ptr = {0}, .row_idx = {}, .values = {}};
+  for (int j = 0; j < kLargeSize; ++j) {
+    std::vector<int> column;
+    while (static_cast<int>(column.size()) < kLargeColumnEntries) {
+      const int candidate = row(gen);
+      if (std::ranges::find(column, candidate) == column.end()) {
+        column.push_back(candidate);
+      }
+    }
+    std::ranges::sort(column);
+    for (int i : column) {
+      matrix.row_idx.push_back(i);
+      matrix.values.push_back(negative(gen) ? -value(gen) : value(gen));
+    }
+    matrix.col_ptr.push_back(static_cast<int>(matrix.row_idx.size()));
+  }
+  return matrix;
+}
+
+// y = matrix * x
+std::vector<double> Multiply(const ppc::core::CcsMatrix &matrix, const std::vector<double> &x) {
+  std::vector<double> y(matrix.rows, 0.0);
+  for (std::size_t j = 0; j < matrix.cols; ++j) {
+    for (int e = matrix.col_ptr[j]; e < matrix.col_ptr[j + 1]; ++e) {
+      y[matrix.row_idx[e]] += matrix.values[e] * x[j];
+    }
+  }
+  return y;
+}
 }  // namespace
 
 TEST(sadikov_i_sparse_matrix_multiplication_task_omp, test_pipeline_run) {
@@ -101,3 +145,46 @@ TEST(sadikov_i_sparse_matrix_multiplication_task_omp, test_task_run) {
     EXPECT_NEAR(out[i], check_out[i], kEpsilon);
   }
 }
+
+TEST(sadikov_i_sparse_matrix_multiplication_task_omp, test_task_run_sparse_large) {
+  const auto fmatrix = GetLargeSparseMatrix(1);
+  const auto smatrix = GetLargeSparseMatrix(2);
+  ppc::core::CcsMatrix product;
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->AddInput(&fmatrix, 1);
+  task_data_seq->AddInput(&smatrix, 1);
+  task_data_seq->AddOutput(&product, 1);
+  auto test_task_sequential =
+      std::make_shared<sadikov_i_sparse_matrix_multiplication_task_omp::CCSMatrixOMP>(task_data_seq);
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 5;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_sequential);
+  perf_analyzer->TaskRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  std::cout << "sadikov_i_sparse_matrix_multiplication_task_omp:spgemm: n=" << kLargeSize
+            << " nnz_a=" << fmatrix.NonZeros() << " nnz_c=" << product.NonZeros()
+            << " time_sec=" << perf_results->median_sec << '\n';
+
+  // C x against A (B x)
+  ASSERT_TRUE(product.IsValid());
+  ASSERT_EQ(product.rows, static_cast<size_t>(kLargeSize));
+  ASSERT_EQ(product.cols, static_cast<size_t>(kLargeSize));
+  std::mt19937 gen(3);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> x(kLargeSize);
+  for (auto &value : x) {
+    value = dist(gen);
+  }
+  const auto expected = Multiply(fmatrix, Multiply(smatrix, x));
+  const auto actual = Multiply(product, x);
+  for (size_t i = 0; i < actual.size(); ++i) {
+    ASSERT_NEAR(actual[i], expected[i], 1e-4) << "row " << i;
+  }
+}
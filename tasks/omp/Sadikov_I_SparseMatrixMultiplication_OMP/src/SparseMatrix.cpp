@@ -7,86 +7,36 @@
 #include <utility>
 #include <vector>
 
+#include "core/linalg/include/spgemm.hpp"
+#include "core/thread_pool/include/omp_chunk_runner.hpp"
+
 namespace sadikov_i_sparse_matrix_multiplication_task_omp {
-SparseMatrix SparseMatrix::Transpose(const SparseMatrix& matrix) {
-  std::vector<double> val;
-  std::vector<int> rows;
-  std::vector<int> elem_sum;
-  auto max_size = std::max(matrix.GetRowsCount(), matrix.GetColumnsCount());
-  std::vector<std::vector<double>> intermediate_values(max_size);
-  std::vector<std::vector<int>> intermediate_indexes(max_size);
-  int counter = 0;
-  for (size_t i = 0; i < matrix.GetElementsSum().size(); ++i) {
-    auto limit = i == 0 ? matrix.GetElementsSum()[0] : matrix.GetElementsSum()[i] - matrix.GetElementsSum()[i - 1];
-    for (int j = 0; j < limit; ++j) {
-      intermediate_values[matrix.GetRows()[counter]].emplace_back(matrix.GetValues()[counter]);
-      intermediate_indexes[matrix.GetRows()[counter]].emplace_back(i);
-      counter++;
-    }
-  }
-  for (size_t i = 0; i < intermediate_values.size(); ++i) {
-    for (size_t j = 0; j < intermediate_values[i].size(); ++j) {
-      val.emplace_back(intermediate_values[i][j]);
-      rows.emplace_back(intermediate_indexes[i][j]);
-    }
-    if (i > 0) {
-      elem_sum.emplace_back(intermediate_values[i].size() + elem_sum[i - 1]);
-    } else {
-      elem_sum.emplace_back(intermediate_values[i].size());
-    }
-  }
-  return SparseMatrix(matrix.GetColumnsCount(), matrix.GetRowsCount(), val, rows, elem_sum);
-}
-double SparseMatrix::CalculateSum(SparseMatrix& fmatrix, SparseMatrix& smatrix, const std::vector<int>& felements_sum,
-                                  const std::vector<int>& selements_sum, int i_index, int j_index) {
-  int fmatrix_elements_count = GetElementsCount(j_index, felements_sum);
-  int smatrix_elements_count = GetElementsCount(i_index, selements_sum);
-  int fmatrix_start_index = j_index != 0 ? felements_sum[j_index] - fmatrix_elements_count : 0;
-  int smatrix_start_index = i_index != 0 ? selements_sum[i_index] - smatrix_elements_count : 0;
-  double sum = 0.0;
-  for (int i = 0; i < fmatrix_elements_count; i++) {
-    for (int j = 0; j < smatrix_elements_count; j++) {
-      if (fmatrix.GetRows()[fmatrix_start_index + i] == smatrix.GetRows()[smatrix_start_index + j]) {
-        sum += fmatrix.GetValues()[i + fmatrix_start_index] * smatrix.GetValues()[j + smatrix_start_index];
-      }
-    }
-  }
-  return sum;
+namespace {
+// Column offsets in the ppc::core::CcsView layout: m_elementsSum_ with a leading 0
+std::vector<int> ColumnOffsets(const std::vector<int>& elements_sum) {
+  std::vector<int> col_ptr(elements_sum.size() + 1, 0);
+  std::ranges::copy(elements_sum, col_ptr.begin() + 1);
+  return col_ptr;
 }
+}  // namespace
 
 SparseMatrix SparseMatrix::operator*(SparseMatrix& smatrix) const {
-  std::vector<double> values;
-  std::vector<int> rows;
-  std::vector<int> elements_sum(smatrix.GetColumnsCount());
-  auto fmatrix = Transpose(*this);
-  const auto& felements_sum = fmatrix.GetElementsSum();
-  const auto& selements_sum = smatrix.GetElementsSum();
-  std::vector<std::vector<std::pair<double, int>>> intermediate_values(18);
-#pragma omp parallel
-  {
-    std::vector<std::pair<double, int>> thread_data;
-#pragma omp for
-    for (int i = 0; i < static_cast<int>(selements_sum.size()); ++i) {
-      for (int j = 0; j < static_cast<int>(felements_sum.size()); ++j) {
-        double sum = CalculateSum(fmatrix, smatrix, felements_sum, selements_sum, i, j);
-        if (sum > kMEpsilon) {
-          thread_data.emplace_back(sum, j);
-          elements_sum[i]++;
-        }
-      }
-    }
-    intermediate_values[omp_get_thread_num()] = thread_data;
-  }
-  for (auto&& it : intermediate_values) {
-    for (auto&& it2 : it) {
-      values.emplace_back(it2.first);
-      rows.emplace_back(it2.second);
-    }
-  }
-  for (size_t i = 1; i < elements_sum.size(); ++i) {
-    elements_sum[i] = elements_sum[i] + elements_sum[i - 1];
-  }
-  return SparseMatrix(smatrix.GetColumnsCount(), smatrix.GetColumnsCount(), values, rows, elements_sum);
+  const auto fcol_ptr = ColumnOffsets(m_elementsSum_);
+  const auto scol_ptr = ColumnOffsets(smatrix.m_elementsSum_);
+  const ppc::core::CcsView fview{.rows = static_cast<std::size_t>(m_rowsCount_),
+                                 .cols = static_cast<std::size_t>(m_columnsCount_),
+                                 .col_ptr = fcol_ptr.data(),
+                                 .row_idx = m_rows_.data(),
+                                 .values = m_values_.data()};
+  const ppc::core::CcsView sview{.rows = static_cast<std::size_t>(smatrix.m_rowsCount_),
+                                 .cols = static_cast<std::size_t>(smatrix.m_columnsCount_),
+                                 .col_ptr = scol_ptr.data(),
+                                 .row_idx = smatrix.m_rows_.data(),
+                                 .values = smatrix.m_values_.data()};
+  auto product = ppc::core::SpGemm(ppc::core::RunOmp).Multiply(fview, sview, kMEpsilon);
+  std::vector<int> elements_sum(product.col_ptr.begin() + 1, product.col_ptr.end());
+  return SparseMatrix(m_rowsCount_, smatrix.m_columnsCount_, std::move(product.values), std::move(product.row_idx),
+                      std::move(elements_sum));
 }
 
 SparseMatrix MatrixToSparse(int rows_count, int columns_count, const std::vector<double>& values) {
@@ -105,7 +55,21 @@ SparseMatrix MatrixToSparse(int rows_count, int columns_count, const std::vector
       sums[i + 1] = sums[i];
     }
   }
-  return SparseMatrix(rows_count, columns_count, val, rows, sums);
+  return SparseMatrix(rows_count, columns_count, std::move(val), std::move(rows), std::move(sums));
+}
+
+SparseMatrix CcsToSparse(const ppc::core::CcsMatrix& matrix) {
+  return SparseMatrix(static_cast<int>(matrix.rows), static_cast<int>(matrix.cols), matrix.values, matrix.row_idx,
+                      std::vector<int>(matrix.col_ptr.begin() + 1, matrix.col_ptr.end()));
+}
+
+ppc::core::CcsMatrix SparseToCcs(const SparseMatrix& matrix) {
+  ppc::core::CcsMatrix ccs{.rows = static_cast<std::size_t>(matrix.GetRowsCount()),
+                           .cols = static_cast<std::size_t>(matrix.GetColumnsCount()),
+                           .col_ptr = ColumnOffsets(matrix.GetElementsSum()),
+                           .row_idx = matrix.GetRows(),
+                           .values = matrix.GetValues()};
+  return ccs;
 }
 
 std::vector<double> FromSparseMatrix(const SparseMatrix& matrix) {
@@ -121,13 +85,6 @@ std::vector<double> FromSparseMatrix(const SparseMatrix& matrix) {
   return simple_matrix;
 }
 
-int SparseMatrix::GetElementsCount(int index, const std::vector<int>& elements_sum) {
-  if (index == 0) {
-    return elements_sum[index];
-  }
-  return elements_sum[index] - elements_sum[index - 1];
-}
-
 std::vector<double> BaseMatrixMultiplication(const std::vector<double>& fmatrix, int fmatrix_rows_count,
                                              int fmatrix_columns_count, const std::vector<double>& smatrix,
                                              int smatrix_rows_count, int smatrix_columns_count) {
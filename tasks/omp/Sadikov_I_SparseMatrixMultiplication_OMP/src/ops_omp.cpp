@@ -1,11 +1,18 @@
 #include "omp/Sadikov_I_SparseMatrixMultiplication_OMP/include/ops_omp.hpp"
 
 #include <cstddef>
+#include <cstdint>
 #include <vector>
 
+#include "core/linalg/include/spgemm.hpp"
 #include "omp/Sadikov_I_SparseMatrixMultiplication_OMP/include/SparseMatrix.hpp"
 
 bool sadikov_i_sparse_matrix_multiplication_task_omp::CCSMatrixOMP::PreProcessingImpl() {
+  if (SparseInputs()) {
+    m_fMatrix_ = CcsToSparse(task_data->GetInput<ppc::core::CcsMatrix>(0).front());
+    m_sMatrix_ = CcsToSparse(task_data->GetInput<ppc::core::CcsMatrix>(1).front());
+    return true;
+  }
   auto fmatrix_rows_count = static_cast<int>(task_data->inputs_count[0]);
   auto fmatrxix_columns_count = static_cast<int>(task_data->inputs_count[1]);
   auto smatrix_rows_count = static_cast<int>(task_data->inputs_count[2]);
@@ -31,6 +38,17 @@ bool sadikov_i_sparse_matrix_multiplication_task_omp::CCSMatrixOMP::PreProcessin
 }
 
 bool sadikov_i_sparse_matrix_multiplication_task_omp::CCSMatrixOMP::ValidationImpl() {
+  if (SparseInputs()) {
+    const auto &fmatrix = task_data->GetInput<ppc::core::CcsMatrix>(0).front();
+    const auto &smatrix = task_data->GetInput<ppc::core::CcsMatrix>(1).front();
+    if (!fmatrix.IsValid() || !smatrix.IsValid() || fmatrix.cols != smatrix.rows) {
+      return false;
+    }
+    // a dense output is filled only when the caller asks for one instead of a CcsMatrix
+    return task_data->HasOutput<ppc::core::CcsMatrix>(0) ||
+           (!task_data->outputs_count.empty() &&
+            static_cast<std::uint64_t>(task_data->outputs_count[0]) == fmatrix.rows * smatrix.cols);
+  }
   return task_data->inputs_count[0] == task_data->inputs_count[3] &&
          task_data->inputs_count[1] == task_data->inputs_count[2] &&
          task_data->inputs_count[0] * task_data->inputs_count[3] == task_data->outputs_count[0];
@@ -42,9 +60,17 @@ bool sadikov_i_sparse_matrix_multiplication_task_omp::CCSMatrixOMP::RunImpl() {
 }
 
 bool sadikov_i_sparse_matrix_multiplication_task_omp::CCSMatrixOMP::PostProcessingImpl() {
+  if (task_data->HasOutput<ppc::core::CcsMatrix>(0)) {
+    task_data->GetOutput<ppc::core::CcsMatrix>(0).front() = SparseToCcs(m_answerMatrix_);
+    return true;
+  }
   auto answer = FromSparseMatrix(m_answerMatrix_);
   for (size_t i = 0; i < answer.size(); ++i) {
     reinterpret_cast<double *>(task_data->outputs[0])[i] = answer[i];
   }
   return true;
 }
+
+bool sadikov_i_sparse_matrix_multiplication_task_omp::CCSMatrixOMP::SparseInputs() const {
+  return task_data->HasInput<ppc::core::CcsMatrix>(0) && task_data->HasInput<ppc::core::CcsMatrix>(1);
+}
@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "omp/borisov_s_strassen_omp/include/ops_omp.hpp"
+#include "seq/borisov_s_strassen_seq/func_tests/strassen_test_cases.hpp"
+
+namespace {
+
+using Task = borisov_s_strassen_omp::ParallelStrassenOmp;
+namespace cases = borisov_s_strassen_test;
+
+}  // namespace
+
+TEST(borisov_s_strassen_omp, OneByOne) { cases::ExpectProduct<Task>(1, 1, 1, {7.5}, {2.5}, {18.75}); }
+
+TEST(borisov_s_strassen_omp, TwoByTwo) {
+  cases::ExpectProduct<Task>(2, 2, 2, {1.0, 2.5, 3.0, 4.0}, {1.5, 2.0, 0.5, 3.5}, {2.75, 10.75, 6.5, 20.0});
+}
+
+TEST(borisov_s_strassen_omp, Rectangular2x3_3x4) {
+  const std::vector<double> a = {1.0, 2.5, 3.0, 4.0, 5.5, 6.0};
+  const std::vector<double> b = {0.5, 1.0, 2.0, 1.5, 2.0, 0.5, 1.0, 3.0, 4.0, 2.5, 0.5, 1.0};
+  cases::ExpectProduct<Task>(2, 3, 4, a, b, cases::MultiplyNaive(a, b, 2, 3, 4));
+}
+
+TEST(borisov_s_strassen_omp, Square5x5_Random) { cases::ExpectMatchesNaive<Task>(5, 5, 5); }
+
+TEST(borisov_s_strassen_omp, Square20x20_Random) { cases::ExpectMatchesNaive<Task>(20, 20, 20); }
+
+TEST(borisov_s_strassen_omp, Square32x32_Random) { cases::ExpectMatchesNaive<Task>(32, 32, 32); }
+
+TEST(borisov_s_strassen_omp, Square128x128_Random) { cases::ExpectMatchesNaive<Task>(128, 128, 128); }
+
+TEST(borisov_s_strassen_omp, Square128x128_IdentityMatrix) { cases::ExpectIdentityKeepsMatrix<Task>(128); }
+
+TEST(borisov_s_strassen_omp, Square129x129_Random) { cases::ExpectMatchesNaive<Task>(129, 129, 129); }
+
+TEST(borisov_s_strassen_omp, Square240x240_Random) { cases::ExpectMatchesNaive<Task>(240, 240, 240); }
+
+TEST(borisov_s_strassen_omp, Square600x600_Random) { cases::ExpectMatchesNaive<Task>(600, 600, 600); }
+
+TEST(borisov_s_strassen_omp, Rectangular16x17_Random) { cases::ExpectMatchesNaive<Task>(16, 17, 18); }
+
+TEST(borisov_s_strassen_omp, Rectangular19x23_Random) { cases::ExpectMatchesNaive<Task>(19, 23, 21); }
+
+TEST(borisov_s_strassen_omp, Rectangular32x64_Random) { cases::ExpectMatchesNaive<Task>(32, 64, 32); }
+
+TEST(borisov_s_strassen_omp, ValidCase) {
+  EXPECT_TRUE(cases::Validates<Task>({2, 3, 3, 2, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}, 2 + 4));
+}
+
+TEST(borisov_s_strassen_omp, MismatchCase) {
+  EXPECT_FALSE(cases::Validates<Task>({2, 2, 3, 3, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13}, 2 + 6));
+}
+
+TEST(borisov_s_strassen_omp, NotEnoughDataCase) {
+  EXPECT_FALSE(cases::Validates<Task>({2, 2, 2, 2, 1, 2, 3, 4, 5, 6}, 2 + 4));
+}
+
+TEST(borisov_s_strassen_omp, NotEnoughOutputCase) {
+  EXPECT_FALSE(cases::Validates<Task>({2, 2, 2, 2, 1, 2, 3, 4, 5, 6, 7, 8}, 2 + 3));
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "core/gemm/include/strassen.hpp"
+#include "core/task/include/task.hpp"
+
+namespace borisov_s_strassen_omp {
+
+class ParallelStrassenOmp : public ppc::core::Task {
+ public:
+  // cutoff - largest product dimension handed to Gemm without a Strassen level
+  explicit ParallelStrassenOmp(ppc::core::TaskDataPtr task_data, std::size_t cutoff = ppc::core::kStrassenDefaultCutoff)
+      : Task(std::move(task_data)), engine_(EngineConfig(cutoff)) {}
+
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+ private:
+  static ppc::core::StrassenConfig EngineConfig(std::size_t cutoff);
+
+  std::vector<double> input_;
+
+  std::vector<double> output_;
+
+  int rowsA_ = 0;
+  int colsA_ = 0;
+  int rowsB_ = 0;
+  int colsB_ = 0;
+
+  ppc::core::StrassenEngine<double> engine_;
+};
+
+}  // namespace borisov_s_strassen_omp
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+#include "omp/borisov_s_strassen_omp/include/ops_omp.hpp"
+
+namespace {
+
+void GenerateRandomMatrix(int rows, int cols, std::vector<double>& matrix) {
+  std::random_device rd;
+  std::mt19937 rng(rd());
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  matrix.resize(rows * cols);
+  for (auto& value : matrix) {
+    value = dist(rng);
+  }
+}
+
+}  // namespace
+
+TEST(borisov_s_strassen_perf_omp, test_pipeline_run) {
+  constexpr int kRowsA = 1024;
+  constexpr int kColsA = 1024;
+  constexpr int kRowsB = 1024;
+  constexpr int kColsB = 1024;
+
+  std::vector<double> a;
+  std::vector<double> b;
+  GenerateRandomMatrix(kRowsA, kColsA, a);
+  GenerateRandomMatrix(kRowsB, kColsB, b);
+
+  std::vector<double> in_data = {static_cast<double>(kRowsA), static_cast<double>(kColsA), static_cast<double>(kRowsB),
+                                 static_cast<double>(kColsB)};
+  in_data.insert(in_data.end(), a.begin(), a.end());
+  in_data.insert(in_data.end(), b.begin(), b.end());
+
+  size_t output_count = 2 + (kRowsA * kColsB);
+  std::vector<double> out(output_count, 0.0);
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t*>(in_data.data()));
+  task_data_omp->inputs_count.emplace_back(in_data.size());
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  task_data_omp->outputs_count.emplace_back(out.size());
+
+  auto test_task_omp = std::make_shared<borisov_s_strassen_omp::ParallelStrassenOmp>(task_data_omp);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 5;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_omp);
+  perf_analyzer->PipelineRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+}
+
+TEST(borisov_s_strassen_perf_omp, test_task_run) {
+  constexpr int kRowsA = 2048;
+  constexpr int kColsA = 2048;
+  constexpr int kRowsB = 2048;
+  constexpr int kColsB = 2048;
+
+  std::vector<double> a;
+  std::vector<double> b;
+  GenerateRandomMatrix(kRowsA, kColsA, a);
+  GenerateRandomMatrix(kRowsB, kColsB, b);
+
+  std::vector<double> in_data = {static_cast<double>(kRowsA), static_cast<double>(kColsA), static_cast<double>(kRowsB),
+                                 static_cast<double>(kColsB)};
+  in_data.insert(in_data.end(), a.begin(), a.end());
+  in_data.insert(in_data.end(), b.begin(), b.end());
+
+  size_t output_count = 2 + (kRowsA * kColsB);
+  std::vector<double> out(output_count, 0.0);
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t*>(in_data.data()));
+  task_data_omp->inputs_count.emplace_back(in_data.size());
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  task_data_omp->outputs_count.emplace_back(out.size());
+
+  auto test_task_omp = std::make_shared<borisov_s_strassen_omp::ParallelStrassenOmp>(task_data_omp);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 5;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_omp);
+  perf_analyzer->TaskRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+}
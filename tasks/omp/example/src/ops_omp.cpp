@@ -4,6 +4,8 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 bool nesterov_a_test_task_omp::TestTaskOpenMP::PreProcessingImpl() {
   // Init value for input and output
   unsigned int input_size = task_data->inputs_count[0];
@@ -28,14 +30,8 @@ bool nesterov_a_test_task_omp::TestTaskOpenMP::RunImpl() {
 #pragma omp critical
     {
       // Multiply matrices
-      for (int i = 0; i < rc_size_; ++i) {
-        for (int j = 0; j < rc_size_; ++j) {
-          output_[(i * rc_size_) + j] = 0;
-          for (int k = 0; k < rc_size_; ++k) {
-            output_[(i * rc_size_) + j] += input_[(i * rc_size_) + k] * input_[(k * rc_size_) + j];
-          }
-        }
-      }
+      const auto n = static_cast<std::size_t>(rc_size_);
+      ppc::core::Gemm<int>(n, n, n, 1, input_.data(), n, input_.data(), n, 0, output_.data(), n);
     }
   }
   return true;
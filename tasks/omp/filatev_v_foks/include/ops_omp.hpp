@@ -2,8 +2,8 @@
 
 #include <cstddef>
 #include <utility>
-#include <vector>
 
+#include "core/gemm/include/blocked_matrix.hpp"
 #include "core/task/include/task.hpp"
 
 namespace filatev_v_foks_omp {
@@ -33,11 +33,10 @@ class Focks : public ppc::core::Task {
   MatrixSize size_c_;
 
   size_t size_block_{};
-  size_t size_{};
 
-  std::vector<double> matrix_a_;
-  std::vector<double> matrix_b_;
-  std::vector<double> matrix_c_;
+  ppc::core::BlockedMatrix<double> matrix_a_;
+  ppc::core::BlockedMatrix<double> matrix_b_;
+  ppc::core::BlockedMatrix<double> matrix_c_;
 };
 
 }  // namespace filatev_v_foks_omp
\ No newline at end of file
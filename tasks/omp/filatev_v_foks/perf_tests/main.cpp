@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/perf/include/scaling.hpp"
 #include "core/task/include/task.hpp"
 #include "omp/filatev_v_foks/include/ops_omp.hpp"
 
@@ -37,6 +38,35 @@ std::vector<double> IdentityMatrix(size_t size) {
   return matrix;
 }
 
+// Task multiplying a random size x size matrix by the identity; the matrices live in storage
+std::shared_ptr<ppc::core::Task> MakeFocksTask(size_t size, size_t size_block,
+                                               std::vector<std::vector<double>> &storage) {
+  filatev_v_foks_omp::MatrixSize size_matrix(size, size);
+  storage.push_back(GeneratMatrix(size_matrix));
+  auto *matrix_a = storage.back().data();
+  storage.push_back(IdentityMatrix(size));
+  auto *matrix_b = storage.back().data();
+  storage.emplace_back(size * size, 0.0);
+  auto *matrix_c = storage.back().data();
+
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs_count.emplace_back(size);
+  task_data->inputs_count.emplace_back(size);
+  task_data->inputs_count.emplace_back(size);
+  task_data->inputs_count.emplace_back(size);
+  task_data->inputs_count.emplace_back(size_block);
+
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(matrix_a));
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(matrix_b));
+
+  task_data->outputs_count.emplace_back(size);
+  task_data->outputs_count.emplace_back(size);
+
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(matrix_c));
+
+  return std::make_shared<filatev_v_foks_omp::Focks>(task_data);
+}
+
 }  // namespace
 
 TEST(filatev_v_foks_omp, test_pipeline_run) {
@@ -142,3 +172,24 @@ TEST(filatev_v_foks_omp, test_task_run) {
 
   ASSERT_EQ(matrix_a, matrix_c);
 }
+
+TEST(filatev_v_foks_omp, test_strong_scaling) {
+  constexpr size_t kSizeBlock = 40;
+  std::vector<std::vector<double>> storage;
+
+  // Thread counts default to powers of two up to the core count
+  ppc::core::ScalingAttr scaling_attr;
+  scaling_attr.input_sizes = {480, 800};
+  scaling_attr.num_running = 3;
+  ppc::core::ScalingStudy study([&](uint64_t size) { return MakeFocksTask(size, kSizeBlock, storage); },
+                                scaling_attr);
+  auto curves = study.StrongScaling();
+  ppc::core::ScalingStudy::Print("filatev_v_foks_omp", curves);
+
+  for (const auto &curve : curves) {
+    ASSERT_FALSE(curve.points.empty());
+    EXPECT_GE(curve.saturation_threads, 1);
+  }
+  // The last task ran the full sweep, its product with the identity must be A
+  ASSERT_EQ(storage[storage.size() - 3], storage.back());
+}
@@ -1,9 +1,8 @@
 #include "omp/filatev_v_foks/include/ops_omp.hpp"
 
-#include <algorithm>
-#include <cmath>
 #include <cstddef>
-#include <vector>
+
+#include "core/gemm/include/gemm.hpp"
 
 bool filatev_v_foks_omp::Focks::PreProcessingImpl() {
   size_block_ = task_data->inputs_count[4];
@@ -15,24 +14,14 @@ bool filatev_v_foks_omp::Focks::PreProcessingImpl() {
   size_c_.n = task_data->outputs_count[0];
   size_c_.m = task_data->outputs_count[1];
 
-  size_ = std::max(size_a_.n, size_a_.m);
-  size_ = std::max(size_, size_b_.n);
-  size_ = std::max(size_, size_b_.m);
-
-  size_ = (size_ % size_block_ == 0) ? size_ : ((size_ % size_block_) + 1) * size_block_;
-
-  matrix_a_.assign(size_ * size_, 0);
-  matrix_b_.assign(size_ * size_, 0);
-
+  // Partial blocks at the edges are padded with zeros inside the tiles
   auto *temp_a = reinterpret_cast<double *>(task_data->inputs[0]);
   auto *temp_b = reinterpret_cast<double *>(task_data->inputs[1]);
-
-  for (size_t i = 0; i < size_a_.m; ++i) {
-    std::copy(temp_a + (i * size_a_.n), temp_a + ((i + 1) * size_a_.n), matrix_a_.data() + (i * size_));
-  }
-  for (size_t i = 0; i < size_b_.m; ++i) {
-    std::copy(temp_b + (i * size_b_.n), temp_b + ((i + 1) * size_b_.n), matrix_b_.data() + (i * size_));
-  }
+  matrix_a_.Resize(size_a_.m, size_a_.n, size_block_);
+  matrix_b_.Resize(size_b_.m, size_b_.n, size_block_);
+  matrix_a_.Load(temp_a, size_a_.n);
+  matrix_b_.Load(temp_b, size_b_.n);
+  matrix_c_.Resize(size_c_.m, size_c_.n, size_block_);
 
   return true;
 }
@@ -45,36 +34,24 @@ bool filatev_v_foks_omp::Focks::ValidationImpl() {
 }
 
 bool filatev_v_foks_omp::Focks::RunImpl() {
-  matrix_c_.assign(size_ * size_, 0);
-
-  int grid_size = (int)(size_ / size_block_);
-
-#pragma omp parallel for
-  for (int step_i_j = 0; step_i_j < grid_size * grid_size * grid_size; ++step_i_j) {
-    int step = step_i_j / (grid_size * grid_size);
-    int i = (step_i_j % (grid_size * grid_size)) / grid_size;
-    int j = step_i_j % grid_size;
-
-    size_t root = (i + step) % grid_size;
-    std::vector<double> local_block(size_block_ * size_block_, 0);
-
-    for (size_t bi = 0; bi < size_block_; ++bi) {
-      for (size_t bj = 0; bj < size_block_; ++bj) {
-        for (size_t bk = 0; bk < size_block_; ++bk) {
-          local_block[(bi * size_block_) + bj] +=
-              matrix_a_[((i * size_block_ + bi) * size_) + (root * size_block_) + bk] *
-              matrix_b_[((root * size_block_ + bk) * size_) + (j * size_block_) + bj];
-        }
-      }
-    }
-
-#pragma omp critical
-    {
-      for (size_t bi = 0; bi < size_block_; ++bi) {
-        for (size_t bj = 0; bj < size_block_; ++bj) {
-          matrix_c_[((i * size_block_ + bi) * size_) + (j * size_block_) + bj] += local_block[(bi * size_block_) + bj];
-        }
-      }
+  matrix_c_.Fill(0);
+
+  int grid_rows = static_cast<int>(matrix_c_.GridRows());
+  int grid_cols = static_cast<int>(matrix_c_.GridCols());
+  size_t steps = matrix_a_.GridCols();
+
+  // Owner computes: each output block belongs to one iteration, which runs all Fox steps for it
+  // in order, so no two threads ever write the same block of C
+#pragma omp parallel for schedule(static)
+  for (int block = 0; block < grid_rows * grid_cols; ++block) {
+    size_t i = block / grid_cols;
+    size_t j = block % grid_cols;
+    double *block_c = matrix_c_.Tile(i, j);
+
+    for (size_t step = 0; step < steps; ++step) {
+      size_t root = (i + step) % steps;
+      ppc::core::Gemm<double>(size_block_, size_block_, size_block_, 1.0, matrix_a_.Tile(i, root), size_block_,
+                              matrix_b_.Tile(root, j), size_block_, 1.0, block_c, size_block_);
     }
   }
 
@@ -82,9 +59,6 @@ bool filatev_v_foks_omp::Focks::RunImpl() {
 }
 
 bool filatev_v_foks_omp::Focks::PostProcessingImpl() {
-  auto *temp = reinterpret_cast<double *>(task_data->outputs[0]);
-  for (size_t i = 0; i < size_c_.m; ++i) {
-    std::copy(matrix_c_.data() + (i * size_), matrix_c_.data() + (i * size_) + size_c_.n, temp + (i * size_c_.n));
-  }
+  matrix_c_.Store(reinterpret_cast<double *>(task_data->outputs[0]), size_c_.n);
   return true;
 }
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "core/linalg/include/krylov_kernels.hpp"
+#include "core/linalg/include/linear_operator.hpp"
+#include "core/linalg/include/preconditioner.hpp"
+#include "core/task/include/task.hpp"
+#include "core/thread_pool/include/omp_chunk_runner.hpp"
+
+namespace karaseva_e_congrad_omp {
+
+// Inputs: A, b and optionally a ppc::core::PreconditionerKind. A is either n * n doubles in row-major
+// order or a typed ppc::core::CsrMatrix or ppc::core::StencilOperator input; b has n elements.
+// The variant picks classic or pipelined CG; both stop on the same residual norm
+class TestTaskOpenMP : public ppc::core::Task {
+ public:
+  explicit TestTaskOpenMP(ppc::core::TaskDataPtr task_data, ppc::core::CgVariant variant = ppc::core::kClassicCg)
+      : Task(std::move(task_data)), variant_(variant) {}
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  // Passes over A made by the last run
+  [[nodiscard]] size_t Iterations() const { return iterations_; }
+  // Kernel passes and reductions made by the last run; ILU(0) solves are not counted
+  [[nodiscard]] size_t SyncPoints() const { return kernels_.SyncPoints(); }
+  [[nodiscard]] size_t Reductions() const { return kernels_.Reductions(); }
+
+ private:
+  void RunClassic();
+  void RunPipelined();
+
+  ppc::core::MatrixOperator A_;  // Coefficient matrix, a view of the caller's input
+  std::vector<double> b_;  // Right-hand side vector
+  std::vector<double> x_;  // Solution vector
+  size_t size_{};
+  size_t iterations_{};
+  ppc::core::CgVariant variant_;
+
+  ppc::core::KrylovKernels kernels_{ppc::core::RunOmp};
+  ppc::core::Preconditioner preconditioner_;
+};
+
+}  // namespace karaseva_e_congrad_omp
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "core/linalg/include/krylov_kernels.hpp"
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+#include "omp/karaseva_e_congrad/include/ops_omp.hpp"
+
+namespace {
+
+constexpr size_t kSize = 4000;
+
+// Symmetric matrix with entries in [-1, 1] plus kSize on the diagonal, so CG takes several passes over it
+std::vector<double> GenerateSPDMatrix(size_t matrix_size) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> a_matrix(matrix_size * matrix_size);
+  for (size_t i = 0; i < matrix_size; ++i) {
+    for (size_t j = i; j < matrix_size; ++j) {
+      a_matrix[(i * matrix_size) + j] = a_matrix[(j * matrix_size) + i] = dist(gen);
+    }
+    a_matrix[(i * matrix_size) + i] += static_cast<double>(matrix_size);
+  }
+  return a_matrix;
+}
+
+std::shared_ptr<ppc::core::TaskData> MakeTaskData(std::vector<double>& a, std::vector<double>& b,
+                                                  std::vector<double>& x) {
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t*>(a.data()));
+  task_data_omp->inputs_count.emplace_back(a.size());
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+  task_data_omp->inputs_count.emplace_back(b.size());
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t*>(x.data()));
+  task_data_omp->outputs_count.emplace_back(x.size());
+  return task_data_omp;
+}
+
+std::shared_ptr<ppc::core::PerfAttr> MakePerfAttr() {
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [t0]() {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+  return perf_attr;
+}
+
+void ExpectSolved(const std::vector<double>& a, const std::vector<double>& b, const std::vector<double>& x) {
+  for (size_t i = 0; i < kSize; ++i) {
+    double sum = 0.0;
+    for (size_t j = 0; j < kSize; ++j) {
+      sum += a[(i * kSize) + j] * x[j];
+    }
+    ASSERT_NEAR(sum, b[i], 1e-8) << "row " << i;
+  }
+}
+
+// Each pass reads A once and sweeps about a dozen vectors
+void PrintBandwidth(const std::string& run, size_t passes, double seconds) {
+  const double bytes =
+      static_cast<double>(passes) * sizeof(double) * ((static_cast<double>(kSize) * kSize) + (12.0 * kSize));
+  std::cout << "karaseva_e_congrad_omp:" << run << ":bandwidth: passes=" << passes
+            << " gb_per_sec=" << bytes / seconds * 1e-9 << '\n';
+}
+
+// Barriers of the OpenMP team and reductions per pass over A
+void PrintSyncPoints(const std::string& run, const karaseva_e_congrad_omp::TestTaskOpenMP& task) {
+  const auto passes = static_cast<double>(task.Iterations());
+  std::cout << "karaseva_e_congrad_omp:" << run
+            << ":sync: points_per_iteration=" << static_cast<double>(task.SyncPoints()) / passes
+            << " reductions_per_iteration=" << static_cast<double>(task.Reductions()) / passes << '\n';
+}
+
+}  // namespace
+
+TEST(karaseva_e_congrad_omp, test_pipeline_run) {
+  auto a = GenerateSPDMatrix(kSize);
+  std::vector<double> b(kSize, 1.0);
+  std::vector<double> x(kSize, 0.0);
+
+  auto test_task_omp = std::make_shared<karaseva_e_congrad_omp::TestTaskOpenMP>(MakeTaskData(a, b, x));
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_omp);
+  perf_analyzer->PipelineRun(MakePerfAttr(), perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  ExpectSolved(a, b, x);
+}
+
+TEST(karaseva_e_congrad_omp, test_task_run) {
+  auto a = GenerateSPDMatrix(kSize);
+  std::vector<double> b(kSize, 1.0);
+  std::vector<double> x(kSize, 0.0);
+
+  auto test_task_omp = std::make_shared<karaseva_e_congrad_omp::TestTaskOpenMP>(MakeTaskData(a, b, x));
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_omp);
+  perf_analyzer->TaskRun(MakePerfAttr(), perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  PrintBandwidth("task_run", test_task_omp->Iterations(), perf_results->median_sec);
+  PrintSyncPoints("task_run", *test_task_omp);
+
+  ExpectSolved(a, b, x);
+}
+
+TEST(karaseva_e_congrad_omp, test_task_run_pipelined) {
+  auto a = GenerateSPDMatrix(kSize);
+  std::vector<double> b(kSize, 1.0);
+  std::vector<double> x(kSize, 0.0);
+
+  auto test_task_omp =
+      std::make_shared<karaseva_e_congrad_omp::TestTaskOpenMP>(MakeTaskData(a, b, x), ppc::core::kPipelinedCg);
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_omp);
+  perf_analyzer->TaskRun(MakePerfAttr(), perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  PrintBandwidth("task_run_pipelined", test_task_omp->Iterations(), perf_results->median_sec);
+  PrintSyncPoints("task_run_pipelined", *test_task_omp);
+
+  ExpectSolved(a, b, x);
+  EXPECT_LE(test_task_omp->Reductions(), test_task_omp->Iterations());
+}
@@ -1,4 +1,5 @@
 #include <gtest/gtest.h>
+#include <omp.h>
 
 #include <algorithm>
 #include <cmath>
@@ -96,6 +97,39 @@ void CCSExpectEqual(const kondratev_ya_ccs_complex_multiplication_omp::CCSMatrix
   EXPECT_EQ(a.cols, b.cols);
 }
 
+// n x n matrix whose column j holds about heaviest / (j + 1) random rows, at least one, so the first columns
+// carry most of the entries
+kondratev_ya_ccs_complex_multiplication_omp::CCSMatrix PowerLawCCS(int n, int heaviest, uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> row(0, n - 1);
+  std::uniform_real_distribution<double> dist(-10.0, 10.0);
+  kondratev_ya_ccs_complex_multiplication_omp::CCSMatrix matrix({n, n});
+  std::vector<int> picked;
+  for (int col = 0; col < n; col++) {
+    picked.resize(std::max(heaviest / (col + 1), 1));
+    std::ranges::generate(picked, [&] { return row(gen); });
+    std::ranges::sort(picked);
+    const auto repeated = std::ranges::unique(picked);
+    picked.erase(repeated.begin(), repeated.end());
+    for (int r : picked) {
+      matrix.row_index.emplace_back(r);
+      matrix.values.emplace_back(dist(gen), dist(gen));
+    }
+    matrix.col_ptrs[col + 1] = static_cast<int>(matrix.values.size());
+  }
+  return matrix;
+}
+
+std::vector<std::complex<double>> ToDense(const kondratev_ya_ccs_complex_multiplication_omp::CCSMatrix &matrix) {
+  std::vector<std::complex<double>> dense(static_cast<size_t>(matrix.rows) * matrix.cols);
+  for (int col = 0; col < matrix.cols; col++) {
+    for (int k = matrix.col_ptrs[col]; k < matrix.col_ptrs[col + 1]; k++) {
+      dense[(static_cast<size_t>(matrix.row_index[k]) * matrix.cols) + col] = matrix.values[k];
+    }
+  }
+  return dense;
+}
+
 struct Matrices {
   kondratev_ya_ccs_complex_multiplication_omp::CCSMatrix &in1;
   kondratev_ya_ccs_complex_multiplication_omp::CCSMatrix &in2;
@@ -294,3 +328,30 @@ TEST(kondratev_ya_ccs_complex_multiplication_omp, test_incompatible_matrix_sizes
   EXPECT_TRUE(task.ValidationImpl());
   EXPECT_FALSE(task.PreProcessingImpl());
 }
+
+TEST(kondratev_ya_ccs_complex_multiplication_omp, test_power_law_columns) {
+  constexpr int kN = 150;
+  auto a = PowerLawCCS(kN, kN, 1);
+  auto b = PowerLawCCS(kN, kN, 2);
+  auto expected = ConvertToCCS(ClassicMultiplyMatrices(ToDense(a), {kN, kN}, ToDense(b), {kN, kN}), {kN, kN});
+
+  kondratev_ya_ccs_complex_multiplication_omp::CCSMatrix c({kN, kN});
+  RunTest({.in1 = a, .in2 = b, .out = c});
+  CCSExpectEqual(c, expected);
+}
+
+TEST(kondratev_ya_ccs_complex_multiplication_omp, test_product_does_not_depend_on_thread_count) {
+  auto a = PowerLawCCS(3000, 3000, 3);
+  auto b = PowerLawCCS(3000, 3000, 4);
+  const int default_threads = omp_get_max_threads();
+  omp_set_num_threads(1);
+  const auto expected = a * b;
+  for (int threads : {2, 5, 16}) {
+    omp_set_num_threads(threads);
+    const auto c = a * b;
+    EXPECT_EQ(c.col_ptrs, expected.col_ptrs) << threads;
+    EXPECT_EQ(c.row_index, expected.row_index) << threads;
+    EXPECT_EQ(c.values, expected.values) << threads;
+  }
+  omp_set_num_threads(default_threads);
+}
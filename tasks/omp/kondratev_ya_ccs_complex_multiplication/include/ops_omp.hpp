@@ -22,6 +22,9 @@ struct CCSMatrix {
 
   CCSMatrix() : rows(0), cols(0) {}
   CCSMatrix(std::pair<int, int> sizes) : rows(sizes.first), cols(sizes.second) { col_ptrs.resize(cols + 1, 0); }
+  // Gustavson product through ppc::sparse: result columns are binned by their multiply-adds and the bins dealt
+  // dynamically over the OpenMP team, each column summed in a per-thread accumulator that only visits the rows it
+  // touched. Entries with |c| <= kEpsilon are left out
   CCSMatrix operator*(const CCSMatrix& other) const;
 };
 
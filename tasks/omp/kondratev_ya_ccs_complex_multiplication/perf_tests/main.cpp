@@ -1,12 +1,19 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
 #include <complex>
+#include <cstddef>
 #include <cstdint>
+#include <iostream>
 #include <memory>
+#include <random>
+#include <string>
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
+#include "core/sparse/include/sparse_kernels.hpp"
+#include "core/sparse/include/sparse_matrix.hpp"
 #include "core/task/include/task.hpp"
 #include "omp/kondratev_ya_ccs_complex_multiplication/include/ops_omp.hpp"
 
@@ -47,6 +54,144 @@ void CheckResult(kondratev_ya_ccs_complex_multiplication_omp::CCSMatrix &matrix,
   CheckRowIndices(matrix, count);
   CheckValues(matrix, count, value);
 }
+
+using kondratev_ya_ccs_complex_multiplication_omp::CCSMatrix;
+
+// Column j holds about kPowerLawSize / (j + 1) random rows, at least one: a few columns carry most entries
+constexpr int kPowerLawSize = 40000;
+// Column j holds rows j - kHalfBand .. j + kHalfBand
+constexpr int kBandedSize = 100000;
+constexpr int kHalfBand = 5;
+
+CCSMatrix PowerLawMatrix(uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> row(0, kPowerLawSize - 1);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  CCSMatrix matrix({kPowerLawSize, kPowerLawSize});
+  std::vector<int> picked;
+  for (int col = 0; col < kPowerLawSize; col++) {
+    picked.resize(std::max(kPowerLawSize / (col + 1), 1));
+    std::ranges::generate(picked, [&] { return row(gen); });
+    std::ranges::sort(picked);
+    const auto repeated = std::ranges::unique(picked);
+    picked.erase(repeated.begin(), repeated.end());
+    for (int r : picked) {
+      matrix.row_index.emplace_back(r);
+      matrix.values.emplace_back(dist(gen), dist(gen));
+    }
+    matrix.col_ptrs[col + 1] = static_cast<int>(matrix.values.size());
+  }
+  return matrix;
+}
+
+CCSMatrix BandedMatrix(uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  CCSMatrix matrix({kBandedSize, kBandedSize});
+  for (int col = 0; col < kBandedSize; col++) {
+    for (int r = std::max(col - kHalfBand, 0); r <= std::min(col + kHalfBand, kBandedSize - 1); r++) {
+      matrix.row_index.emplace_back(r);
+      matrix.values.emplace_back(dist(gen), dist(gen));
+    }
+    matrix.col_ptrs[col + 1] = static_cast<int>(matrix.values.size());
+  }
+  return matrix;
+}
+
+ppc::sparse::CompressedView<std::complex<double>, int> Columns(const CCSMatrix &matrix) {
+  return {.major = static_cast<std::size_t>(matrix.cols),
+          .minor = static_cast<std::size_t>(matrix.rows),
+          .ptr = matrix.col_ptrs.data(),
+          .idx = matrix.row_index.data(),
+          .values = matrix.values.data()};
+}
+
+std::vector<std::complex<double>> Multiply(const CCSMatrix &matrix, const std::vector<std::complex<double>> &x) {
+  std::vector<std::complex<double>> y(matrix.rows);
+  for (int col = 0; col < matrix.cols; col++) {
+    for (int k = matrix.col_ptrs[col]; k < matrix.col_ptrs[col + 1]; k++) {
+      y[matrix.row_index[k]] += matrix.values[k] * x[col];
+    }
+  }
+  return y;
+}
+
+// Heaviest share of the multiply-adds of kThreads threads over the mean share: for the equal runs of columns of a
+// static schedule over result columns, and for the flop-balanced bins dealt in order to the least loaded thread,
+// as a dynamic schedule does
+constexpr std::size_t kThreads = 8;
+
+void PrintBalance(const std::string &name, const CCSMatrix &a, const CCSMatrix &b, double seconds) {
+  const auto plan = ppc::sparse::PlanProduct(Columns(b), Columns(a));
+  const std::size_t columns = plan.flops.size();
+  std::vector<std::int64_t> static_load(kThreads, 0);
+  for (std::size_t t = 0; t < kThreads; t++) {
+    for (std::size_t j = columns * t / kThreads; j < columns * (t + 1) / kThreads; j++) {
+      static_load[t] += plan.flops[j];
+    }
+  }
+  const std::size_t bins = plan.bins.size() - 1;
+  std::vector<std::int64_t> binned_load(kThreads, 0);
+  for (std::size_t bin = 0; bin < bins; bin++) {
+    auto &least = *std::ranges::min_element(binned_load);
+    for (std::size_t j = plan.bins[bin]; j < plan.bins[bin + 1]; j++) {
+      least += plan.flops[j];
+    }
+  }
+  std::int64_t total = 0;
+  for (auto load : static_load) {
+    total += load;
+  }
+  const double mean = static_cast<double>(total) / kThreads;
+  std::cout << "kondratev_ya_ccs_complex_multiplication_omp:" << name << ": n=" << a.cols
+            << " nnz_a=" << a.values.size() << " flops=" << total << " bins=" << bins
+            << " static_imbalance=" << static_cast<double>(std::ranges::max(static_load)) / mean
+            << " binned_imbalance=" << static_cast<double>(std::ranges::max(binned_load)) / mean
+            << " threads=" << kThreads << " time_sec=" << seconds << '\n';
+}
+
+// A * B through the task, timed by Perf, checked as C x against A (B x)
+void RunProduct(const std::string &name, const CCSMatrix &a, const CCSMatrix &b) {
+  CCSMatrix in_a = a;
+  CCSMatrix in_b = b;
+  CCSMatrix c;
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(&in_a));
+  task_data_omp->inputs.emplace_back(reinterpret_cast<uint8_t *>(&in_b));
+  task_data_omp->inputs_count.emplace_back(2);
+  task_data_omp->outputs.emplace_back(reinterpret_cast<uint8_t *>(&c));
+  task_data_omp->outputs_count.emplace_back(1);
+  auto test_task_omp = std::make_shared<kondratev_ya_ccs_complex_multiplication_omp::TestTaskOMP>(task_data_omp);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 5;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_omp);
+  perf_analyzer->TaskRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  PrintBalance(name, a, b, perf_results->median_sec);
+
+  ASSERT_EQ(c.rows, a.rows);
+  ASSERT_EQ(c.cols, b.cols);
+  std::mt19937 gen(3);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<std::complex<double>> x(b.cols);
+  for (auto &value : x) {
+    value = {dist(gen), dist(gen)};
+  }
+  const auto expected = Multiply(a, Multiply(b, x));
+  const auto actual = Multiply(c, x);
+  for (size_t i = 0; i < actual.size(); ++i) {
+    ASSERT_LT(std::abs(actual[i] - expected[i]), 1e-8 * (1.0 + std::abs(expected[i]))) << "row " << i;
+  }
+}
+
 }  // namespace
 
 TEST(kondratev_ya_ccs_complex_multiplication_omp, test_pipeline_run) {
@@ -125,3 +270,11 @@ TEST(kondratev_ya_ccs_complex_multiplication_omp, test_task_run) {
 
   CheckResult(c, kCount, {4.0, 7.0});
 }
+
+TEST(kondratev_ya_ccs_complex_multiplication_omp, test_task_run_power_law) {
+  RunProduct("power_law", PowerLawMatrix(1), PowerLawMatrix(2));
+}
+
+TEST(kondratev_ya_ccs_complex_multiplication_omp, test_task_run_banded) {
+  RunProduct("banded", BandedMatrix(1), BandedMatrix(2));
+}
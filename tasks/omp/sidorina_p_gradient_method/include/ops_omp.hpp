@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "core/linalg/include/krylov_kernels.hpp"
+#include "core/task/include/task.hpp"
+#include "core/thread_pool/include/omp_chunk_runner.hpp"
+
+namespace sidorina_p_gradient_method_omp {
+
+// Conjugate gradients from the given starting solution; iterations receives the number of passes over a
+inline std::vector<double> ConjugateGradientMethod(ppc::core::KrylovKernels& kernels, const std::vector<double>& a,
+                                                   const std::vector<double>& b, std::vector<double> solution,
+                                                   double tolerance, int size, int& iterations) {
+  const auto n = static_cast<std::size_t>(size);
+  iterations = 0;
+
+  // residual = b - a * solution
+  std::vector<double> residual = b;
+  kernels.Gemv(n, n, -1.0, a.data(), n, solution.data(), 1.0, residual.data());
+  ++iterations;
+
+  double residual_norm_squared = kernels.Dot(n, residual.data(), residual.data());
+  if (std::sqrt(residual_norm_squared) < tolerance) {
+    return solution;
+  }
+  std::vector<double> direction = residual;
+  std::vector<double> matrix_times_direction(n);
+  while (std::sqrt(residual_norm_squared) > tolerance) {
+    double direction_dot_matrix_times_direction =
+        kernels.GemvDot(n, a.data(), n, direction.data(), matrix_times_direction.data());
+    ++iterations;
+    double alpha = residual_norm_squared / direction_dot_matrix_times_direction;
+    double new_residual_norm_squared = kernels.CgUpdate(n, alpha, direction.data(), matrix_times_direction.data(),
+                                                        solution.data(), residual.data());
+    double beta = new_residual_norm_squared / residual_norm_squared;
+    residual_norm_squared = new_residual_norm_squared;
+    kernels.Xpby(n, residual.data(), beta, direction.data());
+  }
+  return solution;
+}
+
+inline bool Cholesky(const std::vector<double>& matrix, int w, int h, double tolerance = 1e-5) {
+  if (w != h) {
+    return false;
+  }
+
+  int n = w;
+
+  for (int i = 0; i < n; i++) {
+    for (int j = i + 1; j < n; j++) {
+      if (std::abs(matrix[(i * n) + j] - matrix[(j * n) + i]) > tolerance) {
+        return false;
+      }
+    }
+  }
+
+  std::vector<double> lower_triangular(n * n, 0.0);
+
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j <= i; j++) {
+      double sum = 0.0;
+      for (int k = 0; k < j; k++) {
+        sum += lower_triangular[(i * n) + k] * lower_triangular[(j * n) + k];
+      }
+
+      if (i == j) {
+        double diag_val = matrix[(i * n) + i] - sum;
+        if (diag_val <= tolerance) {
+          return false;
+        }
+        lower_triangular[(i * n) + i] = std::sqrt(diag_val);
+      } else {
+        lower_triangular[(i * n) + j] = (1.0 / lower_triangular[(j * n) + j]) * (matrix[(i * n) + j] - sum);
+      }
+    }
+  }
+
+  return true;
+}
+
+class GradientMethod : public ppc::core::Task {
+ public:
+  explicit GradientMethod(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  [[nodiscard]] int Iterations() const { return iterations_; }
+
+ private:
+  int size_;
+  double tolerance_;
+  std::vector<double> a_;
+  std::vector<double> b_;
+  std::vector<double> solution_;
+  std::vector<double> result_;
+  int iterations_{0};
+
+  ppc::core::KrylovKernels kernels_{ppc::core::RunOmp};
+};
+
+}  // namespace sidorina_p_gradient_method_omp
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <cmath>
+#include <cstddef>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "core/gemm/include/blocked_matrix.hpp"
 #include "core/task/include/task.hpp"
 
 namespace vavilov_v_cannon_omp {
@@ -21,9 +23,12 @@ class CannonOMP : public ppc::core::Task {
   int N_;
   int block_size_;
   int num_blocks_;
-  std::vector<double> A_;
-  std::vector<double> B_;
-  std::vector<double> C_;
+  ppc::core::BlockedMatrix<double> A_;
+  ppc::core::BlockedMatrix<double> B_;
+  ppc::core::BlockedMatrix<double> C_;
+  // Cannon shift count; block (bi, bj) multiplies A tile (bi, k) by B tile (k, bj) with
+  // k = (bi + bj + shift_) % num_blocks_, so shifting never moves data
+  int shift_ = 0;
 
   void InitialShift();
   void BlockMultiply();
@@ -1,8 +1,8 @@
 #include "omp/vavilov_v_cannon/include/ops_omp.hpp"
 
-#include <algorithm>
 #include <cmath>
-#include <vector>
+
+#include "core/gemm/include/gemm.hpp"
 
 bool vavilov_v_cannon_omp::CannonOMP::PreProcessingImpl() {
   N_ = static_cast<int>(std::sqrt(task_data->inputs_count[0]));
@@ -11,9 +11,14 @@ bool vavilov_v_cannon_omp::CannonOMP::PreProcessingImpl() {
 
   auto* a = reinterpret_cast<double*>(task_data->inputs[0]);
   auto* b = reinterpret_cast<double*>(task_data->inputs[1]);
-  A_.assign(a, a + (N_ * N_));
-  B_.assign(b, b + (N_ * N_));
-  C_.assign(N_ * N_, 0);
+  A_.Resize(N_, N_, block_size_);
+  B_.Resize(N_, N_, block_size_);
+  C_.Resize(N_, N_, block_size_);
+#pragma omp parallel for
+  for (int bi = 0; bi < num_blocks_; ++bi) {
+    A_.LoadBlockRow(bi, a, N_);
+    B_.LoadBlockRow(bi, b, N_);
+  }
 
   return true;
 }
@@ -30,68 +35,28 @@ bool vavilov_v_cannon_omp::CannonOMP::ValidationImpl() {
 }
 
 void vavilov_v_cannon_omp::CannonOMP::InitialShift() {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
-
-#pragma omp parallel for
-  for (int bi = 0; bi < num_blocks_; ++bi) {
-    for (int bj = 0; bj < num_blocks_; ++bj) {
-      int src_row = (bi + bj) % num_blocks_;
-      int src_col = (bj + bi) % num_blocks_;
-      for (int i = 0; i < block_size_; ++i) {
-        for (int j = 0; j < block_size_; ++j) {
-          B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-          A_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-        }
-      }
-    }
-  }
+  // The skew of A by block row and of B by block column is part of the tile index
+  shift_ = 0;
 }
+
 void vavilov_v_cannon_omp::CannonOMP::BlockMultiply() {
 #pragma omp parallel for
   for (int bi = 0; bi < num_blocks_; ++bi) {
     for (int bj = 0; bj < num_blocks_; ++bj) {
-      for (int i = 0; i < block_size_; ++i) {
-        for (int j = 0; j < block_size_; ++j) {
-          double temp = 0.0;
-          for (int k = 0; k < block_size_; ++k) {
-            int row = (bi * block_size_) + i;
-            int col = (bj * block_size_) + j;
-            int k_idx = (bj * block_size_) + k;
-            int k_row = (bi * block_size_) + k;
-            temp += A_[(row * N_) + k_idx] * B_[(k_row * N_) + col];
-          }
-          C_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] += temp;
-        }
-      }
+      const int k = (bi + bj + shift_) % num_blocks_;
+      ppc::core::Gemm<double>(block_size_, block_size_, block_size_, 1.0, A_.Tile(bi, k), block_size_, B_.Tile(k, bj),
+                              block_size_, 1.0, C_.Tile(bi, bj), block_size_);
     }
   }
 }
 
 void vavilov_v_cannon_omp::CannonOMP::ShiftBlocks() {
-  std::vector<double> a_tmp = A_;
-  std::vector<double> b_tmp = B_;
-
-#pragma omp parallel for
-  for (int bi = 0; bi < num_blocks_; ++bi) {
-    for (int bj = 0; bj < num_blocks_; ++bj) {
-      int src_row = (bi + 1) % num_blocks_;
-      int src_col = (bj + 1) % num_blocks_;
-      for (int i = 0; i < block_size_; ++i) {
-        for (int j = 0; j < block_size_; ++j) {
-          B_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              b_tmp[(((src_row * block_size_) + i) * N_) + ((bj * block_size_) + j)];
-          A_[(((bi * block_size_) + i) * N_) + ((bj * block_size_) + j)] =
-              a_tmp[(((bi * block_size_) + i) * N_) + ((src_col * block_size_) + j)];
-        }
-      }
-    }
-  }
+  // A blocks move one position left and B blocks one position up
+  shift_ = (shift_ + 1) % num_blocks_;
 }
 
 bool vavilov_v_cannon_omp::CannonOMP::RunImpl() {
+  C_.Fill(0);
   InitialShift();
   for (int iter = 0; iter < num_blocks_; ++iter) {
     BlockMultiply();
@@ -101,6 +66,10 @@ bool vavilov_v_cannon_omp::CannonOMP::RunImpl() {
 }
 
 bool vavilov_v_cannon_omp::CannonOMP::PostProcessingImpl() {
-  std::ranges::copy(C_, reinterpret_cast<double*>(task_data->outputs[0]));
+  auto* c = reinterpret_cast<double*>(task_data->outputs[0]);
+#pragma omp parallel for
+  for (int bi = 0; bi < num_blocks_; ++bi) {
+    C_.StoreBlockRow(bi, c, N_);
+  }
   return true;
 }
@@ -0,0 +1,423 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/linalg/include/linear_operator.hpp"
+#include "core/linalg/include/preconditioner.hpp"
+#include "core/task/include/task.hpp"
+#include "omp/zolotareva_a_SLE_gradient_method/include/ops_omp.hpp"
+
+void zolotareva_a_sle_gradient_method_omp::GenerateSle(std::vector<double> &a, std::vector<double> &b, int n) {
+  std::random_device rd;
+  std::mt19937 gen(rd());
+  std::uniform_real_distribution<double> dist(-100.0, 100.0);
+
+  for (int i = 0; i < n; ++i) {
+    b[i] = dist(gen);
+    for (int j = i; j < n; ++j) {
+      double value = dist(gen);
+      a[(i * n) + j] = value;
+      a[(j * n) + i] = value;
+    }
+  }
+
+  for (int i = 0; i < n; ++i) {
+    a[(i * n) + i] += n * 100.0;
+  }
+}
+
+namespace {
+void Form(int n) {
+  std::vector<double> a(n * n);
+  std::vector<double> b(n);
+  std::vector<double> x(n);
+  zolotareva_a_sle_gradient_method_omp::GenerateSle(a, b, n);
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(a.data()));
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data_omp->inputs_count.push_back(n * n);
+  task_data_omp->inputs_count.push_back(n);
+  task_data_omp->outputs.push_back(reinterpret_cast<uint8_t *>(x.data()));
+  task_data_omp->outputs_count.push_back(x.size());
+
+  zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP task(task_data_omp);
+  ASSERT_EQ(task.ValidationImpl(), true);
+  task.PreProcessingImpl();
+  task.RunImpl();
+  task.PostProcessingImpl();
+
+  for (int i = 0; i < n; ++i) {
+    double sum = 0.0;
+    for (int j = 0; j < n; ++j) {
+      sum += a[(i * n) + j] * x[j];
+    }
+    EXPECT_NEAR(sum, b[i], 1e-4);
+  }
+}
+
+// Уравнение Пуассона на сетке nx*ny в виде CSR-матрицы; возвращает число проходов по матрице
+int SolvePoisson(std::size_t nx, std::size_t ny, ppc::core::PreconditionerKind kind) {
+  auto a = ppc::core::CsrMatrix::Laplacian2D(nx, ny);
+  std::vector<double> b(a.Size(), 1.0);
+  std::vector<double> x(a.Size());
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->AddInput(&a, 1);
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data_omp->inputs_count.push_back(b.size());
+  task_data_omp->AddInput(&kind, 1);
+  task_data_omp->outputs.push_back(reinterpret_cast<uint8_t *>(x.data()));
+  task_data_omp->outputs_count.push_back(x.size());
+
+  zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP task(task_data_omp);
+  EXPECT_EQ(task.ValidationImpl(), true);
+  task.PreProcessingImpl();
+  task.RunImpl();
+  task.PostProcessingImpl();
+
+  std::vector<double> ax(a.Size());
+  ppc::core::MatrixOperator::Csr(a).ApplyRows(0, a.Size(), x.data(), ax.data());
+  for (std::size_t i = 0; i < a.Size(); ++i) {
+    EXPECT_NEAR(ax[i], b[i], 1e-5);
+  }
+  return task.Iterations();
+}
+
+// Случайные правые части, столбец zero_column - нулевой
+std::vector<double> RandomRhs(std::size_t n, std::size_t k, std::size_t zero_column) {
+  std::mt19937 gen(static_cast<uint32_t>(n + k));
+  std::uniform_real_distribution<double> dist(-100.0, 100.0);
+  std::vector<double> b(n * k);
+  for (std::size_t i = 0; i < b.size(); ++i) {
+    b[i] = i / n == zero_column ? 0.0 : dist(gen);
+  }
+  return b;
+}
+
+// Решает систему с матрицей из входа 0 для всех правых частей b; возвращает число проходов по матрице
+int SolveAll(const std::shared_ptr<ppc::core::TaskData> &task_data_omp, std::vector<double> &b, std::vector<double> &x,
+             ppc::core::PreconditionerKind kind = ppc::core::kNoPreconditioner) {
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data_omp->inputs_count.push_back(b.size());
+  task_data_omp->AddInput(&kind, 1);
+  task_data_omp->outputs.push_back(reinterpret_cast<uint8_t *>(x.data()));
+  task_data_omp->outputs_count.push_back(x.size());
+
+  zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP task(task_data_omp);
+  EXPECT_EQ(task.ValidationImpl(), true);
+  task.PreProcessingImpl();
+  task.RunImpl();
+  task.PostProcessingImpl();
+  return task.Iterations();
+}
+
+// a * x_j = b_j для всех k правых частей
+void ExpectSolved(const ppc::core::MatrixOperator &a, const std::vector<double> &b, const std::vector<double> &x,
+                  double tolerance) {
+  const std::size_t n = a.Size();
+  std::vector<double> ax(n);
+  for (std::size_t j = 0; j < b.size() / n; ++j) {
+    a.ApplyRows(0, n, x.data() + (j * n), ax.data());
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_NEAR(ax[i], b[(j * n) + i], tolerance) << "row " << i << ", rhs " << j;
+    }
+  }
+}
+}  // namespace
+
+TEST(zolotareva_a_sle_gradient_method_omp, invalid_input_sizes) {
+  int n = 2;
+  std::vector<double> a = {2, -1, -1, 2};
+  std::vector<double> b = {1, 3, 4};  // Неправильный размер b
+  std::vector<double> x(n);
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(a.data()));
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data_omp->inputs_count.push_back(n * n);
+  task_data_omp->inputs_count.push_back(b.size());
+  task_data_omp->outputs.push_back(reinterpret_cast<uint8_t *>(x.data()));
+  task_data_omp->outputs_count.push_back(n);
+
+  zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP task(task_data_omp);
+  ASSERT_FALSE(task.ValidationImpl());
+}
+
+TEST(zolotareva_a_sle_gradient_method_omp, non_symmetric_matrix) {
+  int n = 2;
+  std::vector<double> a = {2, -1, 0, 2};  // a[0][1] != a[1][0]
+  std::vector<double> b = {1, 3};
+  std::vector<double> x(n);
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(a.data()));
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data_omp->inputs_count.push_back(n * n);
+  task_data_omp->inputs_count.push_back(n);
+  task_data_omp->outputs.push_back(reinterpret_cast<uint8_t *>(x.data()));
+  task_data_omp->outputs_count.push_back(n);
+
+  zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP task(task_data_omp);
+  ASSERT_EQ(task.ValidationImpl(), false);
+}
+
+TEST(zolotareva_a_sle_gradient_method_omp, not_positive_definite_matrix) {
+  int n = 2;
+  std::vector<double> a = {0, 0, 0, 0};
+  std::vector<double> b = {0, 0};
+  std::vector<double> x(n);
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(a.data()));
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data_omp->inputs_count.push_back(n * n);
+  task_data_omp->inputs_count.push_back(n);
+  task_data_omp->outputs.push_back(reinterpret_cast<uint8_t *>(x.data()));
+  task_data_omp->outputs_count.push_back(n);
+
+  zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP task(task_data_omp);
+  ASSERT_EQ(task.ValidationImpl(), false);
+}
+
+TEST(zolotareva_a_sle_gradient_method_omp, negative_definite_matrix) {
+  int n = 2;
+  std::vector<double> a = {-1, 0, 0, -2};
+  std::vector<double> b = {1, 1};
+  std::vector<double> x(n);
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(a.data()));
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data_omp->inputs_count.push_back(n * n);
+  task_data_omp->inputs_count.push_back(n);
+  task_data_omp->outputs.push_back(reinterpret_cast<uint8_t *>(x.data()));
+  task_data_omp->outputs_count.push_back(n);
+
+  zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP task(task_data_omp);
+  ASSERT_EQ(task.ValidationImpl(), false);
+}
+
+TEST(zolotareva_a_sle_gradient_method_omp, zero_dimension) {
+  std::vector<double> a;
+  std::vector<double> b;
+  std::vector<double> x;
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs_count.push_back(0);
+  task_data_omp->inputs_count.push_back(0);
+  task_data_omp->outputs_count.push_back(0);
+
+  zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP task(task_data_omp);
+  ASSERT_EQ(task.ValidationImpl(), false);
+}
+
+TEST(zolotareva_a_sle_gradient_method_omp, singular_matrix) {
+  int n = 2;
+  std::vector<double> a = {1, 1, 1, 1};  // Сингулярная матрица
+  std::vector<double> b = {2, 2};
+  std::vector<double> x(n);
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(a.data()));
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data_omp->inputs_count.push_back(n * n);
+  task_data_omp->inputs_count.push_back(n);
+  task_data_omp->outputs.push_back(reinterpret_cast<uint8_t *>(x.data()));
+  task_data_omp->outputs_count.push_back(n);
+
+  zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP task(task_data_omp);
+  ASSERT_EQ(task.ValidationImpl(), false);
+}
+
+TEST(zolotareva_a_sle_gradient_method_omp, zero_vector_solution) {
+  int n = 2;
+  std::vector<double> a = {1, 0, 0, 1};
+  std::vector<double> b = {0, 0};
+  std::vector<double> x(n);
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(a.data()));
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data_omp->inputs_count.push_back(n * n);
+  task_data_omp->inputs_count.push_back(n);
+  task_data_omp->outputs.push_back(reinterpret_cast<uint8_t *>(x.data()));
+  task_data_omp->outputs_count.push_back(n);
+
+  zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP task(task_data_omp);
+  ASSERT_EQ(task.ValidationImpl(), true);
+  task.PreProcessingImpl();
+  task.RunImpl();
+  task.PostProcessingImpl();
+
+  for (int i = 0; i < n; ++i) {
+    EXPECT_NEAR(x[i], 0.0, 1e-2);  // Ожидаем нулевой вектор решения
+  }
+}
+
+TEST(zolotareva_a_sle_gradient_method_omp, n_equals_one) {
+  int n = 1;
+  std::vector<double> a = {2};
+  std::vector<double> b = {4};
+  std::vector<double> x(n);
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(a.data()));
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data_omp->inputs_count.push_back(n * n);
+  task_data_omp->inputs_count.push_back(n);
+  task_data_omp->outputs.push_back(reinterpret_cast<uint8_t *>(x.data()));
+  task_data_omp->outputs_count.push_back(n);
+
+  zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP task(task_data_omp);
+  ASSERT_EQ(task.ValidationImpl(), true);
+  task.PreProcessingImpl();
+  task.RunImpl();
+  task.PostProcessingImpl();
+
+  EXPECT_NEAR(x[0], 2.0, 1e-1);  // Ожидаемое решение x = 2
+}
+
+TEST(zolotareva_a_sle_gradient_method_omp, test_correct_answer1) {
+  int n = 3;
+  std::vector<double> a = {4, -1, 2, -1, 6, -2, 2, -2, 5};
+  std::vector<double> b = {-1, 9, -10};
+  std::vector<double> x;
+  x.resize(n);
+  std::vector<double> ref_x = {1, 1, -2};
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(a.data()));
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data_omp->inputs_count.push_back(n * n);
+  task_data_omp->inputs_count.push_back(n);
+  task_data_omp->outputs.push_back(reinterpret_cast<uint8_t *>(x.data()));
+  task_data_omp->outputs_count.push_back(x.size());
+
+  zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP task(task_data_omp);
+  ASSERT_EQ(task.ValidationImpl(), true);
+  task.PreProcessingImpl();
+  task.RunImpl();
+  task.PostProcessingImpl();
+  for (int i = 0; i < n; ++i) {
+    EXPECT_NEAR(x[i], ref_x[i], 1e-12);
+  }
+}
+TEST(zolotareva_a_sle_gradient_method_omp, Test_Image_random_n_3) { Form(3); };
+TEST(zolotareva_a_sle_gradient_method_omp, Test_Image_random_n_5) { Form(5); };
+TEST(zolotareva_a_sle_gradient_method_omp, Test_Image_random_n_7) { Form(7); };
+TEST(zolotareva_a_sle_gradient_method_omp, Test_Image_random_n_20) { Form(591); };
+
+TEST(zolotareva_a_sle_gradient_method_omp, csr_poisson_system) {
+  SolvePoisson(50, 40, ppc::core::kNoPreconditioner);
+}
+
+TEST(zolotareva_a_sle_gradient_method_omp, preconditioners_on_poisson) {
+  const int plain = SolvePoisson(60, 60, ppc::core::kNoPreconditioner);
+  // у лапласиана постоянная диагональ, поэтому Якоби лишь масштабирует итерацию
+  EXPECT_LE(SolvePoisson(60, 60, ppc::core::kJacobiPreconditioner), plain + 1);
+  EXPECT_LT(SolvePoisson(60, 60, ppc::core::kIlu0Preconditioner), plain);
+}
+
+TEST(zolotareva_a_sle_gradient_method_omp, non_symmetric_csr_matrix) {
+  auto a = ppc::core::CsrMatrix::Laplacian2D(3, 3);
+  a.values[1] = -2.0;
+  std::vector<double> b(a.Size(), 1.0);
+  std::vector<double> x(a.Size());
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->AddInput(&a, 1);
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data_omp->inputs_count.push_back(b.size());
+  task_data_omp->outputs.push_back(reinterpret_cast<uint8_t *>(x.data()));
+  task_data_omp->outputs_count.push_back(x.size());
+
+  zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP task(task_data_omp);
+  ASSERT_EQ(task.ValidationImpl(), false);
+}
+
+TEST(zolotareva_a_sle_gradient_method_omp, batched_dense_matches_separate_solves) {
+  const std::size_t n = 60;
+  const std::size_t k = 6;
+  std::vector<double> a(n * n);
+  std::vector<double> b0(n);
+  zolotareva_a_sle_gradient_method_omp::GenerateSle(a, b0, static_cast<int>(n));
+  auto b = RandomRhs(n, k, 2);
+  std::vector<double> x(n * k);
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(a.data()));
+  task_data_omp->inputs_count.push_back(a.size());
+  const int batched = SolveAll(task_data_omp, b, x);
+  ExpectSolved(ppc::core::MatrixOperator::Dense(a.data(), n), b, x, 1e-4);
+
+  int longest = 0;
+  int total = 0;
+  for (std::size_t j = 0; j < k; ++j) {
+    std::vector<double> b_j(b.begin() + static_cast<std::ptrdiff_t>(j * n),
+                            b.begin() + static_cast<std::ptrdiff_t>((j + 1) * n));
+    std::vector<double> x_j(n);
+    auto task_data_j = std::make_shared<ppc::core::TaskData>();
+    task_data_j->inputs.push_back(reinterpret_cast<uint8_t *>(a.data()));
+    task_data_j->inputs_count.push_back(a.size());
+    const int passes = SolveAll(task_data_j, b_j, x_j);
+    longest = std::max(longest, passes);
+    total += passes;
+    for (std::size_t i = 0; i < n; ++i) {
+      EXPECT_NEAR(x[(j * n) + i], x_j[i], 1e-12) << "row " << i << ", rhs " << j;
+    }
+  }
+  // блок проходит по матрице столько раз, сколько нужно самой медленной системе
+  EXPECT_LE(batched, longest + 1);
+  EXPECT_LT(batched, total);
+}
+
+TEST(zolotareva_a_sle_gradient_method_omp, batched_csr_with_preconditioners) {
+  const auto a = ppc::core::CsrMatrix::Laplacian2D(15, 12);
+  for (auto kind : {ppc::core::kNoPreconditioner, ppc::core::kJacobiPreconditioner, ppc::core::kIlu0Preconditioner}) {
+    auto b = RandomRhs(a.Size(), 3, 1);
+    std::vector<double> x(b.size(), 1.0);
+    auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+    task_data_omp->AddInput(&a, 1);
+    SolveAll(task_data_omp, b, x, kind);
+    ExpectSolved(ppc::core::MatrixOperator::Csr(a), b, x, 1e-4);
+    for (std::size_t i = 0; i < a.Size(); ++i) {
+      EXPECT_EQ(x[a.Size() + i], 0.0) << "kind " << kind;
+    }
+  }
+}
+
+TEST(zolotareva_a_sle_gradient_method_omp, batched_stencil_solves_one_by_one) {
+  const auto stencil = ppc::core::StencilOperator::Laplacian2D(9, 7);
+  auto b = RandomRhs(stencil.size, 4, 0);
+  std::vector<double> x(b.size());
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->AddInput(&stencil, 1);
+  const int passes = SolveAll(task_data_omp, b, x);
+  ExpectSolved(ppc::core::MatrixOperator::Stencil(stencil), b, x, 1e-4);
+  // по отдельному решению на правую часть, кроме нулевой
+  EXPECT_GE(passes, 3);
+}
+
+TEST(zolotareva_a_sle_gradient_method_omp, batched_output_size_mismatch) {
+  int n = 2;
+  std::vector<double> a = {2, -1, -1, 2};
+  std::vector<double> b = {1, 3, 4, 5};
+  std::vector<double> x(n);
+
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(a.data()));
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data_omp->inputs_count.push_back(n * n);
+  task_data_omp->inputs_count.push_back(b.size());
+  task_data_omp->outputs.push_back(reinterpret_cast<uint8_t *>(x.data()));
+  task_data_omp->outputs_count.push_back(x.size());
+
+  zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP task(task_data_omp);
+  ASSERT_FALSE(task.ValidationImpl());
+}
@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+#include "omp/zolotareva_a_SLE_gradient_method/include/ops_omp.hpp"
+
+void zolotareva_a_sle_gradient_method_omp::GenerateSle(std::vector<double> &a, std::vector<double> &b, int n) {
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(-10.0, 10.0);
+
+  for (int i = 0; i < n; ++i) {
+    b[i] = dist(gen);
+    for (int j = i; j < n; ++j) {
+      double value = dist(gen);
+      a[(i * n) + j] = value;
+      a[(j * n) + i] = value;
+    }
+  }
+
+  for (int i = 0; i < n; ++i) {
+    a[(i * n) + i] += n * 10.0;
+  }
+}
+
+namespace {
+
+// Validation runs a Cholesky factorization, so the pipeline test keeps the system smaller
+constexpr int kPipelineSize = 1000;
+constexpr int kTaskRunSize = 2000;
+// Batched run: kBatchRhs right-hand sides of one kBatchSize system
+constexpr int kBatchSize = 1000;
+constexpr int kBatchRhs = 16;
+
+// Right-hand side j > 0 is the first one rotated by j entries
+struct Sle {
+  explicit Sle(int size, int rhs = 1) : n(size), k(rhs), a(n * n), b(n * k), x(n * k) {
+    zolotareva_a_sle_gradient_method_omp::GenerateSle(a, b, n);
+    for (int j = 1; j < k; ++j) {
+      for (int i = 0; i < n; ++i) {
+        b[(j * n) + i] = b[(i + j) % n];
+      }
+    }
+  }
+
+  int n;
+  int k;
+  std::vector<double> a;
+  std::vector<double> b;
+  std::vector<double> x;
+};
+
+std::shared_ptr<zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP> MakeTask(Sle &sle) {
+  auto task_data_omp = std::make_shared<ppc::core::TaskData>();
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(sle.a.data()));
+  task_data_omp->inputs.push_back(reinterpret_cast<uint8_t *>(sle.b.data()));
+  task_data_omp->inputs_count.push_back(sle.n * sle.n);
+  task_data_omp->inputs_count.push_back(sle.b.size());
+  task_data_omp->outputs.push_back(reinterpret_cast<uint8_t *>(sle.x.data()));
+  task_data_omp->outputs_count.push_back(sle.x.size());
+  return std::make_shared<zolotareva_a_sle_gradient_method_omp::TestTaskOpenMP>(task_data_omp);
+}
+
+std::shared_ptr<ppc::core::PerfAttr> MakePerfAttr() {
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [t0] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+  return perf_attr;
+}
+
+void ExpectSolved(const Sle &sle) {
+  for (int rhs = 0; rhs < sle.k; ++rhs) {
+    const double *x = sle.x.data() + (rhs * sle.n);
+    for (int i = 0; i < sle.n; ++i) {
+      double sum = 0.0;
+      for (int j = 0; j < sle.n; ++j) {
+        sum += sle.a[(i * sle.n) + j] * x[j];
+      }
+      EXPECT_NEAR(sum, sle.b[(rhs * sle.n) + i], 1e-5) << "rhs " << rhs;
+    }
+  }
+}
+
+// Each pass reads a once and sweeps about a dozen vectors
+void PrintBandwidth(int n, int passes, double seconds) {
+  const double bytes = passes * sizeof(double) * ((static_cast<double>(n) * n) + (12.0 * n));
+  std::cout << "zolotareva_a_sle_gradient_method_omp:task_run:bandwidth: passes=" << passes
+            << " gb_per_sec=" << bytes / seconds * 1e-9 << '\n';
+}
+
+// Median task run time of the k right-hand sides in one task and of one task per right-hand side, both
+// divided by k
+void PrintBatch(int k, double batched_seconds, double separate_seconds) {
+  std::cout << "zolotareva_a_sle_gradient_method_omp:task_run_batched:batch: k=" << k
+            << " per_rhs_sec=" << batched_seconds / k << " separate_per_rhs_sec=" << separate_seconds / k
+            << " speedup=" << separate_seconds / batched_seconds << '\n';
+}
+
+}  // namespace
+
+TEST(zolotareva_a_sle_gradient_method_omp, test_pipeline_run) {
+  Sle sle(kPipelineSize);
+  auto test_task_omp = MakeTask(sle);
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_omp);
+  perf_analyzer->PipelineRun(MakePerfAttr(), perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  ExpectSolved(sle);
+}
+
+TEST(zolotareva_a_sle_gradient_method_omp, test_task_run) {
+  Sle sle(kTaskRunSize);
+  auto test_task_omp = MakeTask(sle);
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_omp);
+  perf_analyzer->TaskRun(MakePerfAttr(), perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  PrintBandwidth(sle.n, test_task_omp->Iterations(), perf_results->median_sec);
+
+  ExpectSolved(sle);
+}
+
+TEST(zolotareva_a_sle_gradient_method_omp, test_task_run_batched) {
+  Sle batch(kBatchSize, kBatchRhs);
+  auto test_task_omp = MakeTask(batch);
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_omp);
+  perf_analyzer->TaskRun(MakePerfAttr(), perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  // the same systems one task each, a read from memory once per right-hand side
+  Sle single(kBatchSize);
+  double separate_seconds = 0.0;
+  for (int j = 0; j < kBatchRhs; ++j) {
+    std::copy_n(batch.b.begin() + (j * kBatchSize), kBatchSize, single.b.begin());
+    auto single_results = std::make_shared<ppc::core::PerfResults>();
+    ppc::core::Perf(MakeTask(single)).TaskRun(MakePerfAttr(), single_results);
+    separate_seconds += single_results->median_sec;
+  }
+  PrintBatch(kBatchRhs, perf_results->median_sec, separate_seconds);
+
+  ExpectSolved(batch);
+}
@@ -12,6 +12,9 @@
 
 namespace {
 
+// Far below the default cutoff, so every test larger than 8 runs Strassen levels
+constexpr std::size_t kCutoff = 8;
+
 std::vector<double> MultiplyNaiveDouble(const std::vector<double>& a, const std::vector<double>& b, int rows_a,
                                         int cols_a, int cols_b) {
   std::vector<double> c(rows_a * cols_b, 0.0);
@@ -53,7 +56,7 @@ TEST(borisov_s_strassen_seq, OneByOne) {
   task_data->outputs.push_back(reinterpret_cast<uint8_t*>(out_ptr));
   task_data->outputs_count.push_back(output_count);
 
-  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data);
+  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data, kCutoff);
 
   task.PreProcessingImpl();
   EXPECT_TRUE(task.ValidationImpl());
@@ -86,7 +89,7 @@ TEST(borisov_s_strassen_seq, TwoByTwo) {
   task_data->outputs.push_back(reinterpret_cast<uint8_t*>(out_ptr));
   task_data->outputs_count.push_back(output_count);
 
-  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data);
+  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data, kCutoff);
 
   task.PreProcessingImpl();
   EXPECT_TRUE(task.ValidationImpl());
@@ -122,7 +125,7 @@ TEST(borisov_s_strassen_seq, Rectangular2x3_3x4) {
   task_data->outputs.push_back(reinterpret_cast<uint8_t*>(out_ptr));
   task_data->outputs_count.push_back(output_count);
 
-  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data);
+  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data, kCutoff);
 
   task.PreProcessingImpl();
   EXPECT_TRUE(task.ValidationImpl());
@@ -168,7 +171,7 @@ TEST(borisov_s_strassen_seq, Square5x5_Random) {
   task_data->outputs.push_back(reinterpret_cast<uint8_t*>(out_ptr));
   task_data->outputs_count.push_back(output_count);
 
-  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data);
+  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data, kCutoff);
 
   task.PreProcessingImpl();
   EXPECT_TRUE(task.ValidationImpl());
@@ -214,7 +217,7 @@ TEST(borisov_s_strassen_seq, Square20x20_Random) {
   task_data->outputs.push_back(reinterpret_cast<uint8_t*>(out_ptr));
   task_data->outputs_count.push_back(output_count);
 
-  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data);
+  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data, kCutoff);
 
   task.PreProcessingImpl();
   EXPECT_TRUE(task.ValidationImpl());
@@ -260,7 +263,7 @@ TEST(borisov_s_strassen_seq, Square32x32_Random) {
   task_data->outputs.push_back(reinterpret_cast<uint8_t*>(out_ptr));
   task_data->outputs_count.push_back(output_count);
 
-  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data);
+  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data, kCutoff);
 
   task.PreProcessingImpl();
   EXPECT_TRUE(task.ValidationImpl());
@@ -306,7 +309,7 @@ TEST(borisov_s_strassen_seq, Square128x128_Random) {
   task_data->outputs.push_back(reinterpret_cast<uint8_t*>(out_ptr));
   task_data->outputs_count.push_back(output_count);
 
-  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data);
+  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data, kCutoff);
 
   task.PreProcessingImpl();
   EXPECT_TRUE(task.ValidationImpl());
@@ -354,7 +357,7 @@ TEST(borisov_s_strassen_seq, Square128x128_IdentityMatrix) {
   task_data->outputs.push_back(reinterpret_cast<uint8_t*>(out_ptr));
   task_data->outputs_count.push_back(output_count);
 
-  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data);
+  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data, kCutoff);
 
   task.PreProcessingImpl();
   EXPECT_TRUE(task.ValidationImpl());
@@ -400,7 +403,7 @@ TEST(borisov_s_strassen_seq, Square129x129_Random) {
   task_data->outputs.push_back(reinterpret_cast<uint8_t*>(out_ptr));
   task_data->outputs_count.push_back(output_count);
 
-  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data);
+  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data, kCutoff);
 
   task.PreProcessingImpl();
   EXPECT_TRUE(task.ValidationImpl());
@@ -446,7 +449,7 @@ TEST(borisov_s_strassen_seq, Square240x240_Random) {
   task_data->outputs.push_back(reinterpret_cast<uint8_t*>(out_ptr));
   task_data->outputs_count.push_back(output_count);
 
-  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data);
+  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data, kCutoff);
 
   task.PreProcessingImpl();
   EXPECT_TRUE(task.ValidationImpl());
@@ -481,7 +484,7 @@ TEST(borisov_s_strassen_seq, ValidCase) {
   task_data->outputs.push_back(nullptr);
   task_data->outputs_count.push_back(0);
 
-  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data);
+  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data, kCutoff);
 
   task.PreProcessingImpl();
 
@@ -505,7 +508,7 @@ TEST(borisov_s_strassen_seq, MismatchCase) {
   task_data->outputs.push_back(nullptr);
   task_data->outputs_count.push_back(0);
 
-  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data);
+  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data, kCutoff);
 
   task.PreProcessingImpl();
   EXPECT_FALSE(task.ValidationImpl());
@@ -522,7 +525,7 @@ TEST(borisov_s_strassen_seq, NotEnoughDataCase) {
   task_data->outputs.push_back(nullptr);
   task_data->outputs_count.push_back(0);
 
-  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data);
+  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data, kCutoff);
 
   task.PreProcessingImpl();
 
@@ -554,7 +557,7 @@ TEST(borisov_s_strassen_seq, Rectangular16x17_Random) {
   task_data->outputs.push_back(reinterpret_cast<uint8_t*>(out_ptr));
   task_data->outputs_count.push_back(output_count);
 
-  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data);
+  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data, kCutoff);
 
   task.PreProcessingImpl();
   EXPECT_TRUE(task.ValidationImpl());
@@ -602,7 +605,7 @@ TEST(borisov_s_strassen_seq, Rectangular19x23_Random) {
   task_data->outputs.push_back(reinterpret_cast<uint8_t*>(out_ptr));
   task_data->outputs_count.push_back(output_count);
 
-  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data);
+  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data, kCutoff);
 
   task.PreProcessingImpl();
   EXPECT_TRUE(task.ValidationImpl());
@@ -650,7 +653,7 @@ TEST(borisov_s_strassen_seq, Rectangular32x64_Random) {
   task_data->outputs.push_back(reinterpret_cast<uint8_t*>(out_ptr));
   task_data->outputs_count.push_back(output_count);
 
-  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data);
+  borisov_s_strassen_seq::SequentialStrassenSeq task(task_data, kCutoff);
 
   task.PreProcessingImpl();
   EXPECT_TRUE(task.ValidationImpl());
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+// Fixtures shared by the func tests of the borisov_s_strassen tasks. Input layout is
+// {rows_a, cols_a, rows_b, cols_b, A..., B...}, output layout {rows_c, cols_c, C...}
+namespace borisov_s_strassen_test {
+
+// Far below the default cutoff, so every case larger than 8 runs Strassen levels
+constexpr std::size_t kCutoff = 8;
+
+inline std::vector<double> MultiplyNaive(const std::vector<double> &a, const std::vector<double> &b, int rows_a,
+                                         int cols_a, int cols_b) {
+  std::vector<double> c(static_cast<std::size_t>(rows_a) * cols_b, 0.0);
+  for (int i = 0; i < rows_a; ++i) {
+    for (int j = 0; j < cols_b; ++j) {
+      double sum = 0.0;
+      for (int k = 0; k < cols_a; ++k) {
+        sum += a[(i * cols_a) + k] * b[(k * cols_b) + j];
+      }
+      c[(i * cols_b) + j] = sum;
+    }
+  }
+  return c;
+}
+
+inline std::vector<double> GenerateRandomMatrix(int rows, int cols, int seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  std::vector<double> matrix(static_cast<std::size_t>(rows) * cols);
+  for (double &x : matrix) {
+    x = dist(rng);
+  }
+  return matrix;
+}
+
+inline std::vector<double> MakeInput(int rows_a, int cols_a, int rows_b, int cols_b, const std::vector<double> &a,
+                                     const std::vector<double> &b) {
+  std::vector<double> in = {static_cast<double>(rows_a), static_cast<double>(cols_a), static_cast<double>(rows_b),
+                            static_cast<double>(cols_b)};
+  in.insert(in.end(), a.begin(), a.end());
+  in.insert(in.end(), b.begin(), b.end());
+  return in;
+}
+
+inline ppc::core::TaskDataPtr MakeTaskData(std::vector<double> &in, std::vector<double> &out) {
+  auto task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  task_data->inputs_count.emplace_back(in.size());
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+  return task_data;
+}
+
+// Runs the task through its public stages and returns {rows_c, cols_c, C...}
+template <class Task>
+std::vector<double> Run(std::vector<double> in, std::size_t output_count) {
+  std::vector<double> out(output_count, -1.0);
+  Task task(MakeTaskData(in, out), kCutoff);
+  EXPECT_TRUE(task.Validation());
+  task.PreProcessing();
+  task.Run();
+  task.PostProcessing();
+  return out;
+}
+
+template <class Task>
+void ExpectProduct(int rows_a, int cols_a, int cols_b, const std::vector<double> &a, const std::vector<double> &b,
+                   const std::vector<double> &expected) {
+  const auto out = Run<Task>(MakeInput(rows_a, cols_a, cols_a, cols_b, a, b), 2 + expected.size());
+  ASSERT_EQ(out.size(), 2 + expected.size());
+  EXPECT_DOUBLE_EQ(out[0], rows_a);
+  EXPECT_DOUBLE_EQ(out[1], cols_b);
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_NEAR(out[2 + i], expected[i], 1e-9) << "at " << i;
+  }
+}
+
+template <class Task>
+void ExpectMatchesNaive(int rows_a, int cols_a, int cols_b) {
+  const auto a = GenerateRandomMatrix(rows_a, cols_a, 7777);
+  const auto b = GenerateRandomMatrix(cols_a, cols_b, 7777);
+  ExpectProduct<Task>(rows_a, cols_a, cols_b, a, b, MultiplyNaive(a, b, rows_a, cols_a, cols_b));
+}
+
+template <class Task>
+bool Validates(std::vector<double> in, std::size_t output_count) {
+  std::vector<double> out(output_count);
+  Task task(MakeTaskData(in, out), kCutoff);
+  return task.Validation();
+}
+
+template <class Task>
+void ExpectIdentityKeepsMatrix(int n) {
+  const auto a = GenerateRandomMatrix(n, n, 7777);
+  std::vector<double> e(static_cast<std::size_t>(n) * n, 0.0);
+  for (int i = 0; i < n; ++i) {
+    e[(i * n) + i] = 1.0;
+  }
+  ExpectProduct<Task>(n, n, n, a, e, a);
+}
+
+}  // namespace borisov_s_strassen_test
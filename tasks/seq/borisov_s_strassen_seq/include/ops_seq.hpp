@@ -1,15 +1,20 @@
 #pragma once
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
+#include "core/gemm/include/strassen.hpp"
 #include "core/task/include/task.hpp"
 
 namespace borisov_s_strassen_seq {
 
 class SequentialStrassenSeq : public ppc::core::Task {
  public:
-  explicit SequentialStrassenSeq(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  // cutoff - largest product dimension handed to Gemm without a Strassen level
+  explicit SequentialStrassenSeq(ppc::core::TaskDataPtr task_data,
+                                 std::size_t cutoff = ppc::core::kStrassenDefaultCutoff)
+      : Task(std::move(task_data)), engine_(ppc::core::StrassenConfigWithCutoff(cutoff)) {}
 
   bool PreProcessingImpl() override;
   bool ValidationImpl() override;
@@ -25,6 +30,8 @@ class SequentialStrassenSeq : public ppc::core::Task {
   int colsA_ = 0;
   int rowsB_ = 0;
   int colsB_ = 0;
+
+  ppc::core::StrassenEngine<double> engine_;
 };
 
 }  // namespace borisov_s_strassen_seq
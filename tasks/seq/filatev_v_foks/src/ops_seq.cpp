@@ -5,6 +5,8 @@
 #include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 bool filatev_v_foks_seq::Focks::PreProcessingImpl() {
   size_block_ = task_data->inputs_count[4];
   size_a_.n = task_data->inputs_count[0];
@@ -53,15 +55,10 @@ bool filatev_v_foks_seq::Focks::RunImpl() {
     for (size_t i = 0; i < grid_size; ++i) {
       for (size_t j = 0; j < grid_size; ++j) {
         size_t root = (i + step) % grid_size;
-        for (size_t bi = 0; bi < size_block_; ++bi) {
-          for (size_t bj = 0; bj < size_block_; ++bj) {
-            for (size_t bk = 0; bk < size_block_; ++bk) {
-              matrix_c_[((i * size_block_ + bi) * size_) + (j * size_block_) + bj] +=
-                  matrix_a_[((i * size_block_ + bi) * size_) + (root * size_block_) + bk] *
-                  matrix_b_[((root * size_block_ + bk) * size_) + (j * size_block_) + bj];
-            }
-          }
-        }
+        ppc::core::Gemm<double>(size_block_, size_block_, size_block_, 1.0,
+                                matrix_a_.data() + (i * size_block_ * size_) + (root * size_block_), size_,
+                                matrix_b_.data() + (root * size_block_ * size_) + (j * size_block_), size_, 1.0,
+                                matrix_c_.data() + (i * size_block_ * size_) + (j * size_block_), size_);
       }
     }
   }
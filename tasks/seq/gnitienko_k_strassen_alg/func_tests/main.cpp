@@ -11,6 +11,8 @@
 #include "seq/gnitienko_k_strassen_alg/include/ops_seq.hpp"
 
 namespace {
+// Far below the default cutoff, so every test larger than 8 runs Strassen levels
+constexpr std::size_t kCutoff = 8;
 double min_val = -100.0;
 double max_val = 100.0;
 static std::vector<double> GenMatrix(size_t size);
@@ -69,7 +71,7 @@ TEST(gnitienko_k_strassen_alg_seq, test_2x2_matrix) {
   task_data_seq->outputs_count.emplace_back(out.size());
 
   // Create Task
-  gnitienko_k_strassen_algorithm::StrassenAlgSeq test_task_sequential(task_data_seq);
+  gnitienko_k_strassen_algorithm::StrassenAlgSeq test_task_sequential(task_data_seq, kCutoff);
   ASSERT_EQ(test_task_sequential.Validation(), true);
   test_task_sequential.PreProcessing();
   test_task_sequential.Run();
@@ -97,7 +99,7 @@ TEST(gnitienko_k_strassen_alg_seq, test_4x4_matrix) {
   task_data_seq->outputs_count.emplace_back(out.size());
 
   // Create Task
-  gnitienko_k_strassen_algorithm::StrassenAlgSeq test_task_sequential(task_data_seq);
+  gnitienko_k_strassen_algorithm::StrassenAlgSeq test_task_sequential(task_data_seq, kCutoff);
   ASSERT_EQ(test_task_sequential.Validation(), true);
   test_task_sequential.PreProcessing();
   test_task_sequential.Run();
@@ -125,7 +127,7 @@ TEST(gnitienko_k_strassen_alg_seq, test_random_16x16) {
   task_data_seq->outputs_count.emplace_back(out.size());
 
   // Create Task
-  gnitienko_k_strassen_algorithm::StrassenAlgSeq test_task_sequential(task_data_seq);
+  gnitienko_k_strassen_algorithm::StrassenAlgSeq test_task_sequential(task_data_seq, kCutoff);
   ASSERT_EQ(test_task_sequential.Validation(), true);
   test_task_sequential.PreProcessing();
   test_task_sequential.Run();
@@ -153,7 +155,7 @@ TEST(gnitienko_k_strassen_alg_seq, test_random_64x64) {
   task_data_seq->outputs_count.emplace_back(out.size());
 
   // Create Task
-  gnitienko_k_strassen_algorithm::StrassenAlgSeq test_task_sequential(task_data_seq);
+  gnitienko_k_strassen_algorithm::StrassenAlgSeq test_task_sequential(task_data_seq, kCutoff);
   ASSERT_EQ(test_task_sequential.Validation(), true);
   test_task_sequential.PreProcessing();
   test_task_sequential.Run();
@@ -181,7 +183,7 @@ TEST(gnitienko_k_strassen_alg_seq, test_non_squad_7x7) {
   task_data_seq->outputs_count.emplace_back(out.size());
 
   // Create Task
-  gnitienko_k_strassen_algorithm::StrassenAlgSeq test_task_sequential(task_data_seq);
+  gnitienko_k_strassen_algorithm::StrassenAlgSeq test_task_sequential(task_data_seq, kCutoff);
   ASSERT_EQ(test_task_sequential.Validation(), true);
   test_task_sequential.PreProcessing();
   test_task_sequential.Run();
@@ -207,7 +209,7 @@ TEST(gnitienko_k_strassen_alg_seq, test_empty) {
   task_data_seq->outputs_count.emplace_back(out.size());
 
   // Create Task
-  gnitienko_k_strassen_algorithm::StrassenAlgSeq test_task_sequential(task_data_seq);
+  gnitienko_k_strassen_algorithm::StrassenAlgSeq test_task_sequential(task_data_seq, kCutoff);
   ASSERT_EQ(test_task_sequential.Validation(), true);
   test_task_sequential.PreProcessing();
   test_task_sequential.Run();
@@ -231,7 +233,7 @@ TEST(gnitienko_k_strassen_alg_seq, test_single_element) {
   task_data_seq->outputs_count.emplace_back(out.size());
 
   // Create Task
-  gnitienko_k_strassen_algorithm::StrassenAlgSeq test_task_sequential(task_data_seq);
+  gnitienko_k_strassen_algorithm::StrassenAlgSeq test_task_sequential(task_data_seq, kCutoff);
   ASSERT_EQ(test_task_sequential.Validation(), true);
   test_task_sequential.PreProcessing();
   test_task_sequential.Run();
@@ -256,7 +258,7 @@ TEST(gnitienko_k_strassen_alg_seq, test_IxA) {
   task_data_seq->outputs_count.emplace_back(out.size());
 
   // Create Task
-  gnitienko_k_strassen_algorithm::StrassenAlgSeq test_task_sequential(task_data_seq);
+  gnitienko_k_strassen_algorithm::StrassenAlgSeq test_task_sequential(task_data_seq, kCutoff);
   ASSERT_EQ(test_task_sequential.Validation(), true);
   test_task_sequential.PreProcessing();
   test_task_sequential.Run();
@@ -283,7 +285,7 @@ TEST(gnitienko_k_strassen_alg_seq, test_IxA_large) {
   task_data_seq->outputs_count.emplace_back(out.size());
 
   // Create Task
-  gnitienko_k_strassen_algorithm::StrassenAlgSeq test_task_sequential(task_data_seq);
+  gnitienko_k_strassen_algorithm::StrassenAlgSeq test_task_sequential(task_data_seq, kCutoff);
   ASSERT_EQ(test_task_sequential.Validation(), true);
   test_task_sequential.PreProcessing();
   test_task_sequential.Run();
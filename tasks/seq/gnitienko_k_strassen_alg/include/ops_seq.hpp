@@ -1,15 +1,19 @@
 #pragma once
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
+#include "core/gemm/include/strassen.hpp"
 #include "core/task/include/task.hpp"
 
 namespace gnitienko_k_strassen_algorithm {
 
 class StrassenAlgSeq : public ppc::core::Task {
  public:
-  explicit StrassenAlgSeq(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  // cutoff - largest product dimension handed to Gemm without a Strassen level
+  explicit StrassenAlgSeq(ppc::core::TaskDataPtr task_data, std::size_t cutoff = ppc::core::kStrassenDefaultCutoff)
+      : Task(std::move(task_data)), engine_(ppc::core::StrassenConfigWithCutoff(cutoff)) {}
   bool PreProcessingImpl() override;
   bool ValidationImpl() override;
   bool RunImpl() override;
@@ -20,14 +24,8 @@ class StrassenAlgSeq : public ppc::core::Task {
   std::vector<double> input_2_;
   std::vector<double> output_;
   int size_{};
-  int TRIVIAL_MULTIPLICATION_BOUND_ = 32;
-  int extend_ = 0;
 
-  static void TrivialMultiply(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c,
-                              int size);
-  void StrassenMultiply(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c, int size);
-  static void AddMatrix(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c, int size);
-  static void SubMatrix(const std::vector<double>& a, const std::vector<double>& b, std::vector<double>& c, int size);
+  ppc::core::StrassenEngine<double> engine_;
 };
 
 }  // namespace gnitienko_k_strassen_algorithm
\ No newline at end of file
@@ -2,8 +2,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 bool gromov_a_fox_algorithm_seq::TestTaskSequential::PreProcessingImpl() {
   unsigned int input_size = task_data->inputs_count[0];
   if (input_size % 2 != 0) {
@@ -47,20 +50,13 @@ bool gromov_a_fox_algorithm_seq::TestTaskSequential::ValidationImpl() {
 bool gromov_a_fox_algorithm_seq::TestTaskSequential::RunImpl() {
   int num_blocks = (n_ + block_size_ - 1) / block_size_;  // Ceiling division to ensure all indices are covered
 
+  const auto n = static_cast<std::size_t>(n_);
   for (int stage = 0; stage < num_blocks; ++stage) {
-    for (int i = 0; i < n_; i += block_size_) {
-      for (int j = 0; j < n_; j += block_size_) {
-        for (int bi = i; bi < i + block_size_ && bi < n_; ++bi) {
-          for (int bj = j; bj < j + block_size_ && bj < n_; ++bj) {
-            // Ensure the bk range covers all indices up to n_
-            int start_k = stage * block_size_;
-            for (int bk = start_k; bk < std::min((stage + 1) * block_size_, n_); ++bk) {
-              output_[(bi * n_) + bj] += A_[(bi * n_) + bk] * B_[(bk * n_) + bj];
-            }
-          }
-        }
-      }
-    }
+    // All blocks of a stage take the same slice of the inner dimension, one product covers them
+    const int start_k = stage * block_size_;
+    const int end_k = std::min((stage + 1) * block_size_, n_);
+    ppc::core::Gemm<double>(n, n, end_k - start_k, 1.0, A_.data() + start_k, n, B_.data() + (start_k * n), n, 1.0,
+                            output_.data(), n);
   }
   return true;
 }
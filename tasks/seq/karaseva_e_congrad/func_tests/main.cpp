@@ -6,6 +6,8 @@
 #include <random>
 #include <vector>
 
+#include "core/linalg/include/linear_operator.hpp"
+#include "core/linalg/include/preconditioner.hpp"
 #include "core/task/include/task.hpp"
 #include "seq/karaseva_e_congrad/include/ops_seq.hpp"
 
@@ -48,6 +50,46 @@ std::vector<double> MultiplyMatrixVector(const std::vector<double>& a_matrix, co
   return result;
 }
 
+struct Solution {
+  std::vector<double> x;
+  size_t passes;
+  size_t sync_points;
+  size_t reductions;
+};
+
+// Solves A x = 1 with A added as input 0 by the caller
+Solution SolveOnes(const std::shared_ptr<ppc::core::TaskData>& task_data_seq, size_t n,
+                   ppc::core::PreconditionerKind* kind = nullptr,
+                   ppc::core::CgVariant variant = ppc::core::kClassicCg) {
+  std::vector<double> b(n, 1.0);
+  std::vector<double> x(n, 0.0);
+  task_data_seq->inputs.push_back(reinterpret_cast<uint8_t*>(b.data()));
+  task_data_seq->inputs_count.push_back(n);
+  if (kind != nullptr) {
+    task_data_seq->AddInput(kind, 1);
+  }
+  task_data_seq->outputs.push_back(reinterpret_cast<uint8_t*>(x.data()));
+  task_data_seq->outputs_count.push_back(n);
+
+  karaseva_e_congrad_seq::TestTaskSequential test_task(task_data_seq, variant);
+  EXPECT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+  return {.x = x,
+          .passes = test_task.Iterations(),
+          .sync_points = test_task.SyncPoints(),
+          .reductions = test_task.Reductions()};
+}
+
+void ExpectSolvesOnes(const ppc::core::CsrMatrix& a, const std::vector<double>& x) {
+  std::vector<double> ax(a.Size());
+  ppc::core::MatrixOperator::Csr(a).ApplyRows(0, a.Size(), x.data(), ax.data());
+  for (size_t i = 0; i < a.Size(); ++i) {
+    EXPECT_NEAR(ax[i], 1.0, 1e-7) << "row " << i;
+  }
+}
+
 }  // namespace
 
 TEST(karaseva_e_congrad_seq, test_identity_50) {
@@ -222,4 +264,175 @@ TEST(karaseva_e_congrad_seq, test_diagonal_matrix_100) {
   for (size_t i = 0; i < kN; ++i) {
     EXPECT_NEAR(x[i], 1.0, 1e-9);
   }
-}
\ No newline at end of file
+}
+
+TEST(karaseva_e_congrad_seq, test_csr_poisson_matches_dense) {
+  auto a = ppc::core::CsrMatrix::Laplacian2D(12, 9);
+  std::vector<double> a_dense(a.Size() * a.Size(), 0.0);
+  for (size_t i = 0; i < a.Size(); ++i) {
+    for (auto k = a.row_ptr[i]; k < a.row_ptr[i + 1]; ++k) {
+      a_dense[(i * a.Size()) + a.col_idx[k]] = a.values[k];
+    }
+  }
+
+  auto task_data_csr = std::make_shared<ppc::core::TaskData>();
+  task_data_csr->AddInput(&a, 1);
+  const auto csr = SolveOnes(task_data_csr, a.Size());
+
+  auto task_data_dense = std::make_shared<ppc::core::TaskData>();
+  task_data_dense->inputs.push_back(reinterpret_cast<uint8_t*>(a_dense.data()));
+  task_data_dense->inputs_count.push_back(a_dense.size());
+  const auto dense = SolveOnes(task_data_dense, a.Size());
+
+  ExpectSolvesOnes(a, csr.x);
+  EXPECT_EQ(csr.passes, dense.passes);
+  for (size_t i = 0; i < a.Size(); ++i) {
+    EXPECT_NEAR(csr.x[i], dense.x[i], 1e-10);
+  }
+}
+
+TEST(karaseva_e_congrad_seq, test_stencil_operator) {
+  constexpr size_t kNx = 30;
+  constexpr size_t kNy = 20;
+  auto stencil = ppc::core::StencilOperator::Laplacian2D(kNx, kNy);
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->AddInput(&stencil, 1);
+  const auto solution = SolveOnes(task_data_seq, stencil.size);
+
+  ExpectSolvesOnes(ppc::core::CsrMatrix::Laplacian2D(kNx, kNy), solution.x);
+}
+
+TEST(karaseva_e_congrad_seq, test_preconditioners_on_poisson) {
+  auto a = ppc::core::CsrMatrix::Laplacian2D(40, 40);
+  std::vector<size_t> passes;
+  for (auto kind : {ppc::core::kNoPreconditioner, ppc::core::kJacobiPreconditioner, ppc::core::kIlu0Preconditioner}) {
+    auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+    task_data_seq->AddInput(&a, 1);
+    const auto solution = SolveOnes(task_data_seq, a.Size(), &kind);
+    ExpectSolvesOnes(a, solution.x);
+    passes.push_back(solution.passes);
+  }
+  // The Laplacian has a constant diagonal, so Jacobi only rescales the iteration
+  EXPECT_LE(passes[1], passes[0] + 1);
+  EXPECT_LT(passes[2], passes[0]);
+}
+
+TEST(karaseva_e_congrad_seq, test_validation_ilu0_needs_csr) {
+  constexpr size_t kN = 4;
+  std::vector<double> a_matrix(kN * kN, 0.0);
+  for (size_t i = 0; i < kN; ++i) {
+    a_matrix[(i * kN) + i] = 2.0;
+  }
+  std::vector<double> b(kN, 1.0);
+  std::vector<double> x(kN, 0.0);
+  auto kind = ppc::core::kIlu0Preconditioner;
+
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->inputs.push_back(reinterpret_cast<uint8_t*>(a_matrix.data()));
+  task_data_seq->inputs_count.push_back(kN * kN);
+  task_data_seq->inputs.push_back(reinterpret_cast<uint8_t*>(b.data()));
+  task_data_seq->inputs_count.push_back(kN);
+  task_data_seq->AddInput(&kind, 1);
+  task_data_seq->outputs.push_back(reinterpret_cast<uint8_t*>(x.data()));
+  task_data_seq->outputs_count.push_back(kN);
+
+  karaseva_e_congrad_seq::TestTaskSequential test_task(task_data_seq);
+  ASSERT_FALSE(test_task.Validation());
+}
+
+TEST(karaseva_e_congrad_seq, test_validation_ilu0_zero_pivot) {
+  // Symmetric with a positive diagonal, but the second ILU(0) pivot is 1 - 1 * 1 = 0
+  ppc::core::CsrMatrix a{{.rows = 2,
+                         .cols = 2,
+                         .row_ptr = {0, 2, 4},
+                         .col_idx = {0, 1, 0, 1},
+                         .values = {1.0, 1.0, 1.0, 1.0}}};
+  std::vector<double> b(a.Size(), 1.0);
+  std::vector<double> x(a.Size(), 0.0);
+  auto kind = ppc::core::kIlu0Preconditioner;
+
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->AddInput(&a, 1);
+  task_data_seq->inputs.push_back(reinterpret_cast<uint8_t*>(b.data()));
+  task_data_seq->inputs_count.push_back(a.Size());
+  task_data_seq->AddInput(&kind, 1);
+  task_data_seq->outputs.push_back(reinterpret_cast<uint8_t*>(x.data()));
+  task_data_seq->outputs_count.push_back(a.Size());
+
+  karaseva_e_congrad_seq::TestTaskSequential test_task(task_data_seq);
+  ASSERT_FALSE(test_task.Validation());
+}
+
+TEST(karaseva_e_congrad_seq, test_pipelined_matches_classic) {
+  auto a = ppc::core::CsrMatrix::Laplacian2D(30, 25);
+  for (auto kind : {ppc::core::kNoPreconditioner, ppc::core::kJacobiPreconditioner, ppc::core::kIlu0Preconditioner}) {
+    auto task_data_classic = std::make_shared<ppc::core::TaskData>();
+    task_data_classic->AddInput(&a, 1);
+    const auto classic = SolveOnes(task_data_classic, a.Size(), &kind);
+    auto task_data_pipelined = std::make_shared<ppc::core::TaskData>();
+    task_data_pipelined->AddInput(&a, 1);
+    const auto pipelined = SolveOnes(task_data_pipelined, a.Size(), &kind, ppc::core::kPipelinedCg);
+
+    ExpectSolvesOnes(a, pipelined.x);
+    for (size_t i = 0; i < a.Size(); ++i) {
+      EXPECT_NEAR(pipelined.x[i], classic.x[i], 1e-7) << "kind " << kind << ", row " << i;
+    }
+    // The pipelined loop also counts its first product with A
+    EXPECT_LE(pipelined.passes, classic.passes + 2) << "kind " << kind;
+    EXPECT_GE(pipelined.passes + 2, classic.passes) << "kind " << kind;
+  }
+}
+
+TEST(karaseva_e_congrad_seq, test_pipelined_has_one_reduction_per_iteration) {
+  auto a = ppc::core::CsrMatrix::Laplacian2D(20, 20);
+  for (auto kind : {ppc::core::kNoPreconditioner, ppc::core::kJacobiPreconditioner}) {
+    auto task_data_classic = std::make_shared<ppc::core::TaskData>();
+    task_data_classic->AddInput(&a, 1);
+    const auto classic = SolveOnes(task_data_classic, a.Size(), &kind);
+    auto task_data_pipelined = std::make_shared<ppc::core::TaskData>();
+    task_data_pipelined->AddInput(&a, 1);
+    const auto pipelined = SolveOnes(task_data_pipelined, a.Size(), &kind, ppc::core::kPipelinedCg);
+
+    // One fused reduction per product with A, against two or three for classic CG. The last product
+    // may go without its update when p^T * A * p underflows the guard
+    EXPECT_LE(pipelined.reductions, pipelined.passes) << "kind " << kind;
+    EXPECT_GE(classic.reductions + 1, 2 * classic.passes) << "kind " << kind;
+    // Two kernel passes per iteration, the product with A and the update sweep, against three or four
+    EXPECT_LE(pipelined.sync_points, (2 * pipelined.passes) + 1) << "kind " << kind;
+    EXPECT_GE(classic.sync_points + 1, 3 * classic.passes) << "kind " << kind;
+  }
+}
+
+TEST(karaseva_e_congrad_seq, test_pipelined_dense_and_zero_rhs) {
+  constexpr size_t kN = 20;
+  auto a_matrix = GenerateRandomSPDMatrix(kN, 7);
+  std::mt19937 gen(3);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> x_true(kN);
+  for (auto& value : x_true) {
+    value = dist(gen);
+  }
+
+  // b = 0 stops before the first iteration, b = A * x_true recovers x_true
+  for (const auto& expected : {std::vector<double>(kN, 0.0), x_true}) {
+    auto b = MultiplyMatrixVector(a_matrix, expected, kN);
+    std::vector<double> x(kN, 1.0);
+
+    auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+    task_data_seq->inputs.push_back(reinterpret_cast<uint8_t*>(a_matrix.data()));
+    task_data_seq->inputs_count.push_back(kN * kN);
+    task_data_seq->inputs.push_back(reinterpret_cast<uint8_t*>(b.data()));
+    task_data_seq->inputs_count.push_back(kN);
+    task_data_seq->outputs.push_back(reinterpret_cast<uint8_t*>(x.data()));
+    task_data_seq->outputs_count.push_back(kN);
+
+    karaseva_e_congrad_seq::TestTaskSequential test_task(task_data_seq, ppc::core::kPipelinedCg);
+    ASSERT_TRUE(test_task.Validation());
+    test_task.PreProcessing();
+    test_task.Run();
+    test_task.PostProcessing();
+    for (size_t i = 0; i < kN; ++i) {
+      EXPECT_NEAR(x[i], expected[i], 1e-6);
+    }
+  }
+}
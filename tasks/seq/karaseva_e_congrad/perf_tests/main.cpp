@@ -1,10 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <vector>
 
+#include "core/linalg/include/linear_operator.hpp"
+#include "core/linalg/include/preconditioner.hpp"
 #include "core/perf/include/perf.hpp"
 #include "core/task/include/task.hpp"
 #include "seq/karaseva_e_congrad/include/ops_seq.hpp"
@@ -97,4 +102,62 @@ TEST(karaseva_e_congrad_seq, test_task_run) {
   ppc::core::Perf::PrintPerfStatistic(perf_results);
 
   ASSERT_EQ(b, x);
-}
\ No newline at end of file
+}
+
+TEST(karaseva_e_congrad_seq, test_pipeline_run_csr_ilu0) {
+  // 10^6 unknowns: the 5-point Laplacian on a 1000 x 1000 grid shifted by the identity, as in an
+  // implicit time step, so ILU(0)-preconditioned CG converges in a few dozen iterations
+  auto a = ppc::core::CsrMatrix::Laplacian2D(1000, 1000);
+  for (std::size_t i = 0; i < a.Size(); i++) {
+    for (auto k = a.row_ptr[i]; k < a.row_ptr[i + 1]; k++) {
+      if (static_cast<std::size_t>(a.col_idx[k]) == i) {
+        a.values[k] += 1.0;
+      }
+    }
+  }
+  std::vector<double> b(a.Size(), 1.0);
+  std::vector<double> x(a.Size(), 0.0);
+  auto kind = ppc::core::kIlu0Preconditioner;
+
+  // Create task_data
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->AddInput(&a, 1);
+  task_data_seq->inputs.emplace_back(reinterpret_cast<uint8_t*>(b.data()));
+  task_data_seq->inputs_count.emplace_back(b.size());
+  task_data_seq->AddInput(&kind, 1);
+  task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t*>(x.data()));
+  task_data_seq->outputs_count.emplace_back(x.size());
+
+  // Create Task
+  auto test_task_sequential = std::make_shared<karaseva_e_congrad_seq::TestTaskSequential>(task_data_seq);
+
+  // Create Perf attributes; the memory profile shows the single ILU(0) factorization
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 3;
+  perf_attr->collect_memory = true;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [t0]() {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  // Initialize performance results
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Performance analyzer using PipelineRun
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_sequential);
+  perf_analyzer->PipelineRun(perf_attr, perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  // Residual of the returned solution
+  double residual = 0.0;
+  for (std::size_t i = 0; i < a.Size(); i++) {
+    double ax = 0.0;
+    for (auto k = a.row_ptr[i]; k < a.row_ptr[i + 1]; k++) {
+      ax += a.values[k] * x[a.col_idx[k]];
+    }
+    residual = std::max(residual, std::abs(ax - b[i]));
+  }
+  EXPECT_LT(residual, 1e-8);
+}
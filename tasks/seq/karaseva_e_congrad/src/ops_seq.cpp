@@ -7,87 +7,138 @@
 bool karaseva_e_congrad_seq::TestTaskSequential::PreProcessingImpl() {
   // Set the system size based on the length of vector b
   size_ = task_data->inputs_count[1];
-  auto* a_ptr = reinterpret_cast<double*>(task_data->inputs[0]);
   auto* b_ptr = reinterpret_cast<double*>(task_data->inputs[1]);
 
   // Initialize matrix A, vector b and initial guess x (all zeros)
-  A_ = std::vector<double>(a_ptr, a_ptr + (size_ * size_));
+  A_ = ppc::core::MatrixOperator::FromInput(*task_data, 0, size_);
   b_ = std::vector<double>(b_ptr, b_ptr + size_);
   x_ = std::vector<double>(size_, 0.0);  // Initial guess
+  preconditioner_.Setup(ppc::core::Preconditioner::KindFromInput(*task_data, 2), A_);
 
   return true;
 }
 
 bool karaseva_e_congrad_seq::TestTaskSequential::ValidationImpl() {
-  // Check that A is a square matrix (n*n), and b and x have n elements
-  const bool valid_input = task_data->inputs_count[0] == task_data->inputs_count[1] * task_data->inputs_count[1];
+  // Check that A is an n x n operator, and b and x have n elements
+  const auto a = ppc::core::MatrixOperator::FromInput(*task_data, 0, task_data->inputs_count[1]);
+  const bool valid_input =
+      !a.Empty() && preconditioner_.TrySetup(ppc::core::Preconditioner::KindFromInput(*task_data, 2), a);
   const bool valid_output = task_data->outputs_count[0] == task_data->inputs_count[1];
   return valid_input && valid_output;
 }
 
 bool karaseva_e_congrad_seq::TestTaskSequential::RunImpl() {
-  std::vector<double> r(size_);
-  std::vector<double> p(size_);
-  std::vector<double> ap(size_);
-
-  // Compute initial residual: r = b - A*x (x is initially zero)
-  for (size_t i = 0; i < size_; ++i) {
-    r[i] = b_[i];  // x is zero so A*x is zero
-    p[i] = r[i];
+  x_.assign(size_, 0.0);
+  iterations_ = 0;
+  kernels_.ResetCounters();
+  if (variant_ == ppc::core::kPipelinedCg) {
+    RunPipelined();
+  } else {
+    RunClassic();
   }
+  return true;
+}
 
-  double rs_old = 0.0;
-  for (size_t i = 0; i < size_; ++i) {
-    rs_old += r[i] * r[i];
-  }
+void karaseva_e_congrad_seq::TestTaskSequential::RunClassic() {
+  // Initial residual r = b - A*x is b because x starts at zero
+  std::vector<double> r = b_;
+  std::vector<double> ap(size_);
+
+  // Preconditioned residual z = M^-1 * r; without a preconditioner z is r itself
+  const bool preconditioned = preconditioner_.Active();
+  std::vector<double> z(preconditioned ? size_ : 0);
+  double rz_old = preconditioned ? preconditioner_.Apply(kernels_, r.data(), z.data())
+                                 : kernels_.Dot(size_, r.data(), r.data());
+  std::vector<double> p = preconditioned ? z : r;
 
   const double tolerance = 1e-10;
   const size_t max_iterations = size_;  // Maximum iterations to prevent infinite loops
 
   for (size_t k = 0; k < max_iterations; ++k) {
-    // Compute ap = A * p
-    for (size_t i = 0; i < size_; ++i) {
-      ap[i] = 0.0;
-      for (size_t j = 0; j < size_; ++j) {
-        ap[i] += A_[(i * size_) + j] * p[j];
-      }
-    }
-
-    // Compute alpha = rs_old / (p^T * ap)
-    double p_ap = 0.0;
-    for (size_t i = 0; i < size_; ++i) {
-      p_ap += p[i] * ap[i];
-    }
+    // ap = A * p together with p^T * ap
+    const double p_ap = kernels_.ApplyDot(A_, p.data(), ap.data());
+    ++iterations_;
     if (std::fabs(p_ap) < 1e-15) {
       break;  // Avoid division by zero
     }
-    const double alpha = rs_old / p_ap;
+    const double alpha = rz_old / p_ap;
 
-    // Update solution vector x and residual r
-    for (size_t i = 0; i < size_; ++i) {
-      x_[i] += alpha * p[i];
-      r[i] -= alpha * ap[i];
-    }
-
-    // Check convergence by computing the norm of the residual
-    double rs_new = 0.0;
-    for (size_t i = 0; i < size_; ++i) {
-      rs_new += r[i] * r[i];
-    }
+    // x += alpha * p and r -= alpha * ap, with the new residual norm from the same sweep
+    const double rs_new = kernels_.CgUpdate(size_, alpha, p.data(), ap.data(), x_.data(), r.data());
     if (rs_new < tolerance * tolerance) {  // Compare squared norm to avoid sqrt
       break;
     }
 
-    // Compute beta and update the search direction p
-    const double beta = rs_new / rs_old;
-    for (size_t i = 0; i < size_; ++i) {
-      p[i] = r[i] + beta * p[i];
+    // p = z + beta * p
+    const double rz_new = preconditioned ? preconditioner_.Apply(kernels_, r.data(), z.data()) : rs_new;
+    const double beta = rz_new / rz_old;
+    kernels_.Xpby(size_, preconditioned ? z.data() : r.data(), beta, p.data());
+
+    rz_old = rz_new;
+  }
+}
+
+void karaseva_e_congrad_seq::TestTaskSequential::RunPipelined() {
+  // Vectors of pipelined CG; u, m and q only exist with a preconditioner
+  const bool preconditioned = preconditioner_.Active();
+  std::vector<double> r = b_;
+  std::vector<double> w(size_);
+  std::vector<double> n(size_);
+  std::vector<double> p(size_, 0.0);
+  std::vector<double> s(size_, 0.0);
+  std::vector<double> z(size_, 0.0);
+  std::vector<double> u(preconditioned ? size_ : 0);
+  std::vector<double> m(preconditioned ? size_ : 0);
+  std::vector<double> q(preconditioned ? size_ : 0, 0.0);
+  ppc::core::PipelinedCgVectors v{
+      .x = x_.data(), .r = r.data(), .w = w.data(), .n = n.data(), .p = p.data(), .s = s.data(), .z = z.data()};
+  if (preconditioned) {
+    v.u = u.data();
+    v.m = m.data();
+    v.q = q.data();
+    // Jacobi is applied inside the update sweep, ILU(0) after it
+    if (preconditioner_.Kind() == ppc::core::kJacobiPreconditioner) {
+      v.inverse_diagonal = preconditioner_.InverseDiagonal().data();
     }
+  }
 
-    rs_old = rs_new;
+  // u = M^-1 * r, w = A * u and m = M^-1 * w for x = 0
+  if (preconditioned) {
+    preconditioner_.Solve(kernels_, r.data(), u.data());
   }
+  kernels_.Apply(A_, preconditioned ? u.data() : r.data(), w.data());
+  ++iterations_;
+  if (preconditioned) {
+    preconditioner_.Solve(kernels_, w.data(), m.data());
+  }
+  ppc::core::CgDots dots = kernels_.PipelinedCgDots(size_, v);
 
-  return true;
+  const double tolerance = 1e-10;
+  const size_t max_iterations = size_;  // Maximum iterations to prevent infinite loops
+  double alpha = 0.0;
+  double ru_old = 0.0;
+
+  // Same stopping rule as the classic loop: the squared norm of the updated residual
+  for (size_t k = 0; k < max_iterations && dots.rr >= tolerance * tolerance; ++k) {
+    // n = A * m only needs m, so it does not wait for the dots of this iteration
+    kernels_.Apply(A_, preconditioned ? m.data() : w.data(), n.data());
+    ++iterations_;
+
+    // p^T * A * p from the recurrences: w^T * u - beta * r^T * u / alpha
+    const double beta = k == 0 ? 0.0 : dots.ru / ru_old;
+    const double p_ap = k == 0 ? dots.wu : dots.wu - (beta * dots.ru / alpha);
+    if (std::fabs(p_ap) < 1e-15) {
+      break;  // Avoid division by zero
+    }
+    alpha = dots.ru / p_ap;
+    ru_old = dots.ru;
+
+    // All vector updates and the next r^T * u, w^T * u and r^T * r in one sweep
+    dots = kernels_.PipelinedCgUpdate(size_, alpha, beta, v);
+    if (preconditioned && v.inverse_diagonal == nullptr) {
+      preconditioner_.Solve(kernels_, w.data(), m.data());
+    }
+  }
 }
 
 bool karaseva_e_congrad_seq::TestTaskSequential::PostProcessingImpl() {
@@ -1,11 +1,46 @@
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <random>
 #include <vector>
 
+#include "core/linalg/include/spgemm.hpp"
 #include "core/task/include/task.hpp"
 #include "seq/konkov_i_sparse_matmul_ccs/include/ops_seq.hpp"
 
+namespace {
+
+// rows x cols row-major matrix with about a fifth of the entries nonzero
+std::vector<double> RandomDense(size_t rows, size_t cols, uint32_t seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> value(-10.0, 10.0);
+  std::bernoulli_distribution present(0.2);
+  std::vector<double> dense(rows * cols, 0.0);
+  for (auto& entry : dense) {
+    if (present(gen)) {
+      entry = value(gen);
+    }
+  }
+  return dense;
+}
+
+std::vector<double> DenseProduct(const std::vector<double>& a, const std::vector<double>& b, size_t m, size_t n,
+                                 size_t p) {
+  std::vector<double> c(m * p, 0.0);
+  for (size_t i = 0; i < m; ++i) {
+    for (size_t k = 0; k < n; ++k) {
+      for (size_t j = 0; j < p; ++j) {
+        c[(i * p) + j] += a[(i * n) + k] * b[(k * p) + j];
+      }
+    }
+  }
+  return c;
+}
+
+}  // namespace
+
 TEST(konkov_i_SparseMatmulTest_seq, SimpleTest) {
   ppc::core::TaskDataPtr task_data = std::make_shared<ppc::core::TaskData>();
   konkov_i_sparse_matmul_ccs::SparseMatmulTask task(task_data);
@@ -92,3 +127,74 @@ TEST(konkov_i_SparseMatmulTest_seq, IdentityMatrixTest) {
   EXPECT_EQ(task.C_row_indices, task.B_row_indices);
   EXPECT_EQ(task.C_col_ptr, task.B_col_ptr);
 }
+
+TEST(konkov_i_SparseMatmulTest_seq, SparseTaskDataTest) {
+  const auto a_dense = RandomDense(30, 20, 1);
+  const auto b_dense = RandomDense(20, 25, 2);
+  const auto a = ppc::core::CcsMatrix::FromDense(a_dense.data(), 30, 20);
+  const auto b = ppc::core::CcsMatrix::FromDense(b_dense.data(), 20, 25);
+  ppc::core::CcsMatrix c;
+
+  ppc::core::TaskDataPtr task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(&a, 1);
+  task_data->AddInput(&b, 1);
+  task_data->AddOutput(&c, 1);
+  konkov_i_sparse_matmul_ccs::SparseMatmulTask task(task_data);
+  ASSERT_TRUE(task.Validation());
+  ASSERT_TRUE(task.PreProcessing());
+  ASSERT_TRUE(task.Run());
+  ASSERT_TRUE(task.PostProcessing());
+
+  ASSERT_TRUE(c.IsValid());
+  ASSERT_EQ(c.rows, 30U);
+  ASSERT_EQ(c.cols, 25U);
+  std::vector<double> out(30 * 25);
+  c.ToDense(out.data());
+  const auto expected = DenseProduct(a_dense, b_dense, 30, 20, 25);
+  for (size_t i = 0; i < out.size(); ++i) {
+    EXPECT_NEAR(out[i], expected[i], 1e-9);
+  }
+}
+
+TEST(konkov_i_SparseMatmulTest_seq, SparseInputDenseOutputTest) {
+  const auto a_dense = RandomDense(12, 7, 3);
+  const auto b_dense = RandomDense(7, 9, 4);
+  const auto a = ppc::core::CcsMatrix::FromDense(a_dense.data(), 12, 7);
+  const auto b = ppc::core::CcsMatrix::FromDense(b_dense.data(), 7, 9);
+  std::vector<double> out(12 * 9, -1.0);
+
+  ppc::core::TaskDataPtr task_data = std::make_shared<ppc::core::TaskData>();
+  task_data->AddInput(&a, 1);
+  task_data->AddInput(&b, 1);
+  task_data->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  task_data->outputs_count.emplace_back(out.size());
+  konkov_i_sparse_matmul_ccs::SparseMatmulTask task(task_data);
+  ASSERT_TRUE(task.Validation());
+  ASSERT_TRUE(task.PreProcessing());
+  ASSERT_TRUE(task.Run());
+  ASSERT_TRUE(task.PostProcessing());
+
+  const auto expected = DenseProduct(a_dense, b_dense, 12, 7, 9);
+  for (size_t i = 0; i < out.size(); ++i) {
+    EXPECT_NEAR(out[i], expected[i], 1e-9);
+  }
+}
+
+TEST(konkov_i_SparseMatmulTest_seq, SparseValidationTest) {
+  const auto a_dense = RandomDense(4, 3, 5);
+  const auto a = ppc::core::CcsMatrix::FromDense(a_dense.data(), 4, 3);
+  ppc::core::CcsMatrix c;
+
+  ppc::core::TaskDataPtr mismatched = std::make_shared<ppc::core::TaskData>();
+  mismatched->AddInput(&a, 1);
+  mismatched->AddInput(&a, 1);
+  mismatched->AddOutput(&c, 1);
+  EXPECT_FALSE(konkov_i_sparse_matmul_ccs::SparseMatmulTask(mismatched).Validation());
+
+  const auto b_dense = RandomDense(3, 5, 6);
+  const auto b = ppc::core::CcsMatrix::FromDense(b_dense.data(), 3, 5);
+  ppc::core::TaskDataPtr no_output = std::make_shared<ppc::core::TaskData>();
+  no_output->AddInput(&a, 1);
+  no_output->AddInput(&b, 1);
+  EXPECT_FALSE(konkov_i_sparse_matmul_ccs::SparseMatmulTask(no_output).Validation());
+}
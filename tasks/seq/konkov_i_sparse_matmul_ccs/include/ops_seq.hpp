@@ -5,6 +5,9 @@
 
 namespace konkov_i_sparse_matmul_ccs {
 
+// A and B are set through the public members, or passed as ppc::core::CcsMatrix inputs added with
+// AddInput(&matrix, 1). With TaskData inputs the product goes to a ppc::core::CcsMatrix output added the
+// same way, or is densified into a rowsA x colsB double buffer when the caller asks for that instead
 class SparseMatmulTask : public ppc::core::Task {
  public:
   explicit SparseMatmulTask(ppc::core::TaskDataPtr task_data);
@@ -18,6 +21,9 @@ class SparseMatmulTask : public ppc::core::Task {
   std::vector<int> A_row_indices, B_row_indices, C_row_indices;
   std::vector<int> A_col_ptr, B_col_ptr, C_col_ptr;
   int rowsA, colsA, rowsB, colsB;
+
+ private:
+  [[nodiscard]] bool SparseInputs() const;
 };
 
 }  // namespace konkov_i_sparse_matmul_ccs
\ No newline at end of file
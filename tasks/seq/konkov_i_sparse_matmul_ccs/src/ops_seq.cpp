@@ -2,10 +2,12 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "core/linalg/include/spgemm.hpp"
 #include "core/task/include/task.hpp"
 
 namespace konkov_i_sparse_matmul_ccs {
@@ -13,6 +15,16 @@ namespace konkov_i_sparse_matmul_ccs {
 SparseMatmulTask::SparseMatmulTask(ppc::core::TaskDataPtr task_data) : ppc::core::Task(std::move(task_data)) {}
 
 bool SparseMatmulTask::ValidationImpl() {
+  if (SparseInputs()) {
+    const auto& a = task_data->GetInput<ppc::core::CcsMatrix>(0).front();
+    const auto& b = task_data->GetInput<ppc::core::CcsMatrix>(1).front();
+    if (!a.IsValid() || !b.IsValid() || a.cols != b.rows || a.rows == 0 || b.cols == 0) {
+      return false;
+    }
+    return task_data->HasOutput<ppc::core::CcsMatrix>(0) ||
+           (!task_data->outputs_count.empty() &&
+            static_cast<std::uint64_t>(task_data->outputs_count[0]) == a.rows * b.cols);
+  }
   if (colsA != rowsB || rowsA <= 0 || colsB <= 0) {
     return false;
   }
@@ -23,6 +35,20 @@ bool SparseMatmulTask::ValidationImpl() {
 }
 
 bool SparseMatmulTask::PreProcessingImpl() {
+  if (SparseInputs()) {
+    const auto& a = task_data->GetInput<ppc::core::CcsMatrix>(0).front();
+    const auto& b = task_data->GetInput<ppc::core::CcsMatrix>(1).front();
+    A_values = a.values;
+    A_row_indices = a.row_idx;
+    A_col_ptr = a.col_ptr;
+    rowsA = static_cast<int>(a.rows);
+    colsA = static_cast<int>(a.cols);
+    B_values = b.values;
+    B_row_indices = b.row_idx;
+    B_col_ptr = b.col_ptr;
+    rowsB = static_cast<int>(b.rows);
+    colsB = static_cast<int>(b.cols);
+  }
   C_col_ptr.resize(colsB + 1, 0);
   C_row_indices.clear();
   C_values.clear();
@@ -75,6 +101,25 @@ bool SparseMatmulTask::RunImpl() {
   return true;
 }
 
-bool SparseMatmulTask::PostProcessingImpl() { return true; }
+bool SparseMatmulTask::PostProcessingImpl() {
+  if (!SparseInputs()) {
+    return true;
+  }
+  ppc::core::CcsMatrix c{.rows = static_cast<std::size_t>(rowsA),
+                         .cols = static_cast<std::size_t>(colsB),
+                         .col_ptr = std::move(C_col_ptr),
+                         .row_idx = std::move(C_row_indices),
+                         .values = std::move(C_values)};
+  if (task_data->HasOutput<ppc::core::CcsMatrix>(0)) {
+    task_data->GetOutput<ppc::core::CcsMatrix>(0).front() = std::move(c);
+  } else {
+    c.ToDense(reinterpret_cast<double*>(task_data->outputs[0]));
+  }
+  return true;
+}
+
+bool SparseMatmulTask::SparseInputs() const {
+  return task_data->HasInput<ppc::core::CcsMatrix>(0) && task_data->HasInput<ppc::core::CcsMatrix>(1);
+}
 
 }  // namespace konkov_i_sparse_matmul_ccs
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <random>
@@ -252,4 +253,61 @@ TEST(korotin_e_crs_multiplication_seq, test_rndcrs) {
   ASSERT_EQ(c_ri, out_ri);
   ASSERT_EQ(c_col, out_col);
   ASSERT_EQ(c_val, out_val);
-}
\ No newline at end of file
+}
+
+TEST(korotin_e_crs_multiplication_seq, test_rndcrs_vector_outputs) {
+  const unsigned int m = 40;
+  const unsigned int n = 30;
+  const unsigned int p = 20;
+  std::vector<double> a = korotin_e_crs_multiplication_seq::GetRandomMatrix(m, n);
+  std::vector<double> b = korotin_e_crs_multiplication_seq::GetRandomMatrix(n, p);
+  for (unsigned int i = 0; i < (m * n); i += 3) {
+    a[i] = 0;
+  }
+  for (unsigned int i = 0; i < (n * p); i += 2) {
+    b[i] = 0;
+  }
+  std::vector<double> a_val;
+  std::vector<double> b_val;
+  std::vector<unsigned int> a_ri;
+  std::vector<unsigned int> a_col;
+  std::vector<unsigned int> b_ri;
+  std::vector<unsigned int> b_col;
+  korotin_e_crs_multiplication_seq::MakeCRS(a_ri, a_col, a_val, a, m, n);
+  korotin_e_crs_multiplication_seq::MakeCRS(b_ri, b_col, b_val, b, n, p);
+
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->AddInput(a_ri.data(), a_ri.size());
+  task_data_seq->AddInput(a_col.data(), a_col.size());
+  task_data_seq->AddInput(a_val.data(), a_val.size());
+  task_data_seq->AddInput(b_ri.data(), b_ri.size());
+  task_data_seq->AddInput(b_col.data(), b_col.size());
+  task_data_seq->AddInput(b_val.data(), b_val.size());
+
+  // the number of entries of the product is not known in advance
+  std::vector<unsigned int> out_ri(a_ri.size(), 0);
+  std::vector<unsigned int> out_col;
+  std::vector<double> out_val;
+  task_data_seq->AddOutput(out_ri.data(), out_ri.size());
+  task_data_seq->AddOutput(&out_col, 1);
+  task_data_seq->AddOutput(&out_val, 1);
+
+  korotin_e_crs_multiplication_seq::CrsMultiplicationSequential test_task_sequential(task_data_seq);
+  ASSERT_EQ(test_task_sequential.Validation(), true);
+  test_task_sequential.PreProcessing();
+  test_task_sequential.Run();
+  test_task_sequential.PostProcessing();
+
+  std::vector<double> c(m * p, 0);
+  std::vector<double> c_val;
+  std::vector<unsigned int> c_ri;
+  std::vector<unsigned int> c_col;
+  korotin_e_crs_multiplication_seq::MatrixMultiplication(a, b, c, m, n, p);
+  korotin_e_crs_multiplication_seq::MakeCRS(c_ri, c_col, c_val, c, m, p);
+  ASSERT_EQ(c_ri, out_ri);
+  ASSERT_EQ(c_col, out_col);
+  ASSERT_EQ(c_val.size(), out_val.size());
+  for (size_t i = 0; i < c_val.size(); i++) {
+    EXPECT_NEAR(c_val[i], out_val[i], 1e-9);
+  }
+}
@@ -7,6 +7,10 @@
 
 namespace korotin_e_crs_multiplication_seq {
 
+// Inputs are the CRS triplets (row pointers, columns, values) of A and then of B. Outputs are the row pointers of
+// the product, sized like those of A, followed by its columns and values: raw buffers the caller sized for every
+// entry, or a std::vector<unsigned int> and a std::vector<double> added with AddOutput(&vector, 1), which the
+// task resizes to the entries of the product
 class CrsMultiplicationSequential : public ppc::core::Task {
  public:
   explicit CrsMultiplicationSequential(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
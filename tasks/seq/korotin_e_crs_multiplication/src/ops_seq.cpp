@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <utility>
 #include <vector>
 
 bool korotin_e_crs_multiplication_seq::CrsMultiplicationSequential::PreProcessingImpl() {
@@ -107,11 +108,16 @@ bool korotin_e_crs_multiplication_seq::CrsMultiplicationSequential::PostProcessi
   for (size_t i = 0; i < output_rI_.size(); i++) {
     reinterpret_cast<unsigned int *>(task_data->outputs[0])[i] = output_rI_[i];
   }
+  task_data->outputs_count.emplace_back(output_col_.size());
+  task_data->outputs_count.emplace_back(output_val_.size());
+  if (task_data->HasOutput<std::vector<unsigned int>>(1) && task_data->HasOutput<std::vector<double>>(2)) {
+    task_data->GetOutput<std::vector<unsigned int>>(1).front() = std::move(output_col_);
+    task_data->GetOutput<std::vector<double>>(2).front() = std::move(output_val_);
+    return true;
+  }
   for (size_t i = 0; i < output_col_.size(); i++) {
     reinterpret_cast<unsigned int *>(task_data->outputs[1])[i] = output_col_[i];
     reinterpret_cast<double *>(task_data->outputs[2])[i] = output_val_[i];
   }
-  task_data->outputs_count.emplace_back(output_col_.size());
-  task_data->outputs_count.emplace_back(output_val_.size());
   return true;
 }
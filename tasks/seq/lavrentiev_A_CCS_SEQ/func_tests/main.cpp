@@ -9,6 +9,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/linalg/include/spgemm.hpp"
 #include "core/task/include/task.hpp"
 #include "seq/lavrentiev_A_CCS_SEQ/include/ops_seq.hpp"
 
@@ -162,4 +163,63 @@ TEST(lavrentiev_a_ccs_seq, test_25x25_matrix) {
   for (size_t i = 0; i < task.result.size(); ++i) {
     EXPECT_NEAR(task.result[i], task.random_data[i], kEpsilon);
   }
-}
\ No newline at end of file
+}
+
+TEST(lavrentiev_a_ccs_seq, test_sparse_2x3_by_3x4) {
+  const std::vector<double> a_dense{1.0, 0.0, 2.0, 0.0, 3.0, 0.0};
+  const std::vector<double> b_dense{1.0, 0.0, 0.0, 2.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 4.0, 1.0};
+  const auto a = ppc::core::CcsMatrix::FromDense(a_dense.data(), 2, 3);
+  const auto b = ppc::core::CcsMatrix::FromDense(b_dense.data(), 3, 4);
+  ppc::core::CcsMatrix product;
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->AddInput(&a, 1);
+  task_data_seq->AddInput(&b, 1);
+  task_data_seq->AddOutput(&product, 1);
+  lavrentiev_a_ccs_seq::CCSSequential test_task_sequential(task_data_seq);
+  ASSERT_EQ(test_task_sequential.Validation(), true);
+  test_task_sequential.PreProcessing();
+  test_task_sequential.Run();
+  test_task_sequential.PostProcessing();
+  ASSERT_TRUE(product.IsValid());
+  ASSERT_EQ(product.rows, 2U);
+  ASSERT_EQ(product.cols, 4U);
+  std::vector<double> result(2 * 4);
+  product.ToDense(result.data());
+  std::vector<double> test_result{1.0, 0.0, 8.0, 4.0, 0.0, 3.0, 0.0, 0.0};
+  for (size_t i = 0; i < result.size(); ++i) {
+    EXPECT_NEAR(result[i], test_result[i], kEpsilon);
+  }
+}
+
+TEST(lavrentiev_a_ccs_seq, test_sparse_input_dense_output) {
+  auto random_data = GenerateRandomMatrix(20 * 20, 3);
+  auto single_matrix = GenerateSingleMatrix(20 * 20);
+  const auto a = ppc::core::CcsMatrix::FromDense(random_data.data(), 20, 20);
+  const auto b = ppc::core::CcsMatrix::FromDense(single_matrix.data(), 20, 20);
+  std::vector<double> result(20 * 20, -1.0);
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->AddInput(&a, 1);
+  task_data_seq->AddInput(&b, 1);
+  task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(result.data()));
+  task_data_seq->outputs_count.emplace_back(result.size());
+  lavrentiev_a_ccs_seq::CCSSequential test_task_sequential(task_data_seq);
+  ASSERT_EQ(test_task_sequential.Validation(), true);
+  test_task_sequential.PreProcessing();
+  test_task_sequential.Run();
+  test_task_sequential.PostProcessing();
+  for (size_t i = 0; i < result.size(); ++i) {
+    EXPECT_NEAR(result[i], random_data[i], kEpsilon);
+  }
+}
+
+TEST(lavrentiev_a_ccs_seq, test_sparse_validation) {
+  const std::vector<double> dense{1.0, 0.0, 2.0, 0.0, 3.0, 0.0};
+  const auto a = ppc::core::CcsMatrix::FromDense(dense.data(), 2, 3);
+  ppc::core::CcsMatrix product;
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->AddInput(&a, 1);
+  task_data_seq->AddInput(&a, 1);
+  task_data_seq->AddOutput(&product, 1);
+  lavrentiev_a_ccs_seq::CCSSequential test_task_sequential(task_data_seq);
+  EXPECT_EQ(test_task_sequential.Validation(), false);
+}
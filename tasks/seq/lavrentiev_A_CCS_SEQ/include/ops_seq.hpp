@@ -4,6 +4,7 @@
 #include <utility>
 #include <vector>
 
+#include "core/linalg/include/spgemm.hpp"
 #include "core/task/include/task.hpp"
 
 namespace lavrentiev_a_ccs_seq {
@@ -15,9 +16,15 @@ struct Sparse {
   std::vector<int> columnsSum;
 };
 
+// Inputs are two dense row-major matrices with their sizes in inputs_count[0..3], or two ppc::core::CcsMatrix
+// objects added with AddInput(&matrix, 1). The product goes to a ppc::core::CcsMatrix output added the same way,
+// or to a dense rows x cols buffer, which sparse inputs only fill when asked to
 class CCSSequential : public ppc::core::Task {
  private:
   [[nodiscard]] bool IsEmpty() const;
+  [[nodiscard]] bool SparseInputs() const;
+  static Sparse FromCcs(const ppc::core::CcsMatrix& matrix);
+  static ppc::core::CcsMatrix ToCcs(const Sparse& matrix);
   static Sparse ConvertToSparse(std::pair<int, int> bsize, const std::vector<double>& values);
   static Sparse Transpose(const Sparse& sparse);
   static Sparse MatMul(const Sparse& matrix1, const Sparse& matrix2);
@@ -3,9 +3,12 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 #include <vector>
 
+#include "core/linalg/include/spgemm.hpp"
+
 lavrentiev_a_ccs_seq::Sparse lavrentiev_a_ccs_seq::CCSSequential::ConvertToSparse(std::pair<int, int> bsize,
                                                                                   const std::vector<double> &values) {
   auto [size, elements, rows, columns_sum] = Sparse();
@@ -51,7 +54,7 @@ lavrentiev_a_ccs_seq::Sparse lavrentiev_a_ccs_seq::CCSSequential::MatMul(const S
   for (auto i = 1; i < static_cast<int>(columns_sum.size()); ++i) {
     columns_sum[i] = columns_sum[i] + columns_sum[i - 1];
   }
-  size.first = matrix2.size.second;
+  size.first = matrix1.size.first;
   size.second = matrix2.size.second;
 
   return {.size = size, .elements = elements, .rows = rows, .columnsSum = columns_sum};
@@ -105,13 +108,49 @@ lavrentiev_a_ccs_seq::Sparse lavrentiev_a_ccs_seq::CCSSequential::Transpose(cons
   return {.size = size, .elements = elements, .rows = rows, .columnsSum = columns_sum};
 }
 
+lavrentiev_a_ccs_seq::Sparse lavrentiev_a_ccs_seq::CCSSequential::FromCcs(const ppc::core::CcsMatrix &matrix) {
+  return {.size = {static_cast<int>(matrix.rows), static_cast<int>(matrix.cols)},
+          .elements = matrix.values,
+          .rows = matrix.row_idx,
+          .columnsSum = std::vector<int>(matrix.col_ptr.begin() + 1, matrix.col_ptr.end())};
+}
+
+ppc::core::CcsMatrix lavrentiev_a_ccs_seq::CCSSequential::ToCcs(const Sparse &matrix) {
+  std::vector<int> col_ptr(matrix.columnsSum.size() + 1, 0);
+  std::ranges::copy(matrix.columnsSum, col_ptr.begin() + 1);
+  return {.rows = static_cast<std::size_t>(matrix.size.first),
+          .cols = static_cast<std::size_t>(matrix.size.second),
+          .col_ptr = std::move(col_ptr),
+          .row_idx = matrix.rows,
+          .values = matrix.elements};
+}
+
+bool lavrentiev_a_ccs_seq::CCSSequential::SparseInputs() const {
+  return task_data->HasInput<ppc::core::CcsMatrix>(0) && task_data->HasInput<ppc::core::CcsMatrix>(1);
+}
+
 bool lavrentiev_a_ccs_seq::CCSSequential::ValidationImpl() {
+  if (SparseInputs()) {
+    const auto &a = task_data->GetInput<ppc::core::CcsMatrix>(0).front();
+    const auto &b = task_data->GetInput<ppc::core::CcsMatrix>(1).front();
+    if (!a.IsValid() || !b.IsValid() || a.cols != b.rows) {
+      return false;
+    }
+    return task_data->HasOutput<ppc::core::CcsMatrix>(0) ||
+           (!task_data->outputs_count.empty() &&
+            static_cast<std::uint64_t>(task_data->outputs_count[0]) == a.rows * b.cols);
+  }
   return task_data->inputs_count[0] * task_data->inputs_count[3] == task_data->outputs_count[0] &&
          task_data->inputs_count[0] == task_data->inputs_count[3] &&
          task_data->inputs_count[1] == task_data->inputs_count[2];
 }
 
 bool lavrentiev_a_ccs_seq::CCSSequential::PreProcessingImpl() {
+  if (SparseInputs()) {
+    A_ = FromCcs(task_data->GetInput<ppc::core::CcsMatrix>(0).front());
+    B_ = FromCcs(task_data->GetInput<ppc::core::CcsMatrix>(1).front());
+    return true;
+  }
   A_.size = {static_cast<int>(task_data->inputs_count[0]), static_cast<int>(task_data->inputs_count[1])};
   B_.size = {static_cast<int>(task_data->inputs_count[2]), static_cast<int>(task_data->inputs_count[3])};
   if (IsEmpty()) {
@@ -142,6 +181,10 @@ bool lavrentiev_a_ccs_seq::CCSSequential::RunImpl() {
 }
 
 bool lavrentiev_a_ccs_seq::CCSSequential::PostProcessingImpl() {
+  if (task_data->HasOutput<ppc::core::CcsMatrix>(0)) {
+    task_data->GetOutput<ppc::core::CcsMatrix>(0).front() = ToCcs(Answer_);
+    return true;
+  }
   std::vector<double> result = ConvertFromSparse(Answer_);
   for (auto i = 0; i < static_cast<int>(result.size()); ++i) {
     reinterpret_cast<double *>(task_data->outputs[0])[i] = result[i];
@@ -3,14 +3,15 @@
 #include <utility>
 #include <vector>
 
+#include "core/gemm/include/blocked_matrix.hpp"
 #include "core/task/include/task.hpp"
 
 namespace lysov_i_matrix_multiplication_fox_algorithm_seq {
 void TrivialMatrixMultiplication(const std::vector<double> &matrix_a, const std::vector<double> &matrix_b,
                                  std::vector<double> &result_matrix, size_t matrix_size);
 std::vector<double> GetRandomMatrix(size_t size, int min_gen_value, int max_gen_value);
-void ProcessBlock(const std::vector<double> &a, const std::vector<double> &b, std::vector<double> &c, std::size_t i,
-                  std::size_t j, std::size_t a_block_row, std::size_t block_size, std::size_t n);
+void ProcessBlock(const ppc::core::BlockedMatrix<double> &a, const ppc::core::BlockedMatrix<double> &b,
+                  ppc::core::BlockedMatrix<double> &c, std::size_t i, std::size_t j, std::size_t a_block_row);
 
 class TestTaskSequential : public ppc::core::Task {
  public:
@@ -21,9 +22,9 @@ class TestTaskSequential : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  std::vector<double> a_;
-  std::vector<double> b_;
-  std::vector<double> c_;
+  ppc::core::BlockedMatrix<double> a_;
+  ppc::core::BlockedMatrix<double> b_;
+  ppc::core::BlockedMatrix<double> c_;
   std::size_t n_;
   std::size_t block_size_;
 };
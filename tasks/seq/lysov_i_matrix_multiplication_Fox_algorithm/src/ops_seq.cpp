@@ -5,44 +5,26 @@
 #include <cstddef>
 #include <vector>
 
-void lysov_i_matrix_multiplication_fox_algorithm_seq::ProcessBlock(const std::vector<double> &a,
-                                                                   const std::vector<double> &b, std::vector<double> &c,
-                                                                   std::size_t i, std::size_t j,
-                                                                   std::size_t a_block_row, std::size_t block_size,
-                                                                   std::size_t n) {
-  std::size_t block_h = std::min(block_size, n - (i * block_size));
-  std::size_t block_w = std::min(block_size, n - (j * block_size));
-  for (std::size_t ii = 0; ii < block_h; ++ii) {
-    for (std::size_t jj = 0; jj < block_w; ++jj) {
-      double sum = 0.0;
-      for (std::size_t kk = 0; kk < std::min(block_size, n - (a_block_row * block_size)); ++kk) {
-        std::size_t row_a = (i * block_size) + ii;
-        std::size_t col_a = (a_block_row * block_size) + kk;
-        std::size_t row_b = (a_block_row * block_size) + kk;
-        std::size_t col_b = (j * block_size) + jj;
-        if (row_a < n && col_a < n && row_b < n && col_b < n) {
-          sum += a[(row_a * n) + col_a] * b[(row_b * n) + col_b];
-        }
-      }
-      std::size_t row_c = (i * block_size) + ii;
-      std::size_t col_c = (j * block_size) + jj;
-      if (row_c < n && col_c < n) {
-        c[(row_c * n) + col_c] += sum;
-      }
-    }
-  }
+#include "core/gemm/include/gemm.hpp"
+
+void lysov_i_matrix_multiplication_fox_algorithm_seq::ProcessBlock(const ppc::core::BlockedMatrix<double> &a,
+                                                                   const ppc::core::BlockedMatrix<double> &b,
+                                                                   ppc::core::BlockedMatrix<double> &c, std::size_t i,
+                                                                   std::size_t j, std::size_t a_block_row) {
+  // Edge tiles are zero-padded, so every block is a full block_size product
+  std::size_t block_size = c.BlockSize();
+  ppc::core::Gemm<double>(block_size, block_size, block_size, 1.0, a.Tile(i, a_block_row), block_size,
+                          b.Tile(a_block_row, j), block_size, 1.0, c.Tile(i, j), block_size);
 }
 
 bool lysov_i_matrix_multiplication_fox_algorithm_seq::TestTaskSequential::PreProcessingImpl() {
   n_ = reinterpret_cast<std::size_t *>(task_data->inputs[0])[0];
   block_size_ = reinterpret_cast<std::size_t *>(task_data->inputs[3])[0];
-  a_.resize(n_ * n_);
-  b_.resize(n_ * n_);
-  c_.resize(n_ * n_, 0.0);
-  std::copy(reinterpret_cast<double *>(task_data->inputs[1]),
-            reinterpret_cast<double *>(task_data->inputs[1]) + (n_ * n_), a_.begin());
-  std::copy(reinterpret_cast<double *>(task_data->inputs[2]),
-            reinterpret_cast<double *>(task_data->inputs[2]) + (n_ * n_), b_.begin());
+  a_ = ppc::core::BlockedMatrix<double>::FromRowMajor(reinterpret_cast<double *>(task_data->inputs[1]), n_, n_, n_,
+                                                      block_size_);
+  b_ = ppc::core::BlockedMatrix<double>::FromRowMajor(reinterpret_cast<double *>(task_data->inputs[2]), n_, n_, n_,
+                                                      block_size_);
+  c_.Resize(n_, n_, block_size_);
   return true;
 }
 
@@ -64,7 +46,7 @@ bool lysov_i_matrix_multiplication_fox_algorithm_seq::TestTaskSequential::RunImp
     for (std::size_t i = 0; i < num_blocks; ++i) {
       std::size_t a_block_row = (i + step) % num_blocks;
       for (std::size_t j = 0; j < num_blocks; ++j) {
-        ProcessBlock(a_, b_, c_, i, j, a_block_row, block_size_, n_);
+        ProcessBlock(a_, b_, c_, i, j, a_block_row);
       }
     }
   }
@@ -72,6 +54,6 @@ bool lysov_i_matrix_multiplication_fox_algorithm_seq::TestTaskSequential::RunImp
 }
 
 bool lysov_i_matrix_multiplication_fox_algorithm_seq::TestTaskSequential::PostProcessingImpl() {
-  std::ranges::copy(c_, reinterpret_cast<double *>(task_data->outputs[0]));
+  c_.Store(reinterpret_cast<double *>(task_data->outputs[0]), n_);
   return true;
 }
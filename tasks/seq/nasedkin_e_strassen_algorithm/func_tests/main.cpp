@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <random>
@@ -9,6 +10,9 @@
 #include "seq/nasedkin_e_strassen_algorithm/include/ops_seq.hpp"
 
 namespace {
+// Far below the default cutoff, so every test larger than 8 runs Strassen levels
+constexpr std::size_t kCutoff = 8;
+
 std::vector<double> GenerateRandomMatrix(int size) {
   std::random_device rd;
   std::mt19937 gen(rd());
@@ -34,7 +38,7 @@ void RunRandomMatrixTest(int size) {
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
   task_data_seq->outputs_count.emplace_back(out.size());
 
-  nasedkin_e_strassen_algorithm_seq::StrassenSequential strassen_task_sequential(task_data_seq);
+  nasedkin_e_strassen_algorithm_seq::StrassenSequential strassen_task_sequential(task_data_seq, kCutoff);
   ASSERT_EQ(strassen_task_sequential.Validation(), true);
   strassen_task_sequential.PreProcessing();
   strassen_task_sequential.Run();
@@ -64,7 +68,7 @@ void RunFixedMatrixTest(int size) {
   task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
   task_data_seq->outputs_count.emplace_back(out.size());
 
-  nasedkin_e_strassen_algorithm_seq::StrassenSequential strassen_task_sequential(task_data_seq);
+  nasedkin_e_strassen_algorithm_seq::StrassenSequential strassen_task_sequential(task_data_seq, kCutoff);
   ASSERT_EQ(strassen_task_sequential.Validation(), true);
   strassen_task_sequential.PreProcessing();
   strassen_task_sequential.Run();
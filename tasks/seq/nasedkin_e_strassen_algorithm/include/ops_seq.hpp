@@ -1,8 +1,10 @@
 #pragma once
 
+#include <cstddef>
 #include <utility>
 #include <vector>
 
+#include "core/gemm/include/strassen.hpp"
 #include "core/task/include/task.hpp"
 
 namespace nasedkin_e_strassen_algorithm_seq {
@@ -11,28 +13,20 @@ std::vector<double> StandardMultiply(const std::vector<double>& a, const std::ve
 
 class StrassenSequential : public ppc::core::Task {
  public:
-  explicit StrassenSequential(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  // cutoff - largest product dimension handed to Gemm without a Strassen level
+  explicit StrassenSequential(ppc::core::TaskDataPtr task_data, std::size_t cutoff = ppc::core::kStrassenDefaultCutoff)
+      : Task(std::move(task_data)), engine_(ppc::core::StrassenConfigWithCutoff(cutoff)) {}
   bool PreProcessingImpl() override;
   bool ValidationImpl() override;
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
  private:
-  static std::vector<double> AddMatrices(const std::vector<double>& a, const std::vector<double>& b, int size);
-  static std::vector<double> SubtractMatrices(const std::vector<double>& a, const std::vector<double>& b, int size);
-  static void SplitMatrix(const std::vector<double>& parent, std::vector<double>& child, int row_start, int col_start,
-                          int parent_size);
-  static void MergeMatrix(std::vector<double>& parent, const std::vector<double>& child, int row_start, int col_start,
-                          int parent_size);
-  static std::vector<double> PadMatrixToPowerOfTwo(const std::vector<double>& matrix, int original_size);
-  static std::vector<double> TrimMatrixToOriginalSize(const std::vector<double>& matrix, int original_size,
-                                                      int padded_size);
-  static std::vector<double> StrassenMultiply(const std::vector<double>& a, const std::vector<double>& b, int size);
-
   std::vector<double> input_matrix_a_, input_matrix_b_;
   std::vector<double> output_matrix_;
   int matrix_size_{};
-  int original_size_{};
+
+  ppc::core::StrassenEngine<double> engine_;
 };
 
 }  // namespace nasedkin_e_strassen_algorithm_seq
\ No newline at end of file
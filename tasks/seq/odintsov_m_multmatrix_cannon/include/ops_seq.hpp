@@ -1,8 +1,8 @@
 #pragma once
 
 #include <utility>
-#include <vector>
 
+#include "core/gemm/include/blocked_matrix.hpp"
 #include "core/task/include/task.hpp"
 
 namespace odintsov_m_mulmatrix_cannon_seq {
@@ -17,19 +17,12 @@ class MulMatrixCannonSequential : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  private:
-  static void ShiftRow(std::vector<double>& matrix, int root, int row, int shift);
-  static void ShiftColumn(std::vector<double>& matrix, int root, int col, int shift);
-  void ShiftBlocksUp(std::vector<double>& matrix, int root, int block_sz) const;
-  void ShiftBlocksLeft(std::vector<double>& matrix, int root, int block_sz) const;
   static bool IsSquere(unsigned int num);
   static int GetBlockSize(int n);
-  static void CopyBlock(const std::vector<double>& matrix, std::vector<double>& block, int start, int root,
-                        int block_sz);
-  static void InitializeShift(std::vector<double>& matrix, int root, int grid_size, int block_sz, bool is_row_shift);
-  std::vector<double> matrixA_, matrixB_;
-  unsigned int szA_ = 0, szB_ = 0;
+  // A, B and C stored tile by tile; the Cannon skew and shifts are applied to tile indices
+  ppc::core::BlockedMatrix<double> matrixA_, matrixB_, matrixC_;
+  int root_ = 0;
   int block_sz_ = 0;
-  std::vector<double> matrixC_;
 };
 
 }  // namespace odintsov_m_mulmatrix_cannon_seq
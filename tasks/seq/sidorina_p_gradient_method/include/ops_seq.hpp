@@ -1,82 +1,43 @@
 #pragma once
 
 #include <cmath>
+#include <cstddef>
 #include <utility>
 #include <vector>
 
+#include "core/linalg/include/krylov_kernels.hpp"
 #include "core/task/include/task.hpp"
 
 namespace sidorina_p_gradient_method_seq {
 
-inline std::vector<double> MultiplyMatrixByVector(const std::vector<double>& a, const std::vector<double>& vec,
-                                                  int size) {
-  std::vector<double> result(size, 0);
-  for (int i = 0; i < size; i++) {
-    for (int j = 0; j < size; j++) {
-      result[i] += a[(i * size) + j] * vec[j];
-    }
-  }
-  return result;
-}
-
-inline double VectorNorm(const std::vector<double>& vec) {
-  double sum = 0;
-  for (double value : vec) {
-    sum += std::pow(value, 2);
-  }
-  return std::sqrt(sum);
-}
+// Conjugate gradients from the given starting solution; iterations receives the number of passes over a
+inline std::vector<double> ConjugateGradientMethod(ppc::core::KrylovKernels& kernels, const std::vector<double>& a,
+                                                   const std::vector<double>& b, std::vector<double> solution,
+                                                   double tolerance, int size, int& iterations) {
+  const auto n = static_cast<std::size_t>(size);
+  iterations = 0;
 
-inline double Dot(const std::vector<double>& vec1, const std::vector<double>& vec2) {
-  double sum = 0;
-  for (unsigned long i = 0; i < vec1.size(); i++) {
-    sum += vec1[i] * vec2[i];
-  }
-  return sum;
-}
-
-inline double Dot(const std::vector<double>& vec) {
-  double sum = 0;
-  for (unsigned long i = 0; i < vec.size(); i++) {
-    sum += std::pow(vec[i], 2);
-  }
-  return sum;
-}
+  // residual = b - a * solution
+  std::vector<double> residual = b;
+  kernels.Gemv(n, n, -1.0, a.data(), n, solution.data(), 1.0, residual.data());
+  ++iterations;
 
-inline std::vector<double> ConjugateGradientMethod(std::vector<double>& a, std::vector<double>& b,
-                                                   std::vector<double> solution, double tolerance, int size) {
-  std::vector<double> matrix_times_solution = MultiplyMatrixByVector(a, solution, size);
-
-  auto residual = std::vector<double>(size);
-  auto direction = std::vector<double>(size);
-
-  for (int i = 0; i < size; ++i) {
-    residual[i] = b[i] - matrix_times_solution[i];
-  }
-
-  double residual_norm_squared = Dot(residual);
+  double residual_norm_squared = kernels.Dot(n, residual.data(), residual.data());
   if (std::sqrt(residual_norm_squared) < tolerance) {
     return solution;
   }
-  direction = residual;
-  std::vector<double> matrix_times_direction(size);
+  std::vector<double> direction = residual;
+  std::vector<double> matrix_times_direction(n);
   while (std::sqrt(residual_norm_squared) > tolerance) {
-    matrix_times_direction = MultiplyMatrixByVector(a, direction, size);
-    double direction_dot_matrix_times_direction = Dot(direction, matrix_times_direction);
+    double direction_dot_matrix_times_direction =
+        kernels.GemvDot(n, a.data(), n, direction.data(), matrix_times_direction.data());
+    ++iterations;
     double alpha = residual_norm_squared / direction_dot_matrix_times_direction;
-    for (int i = 0; i < size; i++) {
-      solution[i] += alpha * direction[i];
-    }
-    for (int i = 0; i < size; i++) {
-      residual[i] -= alpha * matrix_times_direction[i];
-    }
-
-    double new_residual_norm_squared = Dot(residual);
+    double new_residual_norm_squared = kernels.CgUpdate(n, alpha, direction.data(), matrix_times_direction.data(),
+                                                        solution.data(), residual.data());
     double beta = new_residual_norm_squared / residual_norm_squared;
     residual_norm_squared = new_residual_norm_squared;
-    for (int i = 0; i < size; i++) {
-      direction[i] = residual[i] + beta * direction[i];
-    }
+    kernels.Xpby(n, residual.data(), beta, direction.data());
   }
   return solution;
 }
@@ -128,6 +89,8 @@ class GradientMethod : public ppc::core::Task {
   bool RunImpl() override;
   bool PostProcessingImpl() override;
 
+  [[nodiscard]] int Iterations() const { return iterations_; }
+
  private:
   int size_;
   double tolerance_;
@@ -135,6 +98,9 @@ class GradientMethod : public ppc::core::Task {
   std::vector<double> b_;
   std::vector<double> solution_;
   std::vector<double> result_;
+  int iterations_{0};
+
+  ppc::core::KrylovKernels kernels_;
 };
 
 }  // namespace sidorina_p_gradient_method_seq
\ No newline at end of file
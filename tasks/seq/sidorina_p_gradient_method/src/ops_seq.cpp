@@ -46,7 +46,7 @@ bool sidorina_p_gradient_method_seq::GradientMethod::ValidationImpl() {
 }
 
 bool sidorina_p_gradient_method_seq::GradientMethod::RunImpl() {
-  result_ = ConjugateGradientMethod(a_, b_, solution_, tolerance_, size_);
+  result_ = ConjugateGradientMethod(kernels_, a_, b_, solution_, tolerance_, size_, iterations_);
   return true;
 }
 
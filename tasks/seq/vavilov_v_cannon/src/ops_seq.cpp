@@ -2,8 +2,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
+#include "core/gemm/include/gemm.hpp"
+
 bool vavilov_v_cannon_seq::CannonSequential::PreProcessingImpl() {
   N_ = static_cast<unsigned int>(std::sqrt(task_data->inputs_count[0]));
   num_blocks_ = static_cast<unsigned int>(task_data->inputs_count[2]);
@@ -52,21 +55,9 @@ void vavilov_v_cannon_seq::CannonSequential::InitialShift() {
 void vavilov_v_cannon_seq::CannonSequential::BlockMultiply() {
   for (unsigned int bi = 0; bi < N_; bi += block_size_) {
     for (unsigned int bj = 0; bj < N_; bj += block_size_) {
-      for (unsigned int i = bi; i < bi + block_size_; i++) {
-        for (unsigned int j = bj; j < bj + block_size_; j++) {
-          double temp = 0.0;
-          for (unsigned int k = 0; k < block_size_; k++) {
-            unsigned int row_a = bi + (i - bi);
-            unsigned int col_a = bj + k;
-            unsigned int row_b = bi + k;
-            unsigned int col_b = bj + (j - bj);
-
-            temp += A_[(row_a * N_) + col_a] * B_[(row_b * N_) + col_b];
-          }
-
-          C_[(i * N_) + j] += temp;
-        }
-      }
+      const std::size_t offset = (static_cast<std::size_t>(bi) * N_) + bj;
+      ppc::core::Gemm<double>(block_size_, block_size_, block_size_, 1.0, A_.data() + offset, N_, B_.data() + offset,
+                              N_, 1.0, C_.data() + offset, N_);
     }
   }
 }
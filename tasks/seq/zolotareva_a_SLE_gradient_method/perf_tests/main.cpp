@@ -1,7 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <iostream>
 #include <memory>
 #include <random>
 #include <vector>
@@ -125,3 +127,71 @@ TEST(sequential_zolotareva_a_sle_gradient_method_seq, test_task_run) {
     EXPECT_NEAR(sum, b[i], 1e-5);
   }
 }
+
+namespace {
+
+// Медиана времени Run задачи с a и правыми частями b, решения пишутся в x
+double MedianTaskRun(std::vector<double> &a, std::vector<double> &b, std::vector<double> &x, int n) {
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->inputs.push_back(reinterpret_cast<uint8_t *>(a.data()));
+  task_data_seq->inputs.push_back(reinterpret_cast<uint8_t *>(b.data()));
+  task_data_seq->inputs_count.push_back(n * n);
+  task_data_seq->inputs_count.push_back(b.size());
+  task_data_seq->outputs.push_back(reinterpret_cast<uint8_t *>(x.data()));
+  task_data_seq->outputs_count.push_back(x.size());
+
+  auto test_task_sequential = std::make_shared<zolotareva_a_sle_gradient_method_seq::TestTaskSequential>(task_data_seq);
+
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(test_task_sequential);
+  perf_analyzer->TaskRun(perf_attr, perf_results);
+  return perf_results->median_sec;
+}
+
+}  // namespace
+
+// k правых частей одной задачей против отдельной задачи на каждую: время на одну правую часть
+TEST(sequential_zolotareva_a_sle_gradient_method_seq, test_task_run_batched) {
+  const int n = 500;
+  const int k = 16;
+  std::vector<double> a(n * n);
+  std::vector<double> b(n * k);
+  std::vector<double> x(n * k);
+  zolotareva_a_sle_gradient_method_seq::GenerateSle(a, b, n);
+  // правая часть j - первая, сдвинутая на j элементов
+  for (int j = 1; j < k; ++j) {
+    for (int i = 0; i < n; ++i) {
+      b[(j * n) + i] = b[(i + j) % n];
+    }
+  }
+
+  const double batched = MedianTaskRun(a, b, x, n);
+  double separate = 0.0;
+  std::vector<double> b_j(n);
+  std::vector<double> x_j(n);
+  for (int j = 0; j < k; ++j) {
+    std::copy_n(b.begin() + (j * n), n, b_j.begin());
+    separate += MedianTaskRun(a, b_j, x_j, n);
+  }
+  std::cout << "zolotareva_a_sle_gradient_method_seq:task_run_batched:batch: k=" << k << " per_rhs_sec=" << batched / k
+            << " separate_per_rhs_sec=" << separate / k << " speedup=" << separate / batched << '\n';
+
+  for (int rhs = 0; rhs < k; ++rhs) {
+    for (int i = 0; i < n; ++i) {
+      double sum = 0.0;
+      for (int j = 0; j < n; ++j) {
+        sum += a[(i * n) + j] * x[(rhs * n) + j];
+      }
+      EXPECT_NEAR(sum, b[(rhs * n) + i], 1e-5) << "rhs " << rhs;
+    }
+  }
+}
\ No newline at end of file
@@ -2,22 +2,22 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <vector>
 
+#include "core/linalg/include/krylov_kernels.hpp"
+#include "core/linalg/include/linear_operator.hpp"
+#include "core/linalg/include/preconditioner.hpp"
+
 bool zolotareva_a_sle_gradient_method_seq::TestTaskSequential::PreProcessingImpl() {
-  n_ = static_cast<int>(task_data->inputs_count[1]);
-  a_.resize(n_ * n_);
-  b_.resize(n_);
-  x_.resize(n_, 0.0);
-  const auto* input_matrix = reinterpret_cast<const double*>(task_data->inputs[0]);
+  n_ = static_cast<int>(ppc::core::MatrixOperator::InputSize(*task_data, 0));
+  k_ = static_cast<int>(task_data->inputs_count[1]) / n_;
+  a_ = ppc::core::MatrixOperator::FromInput(*task_data, 0, n_);
+  b_.resize(static_cast<std::size_t>(n_) * k_);
+  x_.resize(b_.size(), 0.0);
   const auto* input_vector = reinterpret_cast<const double*>(task_data->inputs[1]);
-
-  for (int i = 0; i < n_; ++i) {
-    b_[i] = input_vector[i];
-    for (int j = 0; j < n_; ++j) {
-      a_[(i * n_) + j] = input_matrix[(i * n_) + j];
-    }
-  }
+  std::copy(input_vector, input_vector + b_.size(), b_.begin());
+  preconditioner_.Setup(ppc::core::Preconditioner::KindFromInput(*task_data, 2), a_);
 
   return true;
 }
@@ -31,8 +31,14 @@ bool zolotareva_a_sle_gradient_method_seq::TestTaskSequential::ValidationImpl()
     return false;
   }
 
-  if (static_cast<int>(task_data->inputs_count[0]) !=
-      (static_cast<int>(task_data->inputs_count[1]) * static_cast<int>(task_data->inputs_count[1]))) {
+  // a задаётся плотной матрицей n*n, CSR-матрицей или матрично-свободным оператором, b - одной или
+  // несколькими правыми частями длины n
+  const int n = static_cast<int>(ppc::core::MatrixOperator::InputSize(*task_data, 0));
+  if (n == 0 || task_data->inputs_count[1] == 0 || task_data->inputs_count[1] % n != 0) {
+    return false;
+  }
+  const auto a = ppc::core::MatrixOperator::FromInput(*task_data, 0, n);
+  if (a.Empty() || !preconditioner_.TrySetup(ppc::core::Preconditioner::KindFromInput(*task_data, 2), a)) {
     return false;
   }
   if (task_data->outputs_count[0] != task_data->inputs_count[1]) {
@@ -40,13 +46,35 @@ bool zolotareva_a_sle_gradient_method_seq::TestTaskSequential::ValidationImpl()
   }
 
   // проверка симметрии и положительной определённости
-  const auto* a = reinterpret_cast<const double*>(task_data->inputs[0]);
-
-  return IsPositiveAndSimm(a, static_cast<int>(task_data->inputs_count[1]));
+  if (a.GetKind() == ppc::core::MatrixOperator::kDense) {
+    return IsPositiveAndSimm(reinterpret_cast<const double*>(task_data->inputs[0]), n);
+  }
+  // для CSR-матрицы только необходимые условия: симметрия и положительная диагональ
+  if (a.GetCsr() != nullptr) {
+    const auto diagonal = a.Diagonal();
+    return a.GetCsr()->IsSymmetric() && std::ranges::all_of(diagonal, [](double d) { return d > 0.0; });
+  }
+  // матрично-свободный оператор проверить нельзя
+  return true;
 }
 
 bool zolotareva_a_sle_gradient_method_seq::TestTaskSequential::RunImpl() {
-  ConjugateGradient(a_, b_, x_, n_);
+  std::ranges::fill(x_, 0.0);
+  if (k_ > 1 && a_.SupportsBatch()) {
+    iterations_ = BatchedConjugateGradient(kernels_, a_, preconditioner_, b_, x_, n_, k_);
+    return true;
+  }
+  // одна правая часть или матрично-свободный оператор: системы решаются по очереди
+  const auto size = static_cast<std::size_t>(n_);
+  std::vector<double> b(size);
+  std::vector<double> x(size);
+  iterations_ = 0;
+  for (std::size_t j = 0; j < static_cast<std::size_t>(k_); ++j) {
+    std::copy_n(b_.begin() + static_cast<std::ptrdiff_t>(j * size), size, b.begin());
+    std::ranges::fill(x, 0.0);
+    iterations_ += ConjugateGradient(kernels_, a_, preconditioner_, b, x, n_);
+    std::ranges::copy(x, x_.begin() + static_cast<std::ptrdiff_t>(j * size));
+  }
   return true;
 }
 
@@ -56,64 +84,134 @@ bool zolotareva_a_sle_gradient_method_seq::TestTaskSequential::PostProcessingImp
   return true;
 }
 
-void zolotareva_a_sle_gradient_method_seq::TestTaskSequential::ConjugateGradient(const std::vector<double>& a,
-                                                                                 const std::vector<double>& b,
-                                                                                 std::vector<double>& x, int n) {
-  double initial_res_norm = 0.0;
-  DotProduct(initial_res_norm, b, b, n);
-  initial_res_norm = std::sqrt(initial_res_norm);
+int zolotareva_a_sle_gradient_method_seq::TestTaskSequential::ConjugateGradient(
+    ppc::core::KrylovKernels& kernels, const ppc::core::MatrixOperator& a,
+    const ppc::core::Preconditioner& preconditioner, const std::vector<double>& b, std::vector<double>& x, int n) {
+  const auto size = static_cast<std::size_t>(n);
+  double initial_res_norm = std::sqrt(kernels.Dot(size, b.data(), b.data()));
   double threshold = initial_res_norm == 0.0 ? 1e-12 : (1e-12 * initial_res_norm);
 
   std::vector<double> r = b;  // начальный вектор невязки r = b - a*x0, x0 = 0
-  std::vector<double> p = r;  // начальное направление поиска p = r
-  double rs_old = 0;
-  DotProduct(rs_old, r, r, n);
-
+  std::vector<double> ap(size);
+  // z = M^-1 * r, без предобуславливателя z совпадает с r
+  const bool preconditioned = preconditioner.Active();
+  std::vector<double> z(preconditioned ? size : 0);
+  double rz_old = preconditioned ? preconditioner.Apply(kernels, r.data(), z.data())
+                                 : kernels.Dot(size, r.data(), r.data());
+  std::vector<double> p = preconditioned ? z : r;  // начальное направление поиска p = z
+
+  int sweeps = 0;
   for (int s = 0; s <= n; ++s) {
-    std::vector<double> ap(n, 0.0);
-    MatrixVectorMult(a, p, ap, n);
-    double p_ap = 0.0;
-    DotProduct(p_ap, p, ap, n);
+    // ap = a*p вместе с p*ap за один проход по матрице
+    double p_ap = kernels.ApplyDot(a, p.data(), ap.data());
+    ++sweeps;
     if (p_ap == 0.0) {
       break;
     }
 
-    double alpha = rs_old / p_ap;
-
-    for (int i = 0; i < n; ++i) {
-      x[i] += alpha * p[i];
-      r[i] -= alpha * ap[i];
-    }
+    double alpha = rz_old / p_ap;
 
-    double rs_new = 0.0;
-    DotProduct(rs_new, r, r, n);
+    // x += alpha*p, r -= alpha*ap и новая норма невязки за один проход
+    double rs_new = kernels.CgUpdate(size, alpha, p.data(), ap.data(), x.data(), r.data());
     if (rs_new < threshold) {  // Проверка на сходимость
       break;
     }
-    double beta = rs_new / rs_old;
-    for (int i = 0; i < n; ++i) {
-      p[i] = r[i] + beta * p[i];
-    }
+    double rz_new = preconditioned ? preconditioner.Apply(kernels, r.data(), z.data()) : rs_new;
+    double beta = rz_new / rz_old;
+    kernels.Xpby(size, preconditioned ? z.data() : r.data(), beta, p.data());
 
-    rs_old = rs_new;
+    rz_old = rz_new;
   }
+  return sweeps;
 }
 
-void zolotareva_a_sle_gradient_method_seq::TestTaskSequential::DotProduct(double& sum, const std::vector<double>& vec1,
-                                                                          const std::vector<double>& vec2, int n) {
-  for (int i = 0; i < n; ++i) {
-    sum += vec1[i] * vec2[i];
+int zolotareva_a_sle_gradient_method_seq::TestTaskSequential::BatchedConjugateGradient(
+    ppc::core::KrylovKernels& kernels, const ppc::core::MatrixOperator& a,
+    const ppc::core::Preconditioner& preconditioner, const std::vector<double>& b, std::vector<double>& x, int n,
+    int k) {
+  // векторы блока хранятся вперемешку: элемент i вектора j лежит в [i*k + j], так что строка a
+  // загружается один раз на все k векторов
+  const auto size = static_cast<std::size_t>(n);
+  const auto width = static_cast<std::size_t>(k);
+  std::vector<double> r(size * width);  // начальная невязка r = b, x0 = 0
+  for (std::size_t i = 0; i < size; ++i) {
+    for (std::size_t j = 0; j < width; ++j) {
+      r[(i * width) + j] = b[(j * size) + i];
+    }
   }
-}
+  std::vector<double> xs(r.size(), 0.0);
+  std::vector<double> ap(r.size());
+  const bool preconditioned = preconditioner.Active();
+  std::vector<double> z(preconditioned ? r.size() : 0);
+
+  // скаляры CG - отдельно для каждой правой части
+  std::vector<double> threshold(width);
+  std::vector<double> rz_old(width);
+  std::vector<double> rz_new(width);
+  std::vector<double> p_ap(width);
+  std::vector<double> rs_new(width);
+  std::vector<double> alpha(width, 0.0);
+  std::vector<double> beta(width, 0.0);
+  kernels.DotBatch(size, width, r.data(), r.data(), rz_old.data());
+  for (std::size_t j = 0; j < width; ++j) {
+    double initial_res_norm = std::sqrt(rz_old[j]);
+    threshold[j] = initial_res_norm == 0.0 ? 1e-12 : (1e-12 * initial_res_norm);
+  }
+  if (preconditioned) {
+    preconditioner.ApplyBatch(kernels, width, r.data(), z.data(), rz_old.data());
+  }
+  std::vector<double> p = preconditioned ? z : r;
 
-void zolotareva_a_sle_gradient_method_seq::TestTaskSequential::MatrixVectorMult(const std::vector<double>& matrix,
-                                                                                const std::vector<double>& vector,
-                                                                                std::vector<double>& result, int n) {
-  for (int i = 0; i < n; ++i) {
-    for (int j = 0; j < n; ++j) {
-      result[i] += matrix[(i * n) + j] * vector[j];
+  // сошедшаяся система остаётся в блоке с alpha = beta = 0, её x и r больше не меняются
+  std::vector<bool> active(width, true);
+  std::size_t remaining = width;
+  auto deactivate = [&](std::size_t j) {
+    active[j] = false;
+    --remaining;
+  };
+
+  int sweeps = 0;
+  for (int s = 0; s <= n; ++s) {
+    // ap = a*p для всех k векторов вместе с p*ap за один проход по матрице
+    kernels.ApplyDotBatch(a, width, p.data(), ap.data(), p_ap.data());
+    ++sweeps;
+    for (std::size_t j = 0; j < width; ++j) {
+      if (active[j] && p_ap[j] == 0.0) {
+        deactivate(j);
+      }
+      alpha[j] = active[j] ? rz_old[j] / p_ap[j] : 0.0;
+    }
+
+    kernels.CgUpdateBatch(size, width, alpha.data(), p.data(), ap.data(), xs.data(), r.data(), rs_new.data());
+    for (std::size_t j = 0; j < width; ++j) {
+      if (active[j] && rs_new[j] < threshold[j]) {
+        deactivate(j);
+      }
+    }
+    if (remaining == 0) {
+      break;
+    }
+    if (preconditioned) {
+      preconditioner.ApplyBatch(kernels, width, r.data(), z.data(), rz_new.data());
+    } else {
+      rz_new = rs_new;
+    }
+    for (std::size_t j = 0; j < width; ++j) {
+      beta[j] = 0.0;
+      if (active[j]) {
+        beta[j] = rz_new[j] / rz_old[j];
+        rz_old[j] = rz_new[j];
+      }
+    }
+    kernels.XpbyBatch(size, width, preconditioned ? z.data() : r.data(), beta.data(), p.data());
+  }
+
+  for (std::size_t i = 0; i < size; ++i) {
+    for (std::size_t j = 0; j < width; ++j) {
+      x[(j * size) + i] = xs[(i * width) + j];
     }
   }
+  return sweeps;
 }
 
 bool zolotareva_a_sle_gradient_method_seq::TestTaskSequential::IsPositiveAndSimm(const double* a, int n) {
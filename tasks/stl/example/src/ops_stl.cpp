@@ -2,21 +2,18 @@
 
 #include <cmath>
 #include <cstddef>
-#include <thread>
+#include <cstdint>
 #include <vector>
 
-#include "core/util/include/util.hpp"
+#include "core/gemm/include/gemm.hpp"
+#include "core/thread_pool/include/thread_pool.hpp"
 
 namespace {
-void MatMul(const std::vector<int> &in_vec, int rc_size, std::vector<int> &out_vec) {
-  for (int i = 0; i < rc_size; ++i) {
-    for (int j = 0; j < rc_size; ++j) {
-      out_vec[(i * rc_size) + j] = 0;
-      for (int k = 0; k < rc_size; ++k) {
-        out_vec[(i * rc_size) + j] += in_vec[(i * rc_size) + k] * in_vec[(k * rc_size) + j];
-      }
-    }
-  }
+void MatMul(const std::vector<int> &in_vec, int rc_size, std::vector<int> &out_vec, int row_begin, int row_end) {
+  const auto n = static_cast<std::size_t>(rc_size);
+  const auto first_row = static_cast<std::size_t>(row_begin);
+  ppc::core::Gemm<int>(row_end - row_begin, n, n, 1, in_vec.data() + (first_row * n), n, in_vec.data(), n, 0,
+                       out_vec.data() + (first_row * n), n);
 }
 }  // namespace
 
@@ -39,12 +36,10 @@ bool nesterov_a_test_task_stl::TestTaskSTL::ValidationImpl() {
 }
 
 bool nesterov_a_test_task_stl::TestTaskSTL::RunImpl() {
-  const int num_threads = ppc::util::GetPPCNumThreads();
-  std::vector<std::thread> threads(num_threads);
-  for (int i = 0; i < num_threads; i++) {
-    threads[i] = std::thread(MatMul, std::cref(input_), rc_size_, std::ref(output_));
-    threads[i].join();
-  }
+  // Rows are independent, the shared pool keeps its threads alive between runs
+  ppc::core::ThreadPool::Global().ParallelFor(0, rc_size_, [&](int64_t row_begin, int64_t row_end) {
+    MatMul(input_, rc_size_, output_, static_cast<int>(row_begin), static_cast<int>(row_end));
+  });
   return true;
 }
 
@@ -24,28 +24,17 @@ struct IntegrationParams {
 
   //
 
-  std::shared_ptr<ppc::core::TaskData> CreateTaskData(double& result) {
-    constexpr auto kUglyUnsafeTaskDataAddr = []<typename T>(T& o) {
-      return reinterpret_cast<decltype(std::declval<ppc::core::TaskData>().inputs)::value_type>(&o);
-    };
-
+  std::shared_ptr<ppc::core::TaskData> CreateTaskData(double& result) const {
     auto task_data = std::make_shared<ppc::core::TaskData>();
-
-    task_data->inputs = {kUglyUnsafeTaskDataAddr(*this)};
-    task_data->inputs_count = {1, 1, 2, 2};
-    //
-    task_data->outputs = {kUglyUnsafeTaskDataAddr(result)};
-    task_data->outputs_count = {1};
-
+    task_data->AddInput(this, 1);
+    task_data->AddOutput(&result, 1);
     return task_data;
   }
 
-  static IntegrationParams& FromTaskData(ppc::core::TaskData& task_data) noexcept {
-    return *reinterpret_cast<IntegrationParams*>(task_data.inputs[0]);
-  }
-  static double& OutputOf(ppc::core::TaskData& task_data) noexcept {
-    return *reinterpret_cast<double*>(task_data.outputs[0]);
+  static const IntegrationParams& FromTaskData(const ppc::core::TaskData& task_data) {
+    return task_data.GetInput<IntegrationParams>(0)[0];
   }
+  static double& OutputOf(const ppc::core::TaskData& task_data) { return task_data.GetOutput<double>(0)[0]; }
 };
 
 class TaskCommon : public ppc::core::Task {
@@ -58,7 +47,7 @@ class TaskCommon : public ppc::core::Task {
   bool PostProcessingImpl() override;
 
  protected:
-  IntegrationParams* params;
+  const IntegrationParams* params;
   double res;
 
   double vol;
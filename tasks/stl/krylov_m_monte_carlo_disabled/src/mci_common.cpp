@@ -6,6 +6,9 @@
 #include <random>
 
 bool krylov_m_monte_carlo::TaskCommon::ValidationImpl() {
+  if (!task_data->HasInput<IntegrationParams>(0) || !task_data->HasOutput<double>(0)) {
+    return false;
+  }
   return std::ranges::all_of(IntegrationParams::FromTaskData(*task_data).bounds,
                              [](const Bound& bound) { return bound.second >= bound.first; });
 }
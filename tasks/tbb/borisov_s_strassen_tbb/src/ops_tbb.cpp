@@ -0,0 +1,93 @@
+#include "tbb/borisov_s_strassen_tbb/include/ops_tbb.hpp"
+
+#include <oneapi/tbb/task_arena.h>
+#include <oneapi/tbb/task_group.h>
+
+#include <cstddef>
+#include <functional>
+
+#include "core/gemm/include/strassen.hpp"
+#include "core/util/include/util.hpp"
+
+namespace borisov_s_strassen_tbb {
+
+ppc::core::StrassenConfig ParallelStrassenTbb::EngineConfig(std::size_t cutoff) {
+  ppc::core::StrassenConfig config;
+  config.cutoff = cutoff;
+  config.fork = [](int count, const std::function<void(int)> &body) {
+    oneapi::tbb::task_group group;
+    for (int i = 0; i < count; i++) {
+      group.run([&body, i] { body(i); });
+    }
+    group.wait();
+  };
+  // 7 products per level, 49 below two levels
+  config.parallel_depth = ppc::util::GetPPCNumThreads() > 7 ? 2 : 1;
+  return config;
+}
+
+bool ParallelStrassenTbb::PreProcessingImpl() {
+  size_t input_count = task_data->inputs_count[0];
+  auto *double_ptr = reinterpret_cast<double *>(task_data->inputs[0]);
+  input_.assign(double_ptr, double_ptr + input_count);
+
+  size_t output_count = task_data->outputs_count[0];
+  output_.resize(output_count, 0.0);
+
+  if (input_.size() < 4) {
+    return false;
+  }
+
+  rowsA_ = static_cast<int>(input_[0]);
+  colsA_ = static_cast<int>(input_[1]);
+  rowsB_ = static_cast<int>(input_[2]);
+  colsB_ = static_cast<int>(input_[3]);
+
+  if (rowsA_ > 0 && colsA_ > 0 && colsB_ > 0) {
+    engine_.Reserve(rowsA_, colsB_, colsA_);
+  }
+  return true;
+}
+
+bool ParallelStrassenTbb::ValidationImpl() {
+  if (task_data->inputs_count[0] < 4) {
+    return false;
+  }
+  // Reads the header itself: PreProcessing has not run yet
+  const auto *header = reinterpret_cast<double *>(task_data->inputs[0]);
+  const auto rows_a = static_cast<int>(header[0]);
+  const auto cols_a = static_cast<int>(header[1]);
+  const auto rows_b = static_cast<int>(header[2]);
+  const auto cols_b = static_cast<int>(header[3]);
+  if (rows_a < 0 || cols_a < 0 || cols_b < 0 || cols_a != rows_b) {
+    return false;
+  }
+  const size_t needed = 4 + (static_cast<size_t>(rows_a) * cols_a) + (static_cast<size_t>(rows_b) * cols_b);
+  return task_data->inputs_count[0] >= needed &&
+         task_data->outputs_count[0] >= 2 + (static_cast<size_t>(rows_a) * cols_b);
+}
+
+bool ParallelStrassenTbb::RunImpl() {
+  const double *a = input_.data() + 4;
+  const double *b = a + (static_cast<size_t>(rowsA_) * colsA_);
+
+  output_[0] = static_cast<double>(rowsA_);
+  output_[1] = static_cast<double>(colsB_);
+  if (rowsA_ > 0 && colsA_ > 0 && colsB_ > 0) {
+    oneapi::tbb::task_arena arena(ppc::util::GetPPCNumThreads());
+    arena.execute(
+        [&] { engine_.Multiply(rowsA_, colsB_, colsA_, a, colsA_, b, colsB_, output_.data() + 2, colsB_); });
+  }
+
+  return true;
+}
+
+bool ParallelStrassenTbb::PostProcessingImpl() {
+  auto *out_ptr = reinterpret_cast<double *>(task_data->outputs[0]);
+  for (size_t i = 0; i < output_.size(); ++i) {
+    out_ptr[i] = output_[i];
+  }
+  return true;
+}
+
+}  // namespace borisov_s_strassen_tbb
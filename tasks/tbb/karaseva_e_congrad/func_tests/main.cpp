@@ -0,0 +1,415 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/linalg/include/linear_operator.hpp"
+#include "core/linalg/include/preconditioner.hpp"
+#include "core/task/include/task.hpp"
+#include "tbb/karaseva_e_congrad/include/ops_tbb.hpp"
+
+namespace {
+
+// Function to generate a random symmetric positive-definite matrix of size matrix_size x matrix_size.
+// The matrix is computed as A = R^T * R.
+std::vector<double> GenerateRandomSPDMatrix(size_t matrix_size, unsigned int seed = 42) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(0.1, 1.0);
+  std::vector<double> r_matrix(matrix_size * matrix_size);
+  for (size_t i = 0; i < matrix_size * matrix_size; ++i) {
+    r_matrix[i] = dist(gen);
+  }
+  std::vector<double> a_matrix(matrix_size * matrix_size, 0.0);
+  // Compute a_matrix = R^T * R
+  for (size_t i = 0; i < matrix_size; ++i) {
+    for (size_t j = 0; j < matrix_size; ++j) {
+      for (size_t k = 0; k < matrix_size; ++k) {
+        a_matrix[(i * matrix_size) + j] += (r_matrix[(k * matrix_size) + i] * r_matrix[(k * matrix_size) + j]);
+      }
+    }
+  }
+  // Add diagonal dominance
+  for (size_t i = 0; i < matrix_size; ++i) {
+    a_matrix[(i * matrix_size) + i] += static_cast<double>(matrix_size);
+  }
+  return a_matrix;
+}
+
+// Helper function to multiply a_matrix (size matrix_size x matrix_size) by vector x (length matrix_size)
+std::vector<double> MultiplyMatrixVector(const std::vector<double>& a_matrix, const std::vector<double>& x,
+                                         size_t matrix_size) {
+  std::vector<double> result(matrix_size, 0.0);
+  for (size_t i = 0; i < matrix_size; ++i) {
+    for (size_t j = 0; j < matrix_size; ++j) {
+      result[i] += (a_matrix[(i * matrix_size) + j] * x[j]);
+    }
+  }
+  return result;
+}
+
+struct Solution {
+  std::vector<double> x;
+  size_t passes;
+  size_t sync_points;
+  size_t reductions;
+};
+
+// Solves A x = 1 with A added as input 0 by the caller
+Solution SolveOnes(const std::shared_ptr<ppc::core::TaskData>& task_data_tbb, size_t n,
+                   ppc::core::PreconditionerKind* kind = nullptr,
+                   ppc::core::CgVariant variant = ppc::core::kClassicCg) {
+  std::vector<double> b(n, 1.0);
+  std::vector<double> x(n, 0.0);
+  task_data_tbb->inputs.push_back(reinterpret_cast<uint8_t*>(b.data()));
+  task_data_tbb->inputs_count.push_back(n);
+  if (kind != nullptr) {
+    task_data_tbb->AddInput(kind, 1);
+  }
+  task_data_tbb->outputs.push_back(reinterpret_cast<uint8_t*>(x.data()));
+  task_data_tbb->outputs_count.push_back(n);
+
+  karaseva_e_congrad_tbb::TestTaskTBB test_task(task_data_tbb, variant);
+  EXPECT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+  return {.x = x,
+          .passes = test_task.Iterations(),
+          .sync_points = test_task.SyncPoints(),
+          .reductions = test_task.Reductions()};
+}
+
+void ExpectSolvesOnes(const ppc::core::CsrMatrix& a, const std::vector<double>& x) {
+  std::vector<double> ax(a.Size());
+  ppc::core::MatrixOperator::Csr(a).ApplyRows(0, a.Size(), x.data(), ax.data());
+  for (size_t i = 0; i < a.Size(); ++i) {
+    EXPECT_NEAR(ax[i], 1.0, 1e-7) << "row " << i;
+  }
+}
+
+}  // namespace
+
+TEST(karaseva_e_congrad_tbb, test_identity_50) {
+  constexpr size_t kN = 50;
+
+  // Create an identity matrix a_matrix of size kN x kN
+  std::vector<double> a_matrix(kN * kN, 0.0);
+  for (size_t i = 0; i < kN; ++i) {
+    a_matrix[(i * kN) + i] = 1.0;
+  }
+
+  // Create a vector b with elements 1.0, 2.0, ..., kN
+  std::vector<double> b(kN);
+  for (size_t i = 0; i < kN; ++i) {
+    b[i] = static_cast<double>(i + 1);
+  }
+
+  // Vector for the solution x, initially filled with zeros
+  std::vector<double> x(kN, 0.0);
+
+  // Set up task data structure
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.push_back(reinterpret_cast<uint8_t*>(a_matrix.data()));
+  task_data_tbb->inputs_count.push_back(kN * kN);
+  task_data_tbb->inputs.push_back(reinterpret_cast<uint8_t*>(b.data()));
+  task_data_tbb->inputs_count.push_back(kN);
+  task_data_tbb->outputs.push_back(reinterpret_cast<uint8_t*>(x.data()));
+  task_data_tbb->outputs_count.push_back(kN);
+
+  // Create task
+  karaseva_e_congrad_tbb::TestTaskTBB test_task(task_data_tbb);
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+
+  // Check that the computed solution x matches vector b with an accuracy of 1e-9
+  for (size_t i = 0; i < kN; ++i) {
+    EXPECT_NEAR(x[i], b[i], 1e-9);
+  }
+}
+
+TEST(karaseva_e_congrad_tbb, test_random_spd_small) {
+  constexpr size_t kN = 20;  // system size
+
+  // Generate a random SPD matrix a_matrix with a fixed seed
+  auto a_matrix = GenerateRandomSPDMatrix(kN, 42);
+
+  // Generate a random true solution vector x_true
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<double> dist(0.1, 1.0);
+  std::vector<double> x_true(kN);
+  for (size_t i = 0; i < kN; ++i) {
+    x_true[i] = dist(gen);
+  }
+
+  // Compute the right-hand side b = a_matrix * x_true
+  auto b = MultiplyMatrixVector(a_matrix, x_true, kN);
+
+  // Vector for the computed solution x, initially zeros
+  std::vector<double> x(kN, 0.0);
+
+  // Set up task data structure
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.push_back(reinterpret_cast<uint8_t*>(a_matrix.data()));
+  task_data_tbb->inputs_count.push_back(kN * kN);
+  task_data_tbb->inputs.push_back(reinterpret_cast<uint8_t*>(b.data()));
+  task_data_tbb->inputs_count.push_back(kN);
+  task_data_tbb->outputs.push_back(reinterpret_cast<uint8_t*>(x.data()));
+  task_data_tbb->outputs_count.push_back(kN);
+
+  // Create task
+  karaseva_e_congrad_tbb::TestTaskTBB test_task(task_data_tbb);
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+
+  // Check that the computed solution x is close to the true solution x_true with an accuracy of 1e-6
+  for (size_t i = 0; i < kN; ++i) {
+    EXPECT_NEAR(x[i], x_true[i], 1e-6);
+  }
+}
+
+TEST(karaseva_e_congrad_tbb, test_small_system_size_1) {
+  constexpr size_t kN = 1;
+
+  std::vector<double> a_matrix = {5.0};
+  std::vector<double> b = {10.0};
+  std::vector<double> x(kN, 0.0);
+
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.push_back(reinterpret_cast<uint8_t*>(a_matrix.data()));
+  task_data_tbb->inputs_count.push_back(kN * kN);
+  task_data_tbb->inputs.push_back(reinterpret_cast<uint8_t*>(b.data()));
+  task_data_tbb->inputs_count.push_back(kN);
+  task_data_tbb->outputs.push_back(reinterpret_cast<uint8_t*>(x.data()));
+  task_data_tbb->outputs_count.push_back(kN);
+
+  karaseva_e_congrad_tbb::TestTaskTBB test_task(task_data_tbb);
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+
+  EXPECT_NEAR(x[0], 2.0, 1e-10);
+}
+
+TEST(karaseva_e_congrad_tbb, test_validation_invalid_matrix) {
+  constexpr size_t kRows = 2;
+  constexpr size_t kCols = 3;
+  std::vector<double> a_matrix(kRows * kCols, 1.0);
+  std::vector<double> b(kRows, 1.0);
+  std::vector<double> x(kRows, 0.0);
+
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.push_back(reinterpret_cast<uint8_t*>(a_matrix.data()));
+  task_data_tbb->inputs_count.push_back(kRows * kCols);
+  task_data_tbb->inputs.push_back(reinterpret_cast<uint8_t*>(b.data()));
+  task_data_tbb->inputs_count.push_back(kRows);
+  task_data_tbb->outputs.push_back(reinterpret_cast<uint8_t*>(x.data()));
+  task_data_tbb->outputs_count.push_back(kRows);
+
+  karaseva_e_congrad_tbb::TestTaskTBB test_task(task_data_tbb);
+  ASSERT_FALSE(test_task.Validation());
+}
+
+TEST(karaseva_e_congrad_tbb, test_validation_invalid_output) {
+  constexpr size_t kN = 2;
+  std::vector<double> a_matrix(kN * kN, 1.0);
+  std::vector<double> b(kN, 1.0);
+  std::vector<double> x(3, 0.0);
+
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.push_back(reinterpret_cast<uint8_t*>(a_matrix.data()));
+  task_data_tbb->inputs_count.push_back(kN * kN);
+  task_data_tbb->inputs.push_back(reinterpret_cast<uint8_t*>(b.data()));
+  task_data_tbb->inputs_count.push_back(kN);
+  task_data_tbb->outputs.push_back(reinterpret_cast<uint8_t*>(x.data()));
+  task_data_tbb->outputs_count.push_back(3);
+
+  karaseva_e_congrad_tbb::TestTaskTBB test_task(task_data_tbb);
+  ASSERT_FALSE(test_task.Validation());
+}
+
+TEST(karaseva_e_congrad_tbb, test_diagonal_matrix_100) {
+  constexpr size_t kN = 100;
+  std::vector<double> a_matrix(kN * kN, 0.0);
+  for (size_t i = 0; i < kN; ++i) {
+    a_matrix[(i * kN) + i] = static_cast<double>(i + 1);
+  }
+  std::vector<double> b(kN);
+  for (size_t i = 0; i < kN; ++i) {
+    b[i] = static_cast<double>(i + 1);
+  }
+  std::vector<double> x(kN, 0.0);
+
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.push_back(reinterpret_cast<uint8_t*>(a_matrix.data()));
+  task_data_tbb->inputs_count.push_back(kN * kN);
+  task_data_tbb->inputs.push_back(reinterpret_cast<uint8_t*>(b.data()));
+  task_data_tbb->inputs_count.push_back(kN);
+  task_data_tbb->outputs.push_back(reinterpret_cast<uint8_t*>(x.data()));
+  task_data_tbb->outputs_count.push_back(kN);
+
+  karaseva_e_congrad_tbb::TestTaskTBB test_task(task_data_tbb);
+  ASSERT_TRUE(test_task.Validation());
+  test_task.PreProcessing();
+  test_task.Run();
+  test_task.PostProcessing();
+
+  for (size_t i = 0; i < kN; ++i) {
+    EXPECT_NEAR(x[i], 1.0, 1e-9);
+  }
+}
+
+TEST(karaseva_e_congrad_tbb, test_csr_poisson_matches_dense) {
+  auto a = ppc::core::CsrMatrix::Laplacian2D(12, 9);
+  std::vector<double> a_dense(a.Size() * a.Size(), 0.0);
+  for (size_t i = 0; i < a.Size(); ++i) {
+    for (auto k = a.row_ptr[i]; k < a.row_ptr[i + 1]; ++k) {
+      a_dense[(i * a.Size()) + a.col_idx[k]] = a.values[k];
+    }
+  }
+
+  auto task_data_csr = std::make_shared<ppc::core::TaskData>();
+  task_data_csr->AddInput(&a, 1);
+  const auto csr = SolveOnes(task_data_csr, a.Size());
+
+  auto task_data_dense = std::make_shared<ppc::core::TaskData>();
+  task_data_dense->inputs.push_back(reinterpret_cast<uint8_t*>(a_dense.data()));
+  task_data_dense->inputs_count.push_back(a_dense.size());
+  const auto dense = SolveOnes(task_data_dense, a.Size());
+
+  ExpectSolvesOnes(a, csr.x);
+  EXPECT_EQ(csr.passes, dense.passes);
+  for (size_t i = 0; i < a.Size(); ++i) {
+    EXPECT_NEAR(csr.x[i], dense.x[i], 1e-10);
+  }
+}
+
+TEST(karaseva_e_congrad_tbb, test_stencil_operator) {
+  constexpr size_t kNx = 30;
+  constexpr size_t kNy = 20;
+  auto stencil = ppc::core::StencilOperator::Laplacian2D(kNx, kNy);
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->AddInput(&stencil, 1);
+  const auto solution = SolveOnes(task_data_tbb, stencil.size);
+
+  ExpectSolvesOnes(ppc::core::CsrMatrix::Laplacian2D(kNx, kNy), solution.x);
+}
+
+TEST(karaseva_e_congrad_tbb, test_preconditioners_on_poisson) {
+  auto a = ppc::core::CsrMatrix::Laplacian2D(40, 40);
+  std::vector<size_t> passes;
+  for (auto kind : {ppc::core::kNoPreconditioner, ppc::core::kJacobiPreconditioner, ppc::core::kIlu0Preconditioner}) {
+    auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+    task_data_tbb->AddInput(&a, 1);
+    const auto solution = SolveOnes(task_data_tbb, a.Size(), &kind);
+    ExpectSolvesOnes(a, solution.x);
+    passes.push_back(solution.passes);
+  }
+  // The Laplacian has a constant diagonal, so Jacobi only rescales the iteration
+  EXPECT_LE(passes[1], passes[0] + 1);
+  EXPECT_LT(passes[2], passes[0]);
+}
+
+TEST(karaseva_e_congrad_tbb, test_validation_ilu0_needs_csr) {
+  constexpr size_t kN = 4;
+  std::vector<double> a_matrix(kN * kN, 0.0);
+  for (size_t i = 0; i < kN; ++i) {
+    a_matrix[(i * kN) + i] = 2.0;
+  }
+  std::vector<double> b(kN, 1.0);
+  std::vector<double> x(kN, 0.0);
+  auto kind = ppc::core::kIlu0Preconditioner;
+
+  auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+  task_data_tbb->inputs.push_back(reinterpret_cast<uint8_t*>(a_matrix.data()));
+  task_data_tbb->inputs_count.push_back(kN * kN);
+  task_data_tbb->inputs.push_back(reinterpret_cast<uint8_t*>(b.data()));
+  task_data_tbb->inputs_count.push_back(kN);
+  task_data_tbb->AddInput(&kind, 1);
+  task_data_tbb->outputs.push_back(reinterpret_cast<uint8_t*>(x.data()));
+  task_data_tbb->outputs_count.push_back(kN);
+
+  karaseva_e_congrad_tbb::TestTaskTBB test_task(task_data_tbb);
+  ASSERT_FALSE(test_task.Validation());
+}
+
+TEST(karaseva_e_congrad_tbb, test_pipelined_matches_classic) {
+  auto a = ppc::core::CsrMatrix::Laplacian2D(30, 25);
+  for (auto kind : {ppc::core::kNoPreconditioner, ppc::core::kJacobiPreconditioner, ppc::core::kIlu0Preconditioner}) {
+    auto task_data_classic = std::make_shared<ppc::core::TaskData>();
+    task_data_classic->AddInput(&a, 1);
+    const auto classic = SolveOnes(task_data_classic, a.Size(), &kind);
+    auto task_data_pipelined = std::make_shared<ppc::core::TaskData>();
+    task_data_pipelined->AddInput(&a, 1);
+    const auto pipelined = SolveOnes(task_data_pipelined, a.Size(), &kind, ppc::core::kPipelinedCg);
+
+    ExpectSolvesOnes(a, pipelined.x);
+    for (size_t i = 0; i < a.Size(); ++i) {
+      EXPECT_NEAR(pipelined.x[i], classic.x[i], 1e-7) << "kind " << kind << ", row " << i;
+    }
+    // The pipelined loop also counts its first product with A
+    EXPECT_LE(pipelined.passes, classic.passes + 2) << "kind " << kind;
+    EXPECT_GE(pipelined.passes + 2, classic.passes) << "kind " << kind;
+  }
+}
+
+TEST(karaseva_e_congrad_tbb, test_pipelined_has_one_reduction_per_iteration) {
+  auto a = ppc::core::CsrMatrix::Laplacian2D(20, 20);
+  for (auto kind : {ppc::core::kNoPreconditioner, ppc::core::kJacobiPreconditioner}) {
+    auto task_data_classic = std::make_shared<ppc::core::TaskData>();
+    task_data_classic->AddInput(&a, 1);
+    const auto classic = SolveOnes(task_data_classic, a.Size(), &kind);
+    auto task_data_pipelined = std::make_shared<ppc::core::TaskData>();
+    task_data_pipelined->AddInput(&a, 1);
+    const auto pipelined = SolveOnes(task_data_pipelined, a.Size(), &kind, ppc::core::kPipelinedCg);
+
+    // One fused reduction per product with A, against two or three for classic CG. The last product
+    // may go without its update when p^T * A * p underflows the guard
+    EXPECT_LE(pipelined.reductions, pipelined.passes) << "kind " << kind;
+    EXPECT_GE(classic.reductions + 1, 2 * classic.passes) << "kind " << kind;
+    // Two kernel passes per iteration, the product with A and the update sweep, against three or four
+    EXPECT_LE(pipelined.sync_points, (2 * pipelined.passes) + 1) << "kind " << kind;
+    EXPECT_GE(classic.sync_points + 1, 3 * classic.passes) << "kind " << kind;
+  }
+}
+
+TEST(karaseva_e_congrad_tbb, test_pipelined_dense_and_zero_rhs) {
+  constexpr size_t kN = 20;
+  auto a_matrix = GenerateRandomSPDMatrix(kN, 7);
+  std::mt19937 gen(3);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<double> x_true(kN);
+  for (auto& value : x_true) {
+    value = dist(gen);
+  }
+
+  // b = 0 stops before the first iteration, b = A * x_true recovers x_true
+  for (const auto& expected : {std::vector<double>(kN, 0.0), x_true}) {
+    auto b = MultiplyMatrixVector(a_matrix, expected, kN);
+    std::vector<double> x(kN, 1.0);
+
+    auto task_data_tbb = std::make_shared<ppc::core::TaskData>();
+    task_data_tbb->inputs.push_back(reinterpret_cast<uint8_t*>(a_matrix.data()));
+    task_data_tbb->inputs_count.push_back(kN * kN);
+    task_data_tbb->inputs.push_back(reinterpret_cast<uint8_t*>(b.data()));
+    task_data_tbb->inputs_count.push_back(kN);
+    task_data_tbb->outputs.push_back(reinterpret_cast<uint8_t*>(x.data()));
+    task_data_tbb->outputs_count.push_back(kN);
+
+    karaseva_e_congrad_tbb::TestTaskTBB test_task(task_data_tbb, ppc::core::kPipelinedCg);
+    ASSERT_TRUE(test_task.Validation());
+    test_task.PreProcessing();
+    test_task.Run();
+    test_task.PostProcessing();
+    for (size_t i = 0; i < kN; ++i) {
+      EXPECT_NEAR(x[i], expected[i], 1e-6);
+    }
+  }
+}
@@ -1,13 +1,23 @@
 #include <gtest/gtest.h>
 #include <tbb/global_control.h>
 
+#include <memory>
+
 #include "core/util/include/util.hpp"
 #include "oneapi/tbb/global_control.h"
 
 int main(int argc, char** argv) {
-  // Limit the number of threads in TBB
-  tbb::global_control control(tbb::global_control::max_allowed_parallelism, ppc::util::GetPPCNumThreads());
+  // Limit the number of threads in TBB. TBB obeys the smallest of the live limits, so a new count from
+  // SetPPCNumThreads, e.g. a point of a ScalingStudy sweep, replaces the control instead of adding one
+  auto control = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism,
+                                                       ppc::util::GetPPCNumThreads());
+  ppc::util::SetPPCNumThreadsHook([&control](int num_threads) {
+    control.reset();
+    control = std::make_unique<tbb::global_control>(tbb::global_control::max_allowed_parallelism, num_threads);
+  });
 
   ::testing::InitGoogleTest(&argc, argv);
-  return RUN_ALL_TESTS();
+  const int result = RUN_ALL_TESTS();
+  ppc::util::SetPPCNumThreadsHook({});
+  return result;
 }
@@ -6,6 +6,7 @@
 #include <random>
 #include <vector>
 
+#include "core/linalg/include/spgemm.hpp"
 #include "core/task/include/task.hpp"
 #include "tbb/sadikov_I_SparseMatMul_TBB/include/SparseMatrix.hpp"
 #include "tbb/sadikov_I_SparseMatMul_TBB/include/ops_tbb.hpp"
@@ -125,4 +126,108 @@ TEST(sadikov_i_sparse_matrix_multiplication_task_tbb, test_random_matrix) {
   for (auto i = 0; i < static_cast<int>(out.size()); ++i) {
     EXPECT_NEAR(out[i], check_out[i], kEpsilon);
   }
-}
\ No newline at end of file
+}
+
+TEST(sadikov_i_sparse_matrix_multiplication_task_tbb, test_product_shape) {
+  constexpr auto kEpsilon = 0.000001;
+  std::vector<double> fmatrix{1.0, 0.0, -2.0, 0.0, 3.0, 0.0, 4.0, 0.0, 0.0, -1.0};
+  std::vector<double> smatrix{2.0, 0.0, 0.0, 1.0, 0.0, 0.0, 5.0, 0.0, 1.0,  0.0,
+                              0.0, 0.0, 0.0, 3.0, 0.0, 0.0, 0.0, 0.0, -1.0, 2.0};
+  using sadikov_i_sparse_matrix_multiplication_task_tbb::SparseMatrix;
+  auto fsparse = SparseMatrix::MatrixToSparse(2, 5, fmatrix);
+  auto ssparse = SparseMatrix::MatrixToSparse(5, 4, smatrix);
+  auto product = fsparse * ssparse;
+  ASSERT_EQ(product.GetRowsCount(), 2);
+  ASSERT_EQ(product.GetColumnsCount(), 4);
+  auto out = sadikov_i_sparse_matrix_multiplication_task_tbb::FromSparseMatrix(product);
+  auto check_out =
+      sadikov_i_sparse_matrix_multiplication_task_tbb::BaseMatrixMultiplication(fmatrix, 2, 5, smatrix, 5, 4);
+  ASSERT_EQ(out.size(), check_out.size());
+  for (auto i = 0; i < static_cast<int>(out.size()); ++i) {
+    EXPECT_NEAR(out[i], check_out[i], kEpsilon);
+  }
+}
+
+TEST(sadikov_i_sparse_matrix_multiplication_task_tbb, test_sparse_inputs_and_output) {
+  constexpr auto kEpsilon = 0.000001;
+  auto fdense = GetRandomMatrix(30 * 20);
+  auto sdense = GetRandomMatrix(20 * 25);
+  const auto fmatrix = ppc::core::CcsMatrix::FromDense(fdense.data(), 30, 20);
+  const auto smatrix = ppc::core::CcsMatrix::FromDense(sdense.data(), 20, 25);
+  ppc::core::CcsMatrix product;
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->AddInput(&fmatrix, 1);
+  task_data_seq->AddInput(&smatrix, 1);
+  task_data_seq->AddOutput(&product, 1);
+  sadikov_i_sparse_matrix_multiplication_task_tbb::CCSMatrixTBB test_task_sequential(task_data_seq);
+  ASSERT_EQ(test_task_sequential.Validation(), true);
+  test_task_sequential.PreProcessing();
+  test_task_sequential.Run();
+  test_task_sequential.PostProcessing();
+  ASSERT_TRUE(product.IsValid());
+  ASSERT_EQ(product.rows, 30U);
+  ASSERT_EQ(product.cols, 25U);
+  std::vector<double> out(30 * 25);
+  product.ToDense(out.data());
+  auto check_out =
+      sadikov_i_sparse_matrix_multiplication_task_tbb::BaseMatrixMultiplication(fdense, 30, 20, sdense, 20, 25);
+  for (auto i = 0; i < static_cast<int>(out.size()); ++i) {
+    EXPECT_NEAR(out[i], check_out[i], kEpsilon);
+  }
+}
+
+TEST(sadikov_i_sparse_matrix_multiplication_task_tbb, test_sparse_inputs_dense_output) {
+  constexpr auto kEpsilon = 0.000001;
+  constexpr auto kSize = 40;
+  auto fdense = GetRandomMatrix(kSize * kSize);
+  auto sdense = GetRandomMatrix(kSize * kSize);
+  const auto fmatrix = ppc::core::CcsMatrix::FromDense(fdense.data(), kSize, kSize);
+  const auto smatrix = ppc::core::CcsMatrix::FromDense(sdense.data(), kSize, kSize);
+  std::vector<double> out(kSize * kSize, 0.0);
+  auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+  task_data_seq->AddInput(&fmatrix, 1);
+  task_data_seq->AddInput(&smatrix, 1);
+  task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  task_data_seq->outputs_count.emplace_back(out.size());
+  sadikov_i_sparse_matrix_multiplication_task_tbb::CCSMatrixTBB test_task_sequential(task_data_seq);
+  ASSERT_EQ(test_task_sequential.Validation(), true);
+  test_task_sequential.PreProcessing();
+  test_task_sequential.Run();
+  test_task_sequential.PostProcessing();
+  auto check_out = sadikov_i_sparse_matrix_multiplication_task_tbb::BaseMatrixMultiplication(fdense, kSize, kSize,
+                                                                                             sdense, kSize, kSize);
+  for (auto i = 0; i < static_cast<int>(out.size()); ++i) {
+    EXPECT_NEAR(out[i], check_out[i], kEpsilon);
+  }
+}
+
+TEST(sadikov_i_sparse_matrix_multiplication_task_tbb, test_sparse_validation) {
+  const std::vector<double> dense{1.0, 0.0, 2.0, 0.0, 3.0, 0.0, 4.0, 0.0, 0.0, 0.0, 5.0, 6.0};
+  const auto fmatrix = ppc::core::CcsMatrix::FromDense(dense.data(), 4, 3);
+  auto out_of_range = fmatrix;
+  out_of_range.row_idx[0] = 4;
+  ppc::core::CcsMatrix product;
+  std::vector<double> out(4 * 4);
+  auto validate = [&](const ppc::core::CcsMatrix &f, const ppc::core::CcsMatrix &s, bool sparse_output) {
+    auto task_data_seq = std::make_shared<ppc::core::TaskData>();
+    task_data_seq->AddInput(&f, 1);
+    task_data_seq->AddInput(&s, 1);
+    if (sparse_output) {
+      task_data_seq->AddOutput(&product, 1);
+    } else {
+      task_data_seq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+      task_data_seq->outputs_count.emplace_back(out.size());
+    }
+    sadikov_i_sparse_matrix_multiplication_task_tbb::CCSMatrixTBB test_task_sequential(task_data_seq);
+    return test_task_sequential.Validation();
+  };
+  // 4 x 3 times 4 x 3
+  EXPECT_FALSE(validate(fmatrix, fmatrix, true));
+  // 3 x 4 would fit, but the dense output has room for 4 x 4
+  const auto smatrix = ppc::core::CcsMatrix::FromDense(dense.data(), 3, 4);
+  EXPECT_TRUE(validate(fmatrix, smatrix, true));
+  EXPECT_TRUE(validate(fmatrix, smatrix, false));
+  out.resize(5);
+  EXPECT_FALSE(validate(fmatrix, smatrix, false));
+  EXPECT_FALSE(validate(out_of_range, smatrix, true));
+}
@@ -6,9 +6,11 @@
 #include <utility>
 #include <vector>
 
+#include "core/linalg/include/spgemm.hpp"
+
 namespace sadikov_i_sparse_matrix_multiplication_task_tbb {
 class SparseMatrix {
-  constexpr static double kMEpsilon = 0.000001;
+ public:
   struct MatrixComponents {
     std::vector<double> m_values;
     std::vector<int> m_rows;
@@ -19,16 +21,13 @@ class SparseMatrix {
       m_elementsSum.resize(sums_size);
     }
   };
+
+ private:
+  constexpr static double kMEpsilon = 0.000001;
   int m_rowsCount_ = 0;
   int m_columnsCount_ = 0;
   MatrixComponents m_compontents_;
 
-  static SparseMatrix Transpose(const SparseMatrix& matrix);
-  static int GetElementsCount(int index, const std::vector<int>& elements_sum);
-  static double CalculateSum(const SparseMatrix& fmatrix, const SparseMatrix& smatrix,
-                             const std::vector<int>& felements_sum, const std::vector<int>& selements_sum, int i_index,
-                             int j_index);
-
  public:
   SparseMatrix() = default;
   explicit SparseMatrix(int rows_count, int columns_count, MatrixComponents components) noexcept
@@ -39,11 +38,15 @@ class SparseMatrix {
   [[nodiscard]] int GetColumnsCount() const noexcept { return m_columnsCount_; }
   [[nodiscard]] int GetRowsCount() const noexcept { return m_rowsCount_; }
   static SparseMatrix MatrixToSparse(int rows_count, int columns_count, const std::vector<double>& values);
+  static SparseMatrix CcsToSparse(const ppc::core::CcsMatrix& matrix);
+  // Gustavson product through ppc::core::SpGemm; entries with |c| <= kMEpsilon are left out
   SparseMatrix operator*(SparseMatrix& smatrix) const noexcept(false);
 };
 
 std::vector<double> FromSparseMatrix(const SparseMatrix& matrix);
 
+ppc::core::CcsMatrix SparseToCcs(const SparseMatrix& matrix);
+
 std::vector<double> BaseMatrixMultiplication(const std::vector<double>& fmatrix, int fmatrix_rows_count,
                                              int fmatrix_columns_count, const std::vector<double>& smatrix,
                                              int smatrix_rows_count, int smatrix_columns_count);
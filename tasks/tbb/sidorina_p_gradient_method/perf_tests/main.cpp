@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+#include "tbb/sidorina_p_gradient_method/include/ops_tbb.hpp"
+
+namespace {
+
+// PreProcessing runs a Cholesky factorization, so the pipeline test keeps the system smaller
+constexpr int kPipelineSize = 1000;
+constexpr int kTaskRunSize = 2000;
+
+struct System {
+  explicit System(int n) : size(n), a(n * n), b(n), solution(n, 0), result(n) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-1000.0, 1000.0);
+    for (int i = 0; i < size; i++) {
+      b[i] = dist(gen);
+      for (int j = i; j < size; j++) {
+        double value = dist(gen);
+        a[(i * size) + j] = value;
+        a[(j * size) + i] = value;
+      }
+    }
+    for (int i = 0; i < size; i++) {
+      a[(i * size) + i] += static_cast<double>(size) * 1000.0;
+    }
+  }
+
+  int size;
+  double tolerance = 1e-6;
+  std::vector<double> a;
+  std::vector<double> b;
+  std::vector<double> solution;
+  std::vector<double> result;
+};
+
+std::shared_ptr<sidorina_p_gradient_method_tbb::GradientMethod> MakeTask(System &system) {
+  std::shared_ptr<ppc::core::TaskData> task = std::make_shared<ppc::core::TaskData>();
+  task->inputs.emplace_back(reinterpret_cast<uint8_t *>(&system.size));
+  task->inputs_count.emplace_back(1);
+  task->inputs.emplace_back(reinterpret_cast<uint8_t *>(&system.tolerance));
+  task->inputs_count.emplace_back(1);
+  task->inputs.emplace_back(reinterpret_cast<uint8_t *>(system.a.data()));
+  task->inputs_count.emplace_back(system.a.size());
+  task->inputs.emplace_back(reinterpret_cast<uint8_t *>(system.b.data()));
+  task->inputs_count.emplace_back(system.b.size());
+  task->inputs.emplace_back(reinterpret_cast<uint8_t *>(system.solution.data()));
+  task->inputs_count.emplace_back(system.solution.size());
+  task->outputs.emplace_back(reinterpret_cast<uint8_t *>(system.result.data()));
+  task->outputs_count.emplace_back(system.result.size());
+  return std::make_shared<sidorina_p_gradient_method_tbb::GradientMethod>(task);
+}
+
+std::shared_ptr<ppc::core::PerfAttr> MakePerfAttr() {
+  auto perf_attr = std::make_shared<ppc::core::PerfAttr>();
+  perf_attr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perf_attr->current_timer = [t0] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+  return perf_attr;
+}
+
+void ExpectSolved(const System &system) {
+  for (int i = 0; i < system.size; ++i) {
+    double sum = 0.0;
+    for (int j = 0; j < system.size; ++j) {
+      sum += system.a[(i * system.size) + j] * system.result[j];
+    }
+    EXPECT_NEAR(sum, system.b[i], system.tolerance);
+  }
+}
+
+// Each pass reads a once and sweeps about a dozen vectors
+void PrintBandwidth(int size, int passes, double seconds) {
+  const double bytes = passes * sizeof(double) * ((static_cast<double>(size) * size) + (12.0 * size));
+  std::cout << "sidorina_p_gradient_method_tbb:task_run:bandwidth: passes=" << passes
+            << " gb_per_sec=" << bytes / seconds * 1e-9 << '\n';
+}
+
+}  // namespace
+
+TEST(sidorina_p_gradient_method_tbb, test_pipeline_run) {
+  System system(kPipelineSize);
+  auto gradient_method = MakeTask(system);
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(gradient_method);
+  perf_analyzer->PipelineRun(MakePerfAttr(), perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+
+  ExpectSolved(system);
+}
+
+TEST(sidorina_p_gradient_method_tbb, test_task_run) {
+  System system(kTaskRunSize);
+  auto gradient_method = MakeTask(system);
+
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(gradient_method);
+  perf_analyzer->TaskRun(MakePerfAttr(), perf_results);
+  ppc::core::Perf::PrintPerfStatistic(perf_results);
+  PrintBandwidth(system.size, gradient_method->Iterations(), perf_results->median_sec);
+
+  ExpectSolved(system);
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "core/linalg/include/krylov_kernels.hpp"
+#include "core/linalg/include/linear_operator.hpp"
+#include "core/linalg/include/preconditioner.hpp"
+#include "core/task/include/task.hpp"
+#include "core/thread_pool/include/tbb_chunk_runner.hpp"
+
+namespace zolotareva_a_sle_gradient_method_tbb {
+void GenerateSle(std::vector<double>& a, std::vector<double>& b, int n);
+// Входы: a, b и необязательный ppc::core::PreconditionerKind. a - плотная матрица n*n по строкам либо
+// типизированный вход ppc::core::CsrMatrix или ppc::core::StencilOperator. b - k правых частей по n
+// элементов подряд (inputs_count[1] = n*k), решения выводятся в том же порядке. При k > 1 плотная и
+// CSR-матрица решаются блочно: каждый проход по a обслуживает все k правых частей
+class TestTaskTBB : public ppc::core::Task {
+ public:
+  explicit TestTaskTBB(ppc::core::TaskDataPtr task_data) : Task(std::move(task_data)) {}
+  bool PreProcessingImpl() override;
+  bool ValidationImpl() override;
+  bool RunImpl() override;
+  bool PostProcessingImpl() override;
+
+  // Passes over a made by the last run, summed over the right-hand sides that were solved one by one
+  [[nodiscard]] int Iterations() const { return iterations_; }
+
+  // Returns the number of passes over a
+  static int ConjugateGradient(ppc::core::KrylovKernels& kernels, const ppc::core::MatrixOperator& a,
+                               const ppc::core::Preconditioner& preconditioner, const std::vector<double>& b,
+                               std::vector<double>& x, int n);
+  // k systems at once, b and x holding k vectors of n elements one after another; a must support
+  // batched products. Returns the number of passes over a
+  static int BatchedConjugateGradient(ppc::core::KrylovKernels& kernels, const ppc::core::MatrixOperator& a,
+                                      const ppc::core::Preconditioner& preconditioner, const std::vector<double>& b,
+                                      std::vector<double>& x, int n, int k);
+  inline static bool IsPositiveAndSimm(const double* a, int n);
+
+ private:
+  ppc::core::MatrixOperator a_;
+  std::vector<double> b_;
+  std::vector<double> x_;
+  int n_{0};
+  int k_{1};
+  int iterations_{0};
+
+  ppc::core::KrylovKernels kernels_{ppc::core::RunTbb};
+  ppc::core::Preconditioner preconditioner_;
+};
+
+}  // namespace zolotareva_a_sle_gradient_method_tbb
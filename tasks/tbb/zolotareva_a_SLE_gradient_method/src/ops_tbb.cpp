@@ -0,0 +1,256 @@
+#include "tbb/zolotareva_a_SLE_gradient_method/include/ops_tbb.hpp"
+
+#include <oneapi/tbb/task_arena.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "core/linalg/include/krylov_kernels.hpp"
+#include "core/linalg/include/linear_operator.hpp"
+#include "core/linalg/include/preconditioner.hpp"
+#include "core/util/include/util.hpp"
+
+bool zolotareva_a_sle_gradient_method_tbb::TestTaskTBB::PreProcessingImpl() {
+  n_ = static_cast<int>(ppc::core::MatrixOperator::InputSize(*task_data, 0));
+  k_ = static_cast<int>(task_data->inputs_count[1]) / n_;
+  a_ = ppc::core::MatrixOperator::FromInput(*task_data, 0, n_);
+  b_.resize(static_cast<std::size_t>(n_) * k_);
+  x_.resize(b_.size(), 0.0);
+  const auto* input_vector = reinterpret_cast<const double*>(task_data->inputs[1]);
+  std::copy(input_vector, input_vector + b_.size(), b_.begin());
+  preconditioner_.Setup(ppc::core::Preconditioner::KindFromInput(*task_data, 2), a_);
+
+  return true;
+}
+
+bool zolotareva_a_sle_gradient_method_tbb::TestTaskTBB::ValidationImpl() {
+  if (static_cast<int>(task_data->inputs_count[0]) < 0 || static_cast<int>(task_data->inputs_count[1]) < 0 ||
+      static_cast<int>(task_data->outputs_count[0]) < 0) {
+    return false;
+  }
+  if (task_data->inputs_count.size() < 2 || task_data->inputs.size() < 2 || task_data->outputs.empty()) {
+    return false;
+  }
+
+  // a задаётся плотной матрицей n*n, CSR-матрицей или матрично-свободным оператором, b - одной или
+  // несколькими правыми частями длины n
+  const int n = static_cast<int>(ppc::core::MatrixOperator::InputSize(*task_data, 0));
+  if (n == 0 || task_data->inputs_count[1] == 0 || task_data->inputs_count[1] % n != 0) {
+    return false;
+  }
+  const auto a = ppc::core::MatrixOperator::FromInput(*task_data, 0, n);
+  if (a.Empty() || !preconditioner_.TrySetup(ppc::core::Preconditioner::KindFromInput(*task_data, 2), a)) {
+    return false;
+  }
+  if (task_data->outputs_count[0] != task_data->inputs_count[1]) {
+    return false;
+  }
+
+  // проверка симметрии и положительной определённости
+  if (a.GetKind() == ppc::core::MatrixOperator::kDense) {
+    return IsPositiveAndSimm(reinterpret_cast<const double*>(task_data->inputs[0]), n);
+  }
+  // для CSR-матрицы только необходимые условия: симметрия и положительная диагональ
+  if (a.GetCsr() != nullptr) {
+    const auto diagonal = a.Diagonal();
+    return a.GetCsr()->IsSymmetric() && std::ranges::all_of(diagonal, [](double d) { return d > 0.0; });
+  }
+  // матрично-свободный оператор проверить нельзя
+  return true;
+}
+
+bool zolotareva_a_sle_gradient_method_tbb::TestTaskTBB::RunImpl() {
+  std::ranges::fill(x_, 0.0);
+  oneapi::tbb::task_arena arena(ppc::util::GetPPCNumThreads());
+  arena.execute([&] {
+    if (k_ > 1 && a_.SupportsBatch()) {
+      iterations_ = BatchedConjugateGradient(kernels_, a_, preconditioner_, b_, x_, n_, k_);
+      return;
+    }
+    // одна правая часть или матрично-свободный оператор: системы решаются по очереди
+    const auto size = static_cast<std::size_t>(n_);
+    std::vector<double> b(size);
+    std::vector<double> x(size);
+    iterations_ = 0;
+    for (std::size_t j = 0; j < static_cast<std::size_t>(k_); ++j) {
+      std::copy_n(b_.begin() + static_cast<std::ptrdiff_t>(j * size), size, b.begin());
+      std::ranges::fill(x, 0.0);
+      iterations_ += ConjugateGradient(kernels_, a_, preconditioner_, b, x, n_);
+      std::ranges::copy(x, x_.begin() + static_cast<std::ptrdiff_t>(j * size));
+    }
+  });
+  return true;
+}
+
+bool zolotareva_a_sle_gradient_method_tbb::TestTaskTBB::PostProcessingImpl() {
+  auto* output_raw = reinterpret_cast<double*>(task_data->outputs[0]);
+  std::ranges::copy(x_.begin(), x_.end(), output_raw);
+  return true;
+}
+
+int zolotareva_a_sle_gradient_method_tbb::TestTaskTBB::ConjugateGradient(
+    ppc::core::KrylovKernels& kernels, const ppc::core::MatrixOperator& a,
+    const ppc::core::Preconditioner& preconditioner, const std::vector<double>& b, std::vector<double>& x, int n) {
+  const auto size = static_cast<std::size_t>(n);
+  double initial_res_norm = std::sqrt(kernels.Dot(size, b.data(), b.data()));
+  double threshold = initial_res_norm == 0.0 ? 1e-12 : (1e-12 * initial_res_norm);
+
+  std::vector<double> r = b;  // начальный вектор невязки r = b - a*x0, x0 = 0
+  std::vector<double> ap(size);
+  // z = M^-1 * r, без предобуславливателя z совпадает с r
+  const bool preconditioned = preconditioner.Active();
+  std::vector<double> z(preconditioned ? size : 0);
+  double rz_old = preconditioned ? preconditioner.Apply(kernels, r.data(), z.data())
+                                 : kernels.Dot(size, r.data(), r.data());
+  std::vector<double> p = preconditioned ? z : r;  // начальное направление поиска p = z
+
+  int sweeps = 0;
+  for (int s = 0; s <= n; ++s) {
+    // ap = a*p вместе с p*ap за один проход по матрице
+    double p_ap = kernels.ApplyDot(a, p.data(), ap.data());
+    ++sweeps;
+    if (p_ap == 0.0) {
+      break;
+    }
+
+    double alpha = rz_old / p_ap;
+
+    // x += alpha*p, r -= alpha*ap и новая норма невязки за один проход
+    double rs_new = kernels.CgUpdate(size, alpha, p.data(), ap.data(), x.data(), r.data());
+    if (rs_new < threshold) {  // Проверка на сходимость
+      break;
+    }
+    double rz_new = preconditioned ? preconditioner.Apply(kernels, r.data(), z.data()) : rs_new;
+    double beta = rz_new / rz_old;
+    kernels.Xpby(size, preconditioned ? z.data() : r.data(), beta, p.data());
+
+    rz_old = rz_new;
+  }
+  return sweeps;
+}
+
+int zolotareva_a_sle_gradient_method_tbb::TestTaskTBB::BatchedConjugateGradient(
+    ppc::core::KrylovKernels& kernels, const ppc::core::MatrixOperator& a,
+    const ppc::core::Preconditioner& preconditioner, const std::vector<double>& b, std::vector<double>& x, int n,
+    int k) {
+  // векторы блока хранятся вперемешку: элемент i вектора j лежит в [i*k + j], так что строка a
+  // загружается один раз на все k векторов
+  const auto size = static_cast<std::size_t>(n);
+  const auto width = static_cast<std::size_t>(k);
+  std::vector<double> r(size * width);  // начальная невязка r = b, x0 = 0
+  for (std::size_t i = 0; i < size; ++i) {
+    for (std::size_t j = 0; j < width; ++j) {
+      r[(i * width) + j] = b[(j * size) + i];
+    }
+  }
+  std::vector<double> xs(r.size(), 0.0);
+  std::vector<double> ap(r.size());
+  const bool preconditioned = preconditioner.Active();
+  std::vector<double> z(preconditioned ? r.size() : 0);
+
+  // скаляры CG - отдельно для каждой правой части
+  std::vector<double> threshold(width);
+  std::vector<double> rz_old(width);
+  std::vector<double> rz_new(width);
+  std::vector<double> p_ap(width);
+  std::vector<double> rs_new(width);
+  std::vector<double> alpha(width, 0.0);
+  std::vector<double> beta(width, 0.0);
+  kernels.DotBatch(size, width, r.data(), r.data(), rz_old.data());
+  for (std::size_t j = 0; j < width; ++j) {
+    double initial_res_norm = std::sqrt(rz_old[j]);
+    threshold[j] = initial_res_norm == 0.0 ? 1e-12 : (1e-12 * initial_res_norm);
+  }
+  if (preconditioned) {
+    preconditioner.ApplyBatch(kernels, width, r.data(), z.data(), rz_old.data());
+  }
+  std::vector<double> p = preconditioned ? z : r;
+
+  // сошедшаяся система остаётся в блоке с alpha = beta = 0, её x и r больше не меняются
+  std::vector<bool> active(width, true);
+  std::size_t remaining = width;
+  auto deactivate = [&](std::size_t j) {
+    active[j] = false;
+    --remaining;
+  };
+
+  int sweeps = 0;
+  for (int s = 0; s <= n; ++s) {
+    // ap = a*p для всех k векторов вместе с p*ap за один проход по матрице
+    kernels.ApplyDotBatch(a, width, p.data(), ap.data(), p_ap.data());
+    ++sweeps;
+    for (std::size_t j = 0; j < width; ++j) {
+      if (active[j] && p_ap[j] == 0.0) {
+        deactivate(j);
+      }
+      alpha[j] = active[j] ? rz_old[j] / p_ap[j] : 0.0;
+    }
+
+    kernels.CgUpdateBatch(size, width, alpha.data(), p.data(), ap.data(), xs.data(), r.data(), rs_new.data());
+    for (std::size_t j = 0; j < width; ++j) {
+      if (active[j] && rs_new[j] < threshold[j]) {
+        deactivate(j);
+      }
+    }
+    if (remaining == 0) {
+      break;
+    }
+    if (preconditioned) {
+      preconditioner.ApplyBatch(kernels, width, r.data(), z.data(), rz_new.data());
+    } else {
+      rz_new = rs_new;
+    }
+    for (std::size_t j = 0; j < width; ++j) {
+      beta[j] = 0.0;
+      if (active[j]) {
+        beta[j] = rz_new[j] / rz_old[j];
+        rz_old[j] = rz_new[j];
+      }
+    }
+    kernels.XpbyBatch(size, width, preconditioned ? z.data() : r.data(), beta.data(), p.data());
+  }
+
+  for (std::size_t i = 0; i < size; ++i) {
+    for (std::size_t j = 0; j < width; ++j) {
+      x[(j * size) + i] = xs[(i * width) + j];
+    }
+  }
+  return sweeps;
+}
+
+bool zolotareva_a_sle_gradient_method_tbb::TestTaskTBB::IsPositiveAndSimm(const double* a, int n) {
+  std::vector<double> m(n * n);
+  // копируем и проверяем симметричность
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      double val = a[(i * n) + j];
+      m[(i * n) + j] = val;
+      if (j > i) {
+        if (val != a[(j * n) + i]) {
+          return false;
+        }
+      }
+    }
+  }
+  // проверяем позитивную определенность
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j <= i; ++j) {
+      double sum = m[(i * n) + j];
+      for (int k = 0; k < j; k++) {
+        sum -= m[(i * n) + k] * m[(j * n) + k];
+      }
+
+      if (i == j) {
+        if (sum <= 1e-15) {
+          return false;
+        }
+        m[(i * n) + j] = std::sqrt(sum);
+      } else {
+        m[(i * n) + j] = sum / m[(j * n) + j];
+      }
+    }
+  }
+  return true;
+}